@@ -17,6 +17,7 @@
  * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
  */
 #include <gtk/gtkimmodule.h>
+#include <glib-unix.h>
 #include "cim.h"
 #ifdef GDK_WINDOWING_X11
 #include <gdk/x11/gdkx.h>
@@ -29,12 +30,16 @@ typedef struct _CimGicClass CimGicClass;
 
 struct _CimGic
 {
-  GtkIMContext  parent_instance;
-
-  CimIc*        ic;
-  GtkIMContext* simple;
-  GtkWidget*    client_widget;
-  CimSurround   surround;
+  GtkIMContext   parent_instance;
+
+  CimIc*         ic;
+  GtkIMContext*  simple;
+  GtkWidget*     client_widget;
+  gboolean       use_preedit;
+  PangoAttrList* attrs; /* preedit attributes of attrs_generation */
+  uint64_t       attrs_generation;
+  uint64_t       delta_generation; /* of the last preedit delta */
+  int            cursor_pos; /* of the last preedit-changed */
 };
 
 struct _CimGicClass
@@ -44,32 +49,53 @@ struct _CimGicClass
 
 G_DEFINE_DYNAMIC_TYPE (CimGic, cim_gic, GTK_TYPE_IM_CONTEXT);
 
+static GSource* cim_async_source;
+
+static void cim_gic_create_ic (CimGic* gic);
+
 static gboolean cim_gic_filter_keypress (GtkIMContext* context, GdkEvent* event)
 {
-  gboolean retval;
+  CimGic*  gic = CIM_GIC (context);
   CimEvent cevent;
 
+  if (!gic->ic)
+    cim_gic_create_ic (gic);
+
   if (gdk_event_get_event_type (event) == GDK_KEY_PRESS)
     cevent.type = CIM_EVENT_KEY_PRESS;
   else
     cevent.type = CIM_EVENT_KEY_RELEASE;
 
-  cevent.state   = gdk_event_get_modifier_state (event);
-  cevent.keyval  = gdk_key_event_get_keyval  (event);
-  cevent.keycode = gdk_key_event_get_keycode (event);
+  cevent.state     = gdk_event_get_modifier_state (event);
+  cevent.keyval    = gdk_key_event_get_keyval  (event);
+  cevent.keycode   = gdk_key_event_get_keycode (event);
+  cevent.time      = gdk_event_get_time (event);
+  cevent.flags     = 0;
+  cevent.n_repeats = 0;
 
-  retval = cim_ic_filter_event (CIM_GIC (context)->ic, &cevent);
+  /* GTK 4 cannot give a key back to the widget once it is claimed, so the
+   * engine answers here instead of through cim_ic_filter_event_async(). */
+  if (cim_ic_filter_event (gic->ic, &cevent))
+    return TRUE;
 
-  if (!retval)
-    return gtk_im_context_filter_keypress (CIM_GIC (context)->simple, event);
+  return gtk_im_context_filter_keypress (gic->simple, event);
+}
 
-  return retval;
+static gboolean on_async_fd (int fd, GIOCondition condition, gpointer unused)
+{
+  cim_dispatch ();
+
+  return G_SOURCE_CONTINUE;
 }
 
 static void cim_gic_reset (GtkIMContext* context)
 {
-  cim_ic_reset (CIM_GIC (context)->ic);
-  gtk_im_context_reset (CIM_GIC (context)->simple);
+  CimGic* gic = CIM_GIC (context);
+
+  if (gic->ic)
+    cim_ic_reset (gic->ic);
+
+  gtk_im_context_reset (gic->simple);
 }
 
 static void cim_gic_set_client_widget (GtkIMContext* context, GtkWidget* widget)
@@ -86,67 +112,116 @@ static void cim_gic_set_client_widget (GtkIMContext* context, GtkWidget* widget)
     gic->client_widget = g_object_ref (widget);
 }
 
-static void cim_gic_get_preedit_string (GtkIMContext*   context,
-                                        char**          text,
-                                        PangoAttrList** attrs,
-                                        int*            cursor_pos)
+/*
+ * Widgets ask for the preedit string several times after each
+ * preedit-changed, so the attribute list is built once per preedit
+ * generation and shared by reference.
+ */
+static PangoAttrList* cim_gic_get_attrs (CimGic* gic)
 {
   const CimPreedit* preedit;
+  const CimText*    preedit_text;
+  PangoAttribute*   attr;
+  uint64_t          generation = cim_ic_get_preedit_generation (gic->ic);
+  int               start;
+  int               end;
 
-  preedit = cim_ic_get_preedit (CIM_GIC (context)->ic);
+  if (gic->attrs && gic->attrs_generation == generation)
+    return gic->attrs;
 
-  if (text)
-    *text = g_strdup (preedit->text);
+  if (gic->attrs)
+    pango_attr_list_unref (gic->attrs);
 
-  if (cursor_pos)
-    *cursor_pos = preedit->cursor_pos;
+  preedit      = cim_ic_get_preedit (gic->ic);
+  preedit_text = cim_ic_get_preedit_text (gic->ic, true);
 
-  if (attrs)
-  {
-    PangoAttribute* attr;
-    char* p1;
-    char* p2;
+  gic->attrs            = pango_attr_list_new ();
+  gic->attrs_generation = generation;
 
-    *attrs = pango_attr_list_new ();
+  for (int i = 0; i < preedit->attrs_len; i++)
+  {
+    start = preedit_text->byte_offsets[CLAMP (preedit->attrs[i].start_index,
+                                              0, preedit_text->n_chars)];
+    end   = preedit_text->byte_offsets[CLAMP (preedit->attrs[i].end_index,
+                                              0, preedit_text->n_chars)];
 
-    for (int i = 0; i < preedit->attrs_len; i++)
+    switch (preedit->attrs[i].type)
     {
-      p1 = g_utf8_offset_to_pointer (preedit->text, preedit->attrs[i].start_index);
-      p2 = g_utf8_offset_to_pointer (preedit->text, preedit->attrs[i].end_index);
+      case CIM_PREEDIT_ATTR_UNDERLINE:
+        attr = pango_attr_underline_new (PANGO_UNDERLINE_SINGLE);
+        break;
+      case CIM_PREEDIT_ATTR_HIGHLIGHT:
+        attr = pango_attr_background_new (0, 0xffff, 0);
+        attr->start_index = start;
+        attr->end_index   = end;
+        pango_attr_list_insert (gic->attrs, attr);
+
+        attr = pango_attr_foreground_new (0, 0, 0);
+        break;
+      default:
+        attr = pango_attr_underline_new (PANGO_UNDERLINE_SINGLE);
+        break;
+    }
 
-      switch (preedit->attrs[i].type)
-      {
-        case CIM_PREEDIT_ATTR_UNDERLINE:
-          attr = pango_attr_underline_new (PANGO_UNDERLINE_SINGLE);
-          break;
-        case CIM_PREEDIT_ATTR_HIGHLIGHT:
-          attr = pango_attr_background_new (0, 0xffff, 0);
-          attr->start_index = p1 - preedit->text;
-          attr->end_index   = p2 - preedit->text;
-          pango_attr_list_insert (*attrs, attr);
-
-          attr = pango_attr_foreground_new (0, 0, 0);
-          break;
-        default:
-          attr = pango_attr_underline_new (PANGO_UNDERLINE_SINGLE);
-          break;
-      }
+    attr->start_index = start;
+    attr->end_index   = end;
+    pango_attr_list_insert (gic->attrs, attr);
+  }
 
-      attr->start_index = p1 - preedit->text;
-      attr->end_index   = p2 - preedit->text;
-      pango_attr_list_insert (*attrs, attr);
-    }
+  return gic->attrs;
+}
+
+static void cim_gic_get_preedit_string (GtkIMContext*   context,
+                                        char**          text,
+                                        PangoAttrList** attrs,
+                                        int*            cursor_pos)
+{
+  CimGic* gic = CIM_GIC (context);
+
+  if (!gic->ic)
+  {
+    gtk_im_context_get_preedit_string (gic->simple, text, attrs, cursor_pos);
+    return;
   }
+
+  if (text)
+  {
+    const CimText* preedit_text = cim_ic_get_preedit_text (gic->ic, false);
+    *text = g_strndup (preedit_text->text, preedit_text->len);
+  }
+
+  if (cursor_pos)
+    *cursor_pos = cim_ic_get_preedit (gic->ic)->cursor_pos;
+
+  if (attrs)
+    *attrs = pango_attr_list_ref (cim_gic_get_attrs (gic));
 }
 
 static void cim_gic_focus_in (GtkIMContext* context)
 {
-  cim_ic_focus_in (CIM_GIC (context)->ic);
+  CimGic* gic = CIM_GIC (context);
+
+  /* Focus-in follows focus-out, so nothing is being composed and the IC
+   * can move to a reloaded engine here. */
+  if (!gic->ic)
+  {
+    cim_gic_create_ic (gic);
+  }
+  else if (!cim_ic_is_current (gic->ic))
+  {
+    cim_ic_free (gic->ic);
+    cim_gic_create_ic (gic);
+  }
+
+  cim_ic_focus_in (gic->ic);
 }
 
 static void cim_gic_focus_out (GtkIMContext* context)
 {
-  cim_ic_focus_out (CIM_GIC (context)->ic);
+  CimGic* gic = CIM_GIC (context);
+
+  if (gic->ic)
+    cim_ic_focus_out (gic->ic);
 }
 
 static void cim_gic_set_cursor_pos (GtkIMContext* context, GdkRectangle* area)
@@ -186,7 +261,8 @@ static void cim_gic_set_cursor_pos (GtkIMContext* context, GdkRectangle* area)
     }
   }
 
-  cim_ic_set_cursor_pos (gic->ic, (const CimRect*) &root_area);
+  if (gic->ic)
+    cim_ic_set_cursor_pos (gic->ic, (const CimRect*) &root_area);
 }
 
 static void cb_preedit_start (CimIc* unused, CimGic* gic)
@@ -199,10 +275,35 @@ static void cb_preedit_end (CimIc* unused, CimGic* gic)
   g_signal_emit_by_name (gic, "preedit-end");
 }
 
-static void cb_preedit_changed (CimIc*            unused1,
-                                const CimPreedit* unused2,
-                                CimGic*           gic)
+static void cb_preedit_changed (GtkIMContext* unused, CimGic* gic)
+{
+  g_signal_emit_by_name (gic, "preedit-changed");
+}
+
+/*
+ * Engines often report the same preedit again, or only move the cursor.
+ * The widget is not told about the former, and the attribute list is kept
+ * for the latter.  A delta is only trusted if it follows the last one.
+ */
+static void cb_preedit_delta (CimIc*                 unused,
+                              const CimPreeditDelta* delta,
+                              CimGic*                gic)
 {
+  gboolean follows = gic->delta_generation + 1 == delta->generation;
+
+  gic->delta_generation = delta->generation;
+
+  if (follows && !delta->n_deleted && !delta->n_inserted &&
+      delta->attr_start == delta->attr_end)
+  {
+    if (gic->attrs && gic->attrs_generation + 1 == delta->generation)
+      gic->attrs_generation = delta->generation;
+
+    if (delta->preedit->cursor_pos == gic->cursor_pos)
+      return;
+  }
+
+  gic->cursor_pos = delta->preedit->cursor_pos;
   g_signal_emit_by_name (gic, "preedit-changed");
 }
 
@@ -211,18 +312,23 @@ static void cim_gic_set_use_preedit (GtkIMContext* context,
 {
   CimGic* gic = CIM_GIC (context);
 
+  gic->use_preedit = use_preedit;
+
+  if (!gic->ic)
+    return;
+
   if (use_preedit)
   {
     cim_ic_set_callback (gic->ic, CIM_CB_PREEDIT_START, cb_preedit_start, gic);
     cim_ic_set_callback (gic->ic, CIM_CB_PREEDIT_END, cb_preedit_end, gic);
-    cim_ic_set_callback (gic->ic, CIM_CB_PREEDIT_CHANGED,
-                         cb_preedit_changed, gic);
+    cim_ic_set_callback (gic->ic, CIM_CB_PREEDIT_DELTA,
+                         cb_preedit_delta, gic);
   }
   else
   {
     cim_ic_set_callback (gic->ic, CIM_CB_PREEDIT_START,   NULL, NULL);
     cim_ic_set_callback (gic->ic, CIM_CB_PREEDIT_END,     NULL, NULL);
-    cim_ic_set_callback (gic->ic, CIM_CB_PREEDIT_CHANGED, NULL, NULL);
+    cim_ic_set_callback (gic->ic, CIM_CB_PREEDIT_DELTA,   NULL, NULL);
   }
 }
 
@@ -232,10 +338,10 @@ static void cim_gic_set_surround (GtkIMContext* context,
                                   int cursor_index_in_bytes)
 {
   CimGic* gic = CIM_GIC (context);
-  gic->surround.text = (char*) text;
-  gic->surround.len  = len;
-  gic->surround.cursor_pos = g_utf8_strlen (text, cursor_index_in_bytes);
-  gic->surround.anchor_pos = gic->surround.cursor_pos;
+
+  if (gic->ic)
+    cim_ic_set_surround (gic->ic, text, len,
+                         cursor_index_in_bytes, cursor_index_in_bytes);
 }
 
 static void cim_gic_set_surround_with_selection (GtkIMContext* context,
@@ -245,10 +351,10 @@ static void cim_gic_set_surround_with_selection (GtkIMContext* context,
                                                  int anchor_index_in_bytes)
 {
   CimGic* gic = CIM_GIC (context);
-  gic->surround.text = (char*) text;
-  gic->surround.len  = len;
-  gic->surround.cursor_pos = g_utf8_strlen (text, cursor_index_in_bytes);
-  gic->surround.anchor_pos = g_utf8_strlen (text, anchor_index_in_bytes);
+
+  if (gic->ic)
+    cim_ic_set_surround (gic->ic, text, len,
+                         cursor_index_in_bytes, anchor_index_in_bytes);
 }
 
 GtkIMContext* cim_gic_new ()
@@ -279,30 +385,85 @@ static gboolean cb_retrieve_surround (CimIc* unused, CimGic* gic)
   return retval;
 }
 
+/* The widget answers with set_surrounding, which hands the text to libcim. */
 static const CimSurround* cb_get_surround (CimIc* unused, CimGic* gic)
 {
   gboolean retval;
   g_signal_emit_by_name (gic, "retrieve-surrounding", &retval);
 
-  if (retval)
-    return &gic->surround;
-
   return NULL;
 }
 
-static void cim_gic_init (CimGic* gic)
+/* Widgets set input-purpose and input-hints on the IM context. */
+static void cim_gic_update_content_type (CimGic* gic)
+{
+  GtkInputPurpose purpose;
+  GtkInputHints   hints;
+  uint32_t        cim_hints = 0;
+
+  if (!gic->ic)
+    return;
+
+  g_object_get (gic, "input-purpose", &purpose, "input-hints", &hints, NULL);
+
+  if (purpose > (GtkInputPurpose) CIM_PURPOSE_TERMINAL)
+    purpose = GTK_INPUT_PURPOSE_FREE_FORM;
+
+  if (hints & GTK_INPUT_HINT_PRIVATE)
+    cim_hints |= CIM_HINT_PRIVATE;
+
+  if (hints & GTK_INPUT_HINT_NO_SPELLCHECK)
+    cim_hints |= CIM_HINT_NO_PREDICTION;
+
+  cim_ic_set_content_type (gic->ic, (CimPurpose) purpose, cim_hints);
+}
+
+static void on_notify_content_type (CimGic*     gic,
+                                    GParamSpec* unused,
+                                    gpointer    unused2)
 {
-  gic->ic     = cim_ic_new ();
-  gic->simple = gtk_im_context_simple_new ();
+  cim_gic_update_content_type (gic);
+}
+
+/*
+ * The IC is created on the first focus-in or key rather than in init, so
+ * the engine preload started by g_io_module_load() can run in the
+ * background while the application builds its widgets.
+ */
+static void cim_gic_create_ic (CimGic* gic)
+{
+  CimCallbacks callbacks = {
+    .commit          = (void*) cb_commit,
+    .get_surround    = (void*) cb_get_surround,
+    .delete_surround = (void*) cb_delete_surround
+  };
+
+  if (gic->use_preedit)
+  {
+    callbacks.preedit_start   = (void*) cb_preedit_start;
+    callbacks.preedit_end     = (void*) cb_preedit_end;
+    callbacks.preedit_delta   = (void*) cb_preedit_delta;
+  }
 
-  cim_ic_set_callback (gic->ic, CIM_CB_PREEDIT_START, cb_preedit_start, gic);
-  cim_ic_set_callback (gic->ic, CIM_CB_PREEDIT_END, cb_preedit_end, gic);
-  cim_ic_set_callback (gic->ic, CIM_CB_PREEDIT_CHANGED,
-                       cb_preedit_changed, gic);
-  cim_ic_set_callback (gic->ic, CIM_CB_COMMIT, cb_commit, gic);
-  cim_ic_set_callback (gic->ic, CIM_CB_GET_SURROUND, cb_get_surround, gic);
-  cim_ic_set_callback (gic->ic, CIM_CB_DELETE_SURROUND,
-                       cb_delete_surround, gic);
+  /* a new IC starts its preedit generations over */
+  if (gic->attrs)
+  {
+    pango_attr_list_unref (gic->attrs);
+    gic->attrs = NULL;
+  }
+
+  gic->delta_generation = 0;
+  gic->cursor_pos       = 0;
+
+  gic->ic = cim_ic_new ();
+  cim_ic_set_callbacks (gic->ic, &callbacks, gic);
+  cim_gic_update_content_type (gic);
+}
+
+static void cim_gic_init (CimGic* gic)
+{
+  gic->simple      = gtk_im_context_simple_new ();
+  gic->use_preedit = TRUE;
 
   g_signal_connect (gic->simple, "commit", G_CALLBACK (cb_commit), gic);
   g_signal_connect (gic->simple, "delete-surrounding",
@@ -315,17 +476,24 @@ static void cim_gic_init (CimGic* gic)
                     G_CALLBACK (cb_preedit_start), gic);
   g_signal_connect (gic->simple, "retrieve-surrounding",
                     G_CALLBACK (cb_retrieve_surround), gic);
-
-  cim_gic_set_use_preedit ((GtkIMContext*) gic, TRUE);
+  g_signal_connect (gic, "notify::input-purpose",
+                    G_CALLBACK (on_notify_content_type), NULL);
+  g_signal_connect (gic, "notify::input-hints",
+                    G_CALLBACK (on_notify_content_type), NULL);
 }
 
 static void cim_gic_finalize (GObject* object)
 {
   CimGic* gic = CIM_GIC (object);
 
-  cim_ic_free   (gic->ic);
+  if (gic->ic)
+    cim_ic_free (gic->ic);
+
   g_object_unref (gic->simple);
 
+  if (gic->attrs)
+    pango_attr_list_unref (gic->attrs);
+
   if (gic->client_widget)
     g_object_unref (gic->client_widget);
 
@@ -358,14 +526,33 @@ static void cim_gic_class_finalize (CimGicClass* class)
 
 void g_io_module_load (GIOModule* module)
 {
+  int fd;
+
   g_type_module_use (G_TYPE_MODULE (module));
   cim_gic_register_type (G_TYPE_MODULE (module));
   g_io_extension_point_implement (GTK_IM_MODULE_EXTENSION_POINT_NAME,
                                   cim_gic_get_type (), "cim", 10);
+  cim_preload ();
+
+  if ((fd = cim_get_async_fd ()) >= 0)
+  {
+    cim_async_source = g_unix_fd_source_new (fd, G_IO_IN);
+    g_source_set_callback (cim_async_source, (GSourceFunc) on_async_fd,
+                           NULL, NULL);
+    g_source_attach (cim_async_source, NULL);
+  }
 }
 
 void g_io_module_unload (GIOModule* module)
 {
+  if (cim_async_source)
+  {
+    g_source_destroy (cim_async_source);
+    g_source_unref (cim_async_source);
+    cim_async_source = NULL;
+  }
+
+  cim_finalize ();
 }
 
 char** g_io_module_query (void)
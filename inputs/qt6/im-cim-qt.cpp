@@ -18,11 +18,16 @@
  */
 #include <QTextFormat>
 #include <QInputMethodEvent>
+#include <QQueue>
+#include <QVarLengthArray>
+#include <QSocketNotifier>
 #include <QtGui/qpa/qplatforminputcontext.h>
 #include <QtGui/qpa/qplatforminputcontextplugin_p.h>
+#include <QtGui/qpa/qwindowsysteminterface.h>
 #include <QtWidgets/QApplication>
 #include <QtWidgets/QWidget>
 #include "cim.h"
+#include <algorithm>
 
 class CimEventHandler : public QObject
 {
@@ -42,6 +47,21 @@ private:
   CimIc* m_ic;
 };
 
+/* a key waiting for the engine */
+struct CimQicKey
+{
+  QEvent::Type          type;
+  int                   key;
+  Qt::KeyboardModifiers modifiers;
+  quint32               native_scan_code;
+  quint32               native_virtual_key;
+  quint32               native_modifiers;
+  QString               text;
+  bool                  auto_repeat;
+  ushort                count;
+  ulong                 timestamp;
+};
+
 class CimQic : public QPlatformInputContext
 {
   Q_OBJECT
@@ -78,10 +98,18 @@ public:
                                   int    offset,
                                   int    n_chars,
                                   void*  user_data);
+  static void cb_event_done      (CimIc* ic,
+                                  const CimEvent* event,
+                                  bool   handled,
+                                  void*  user_data);
 private:
+  void        create_ic ();
+  void        update_content_type ();
+  void        forward_pending ();
+
   CimIc*      m_ic;
   CimRect     m_cursor_area;
-  CimSurround m_surround;
+  QQueue<CimQicKey> m_pending;
 };
 
 /* cim signal callbacks */
@@ -93,59 +121,72 @@ void CimQic::cb_preedit_end (CimIc* ic, void* user_data)
 {
 }
 
-void CimQic::cb_preedit_changed (CimIc*            ic,
-                                 const CimPreedit* preedit,
-                                 void*             user_data)
-{
-  int offset = 0;
-  int len;
-
-  QString preedit_text = QString::fromUtf8 (preedit->text);
+#define CIM_QIC_N_ATTR_TYPES 2
 
-  QList <QInputMethodEvent::Attribute> attrs;
+/* one shared format per combination of CimPreeditAttrType bits */
+static const QTextCharFormat& cim_qic_format (unsigned mask)
+{
+  static const QVector<QTextCharFormat> formats = [] {
+    QVector<QTextCharFormat> formats (1 << CIM_QIC_N_ATTR_TYPES);
 
-  /* qsizetype is signed */
-  for (qsizetype i = 0; i < preedit_text.size(); i++)
-  {
-    if (preedit_text.at(i).isLowSurrogate())
+    for (int i = 0; i < formats.size (); i++)
     {
-      offset++;
-      continue;
-    }
-
-    QTextCharFormat format;
+      if (i & (1 << CIM_PREEDIT_ATTR_UNDERLINE))
+        formats[i].setUnderlineStyle(QTextCharFormat::DashUnderline);
 
-    for (int j = 0; preedit->attrs_len < j; j++)
-    {
-      switch (preedit->attrs[j].type)
+      if (i & (1 << CIM_PREEDIT_ATTR_HIGHLIGHT))
       {
-        case CIM_PREEDIT_ATTR_HIGHLIGHT:
-          if (preedit->attrs[j].start_index <= i - offset &&
-              preedit->attrs[j].end_index   >  i - offset)
-          {
-            format.setBackground(Qt::green);
-            format.setForeground(Qt::black);
-          }
-          break;
-        case CIM_PREEDIT_ATTR_UNDERLINE:
-          if (preedit->attrs[j].start_index <= i - offset &&
-              preedit->attrs[j].end_index   >  i - offset)
-            format.setUnderlineStyle(QTextCharFormat::DashUnderline);
-          break;
-        default:
-          break;
+        formats[i].setBackground(Qt::green);
+        formats[i].setForeground(Qt::black);
       }
     }
 
-    preedit_text.at(i).isHighSurrogate() ? len = 2 : len = 1;
-    QInputMethodEvent::Attribute attr (QInputMethodEvent::TextFormat,
-                                       i, len, format);
-    attrs << attr;
+    return formats;
+  } ();
+
+  return formats[mask];
+}
+
+/* Emits one TextFormat attribute per run of characters with the same
+ * formatting, so overlapping attributes share one format. */
+static void cim_qic_add_formats (QList<QInputMethodEvent::Attribute>& attrs,
+                                 CimIc*         ic,
+                                 const CimText* text)
+{
+  const CimPreeditRun* runs;
+  int                  n_runs;
+
+  runs = cim_ic_get_preedit_runs (ic, &n_runs);
+
+  for (int i = 0; i < n_runs; i++)
+  {
+    unsigned mask  = runs[i].types & ((1u << CIM_QIC_N_ATTR_TYPES) - 1);
+    int      start = text->utf16_offsets[runs[i].start_index];
+    int      end   = text->utf16_offsets[runs[i].end_index];
+
+    if (mask)
+      attrs << QInputMethodEvent::Attribute (QInputMethodEvent::TextFormat,
+                                             start, end - start,
+                                             cim_qic_format (mask));
   }
+}
+
+void CimQic::cb_preedit_changed (CimIc*            ic,
+                                 const CimPreedit* preedit,
+                                 void*             user_data)
+{
+  const CimText* text = cim_ic_get_preedit_text (ic, true);
+  QString preedit_text = QString::fromUtf8 (text->text, text->len);
+
+  QList <QInputMethodEvent::Attribute> attrs;
+
+  cim_qic_add_formats (attrs, ic, text);
 
   // cursor attribute
+  int cursor_pos = qBound (0, preedit->cursor_pos, text->n_chars);
   attrs << QInputMethodEvent::Attribute (QInputMethodEvent::Cursor,
-                                         preedit->cursor_pos + offset, true, 0);
+                                         text->utf16_offsets[cursor_pos],
+                                         true, 0);
 
   QInputMethodEvent event (preedit_text, attrs);
   QObject* object = qApp->focusObject ();
@@ -156,7 +197,8 @@ void CimQic::cb_preedit_changed (CimIc*            ic,
 
 void CimQic::cb_commit (CimIc* ic, const char* text, void* user_data)
 {
-  QString str = QString::fromUtf8 (text);
+  const CimText* commit = cim_ic_get_commit_text (ic);
+  QString str = QString::fromUtf8 (text, commit ? commit->len : -1);
   QInputMethodEvent event;
   event.setCommitString (str);
 
@@ -166,6 +208,11 @@ void CimQic::cb_commit (CimIc* ic, const char* text, void* user_data)
     QCoreApplication::sendEvent (obj, &event);
 }
 
+/*
+ * Only the part libcim keeps is converted; a character takes one or two
+ * UTF-16 units.  The copy in libcim stays valid until update() says the
+ * widget has changed.
+ */
 const CimSurround* CimQic::cb_get_surround (CimIc* ic, void* user_data)
 {
   QObject* object = qApp->focusObject();
@@ -173,26 +220,41 @@ const CimSurround* CimQic::cb_get_surround (CimIc* ic, void* user_data)
   if (!object)
     return NULL;
 
-  CimQic* context = static_cast<CimQic*>(user_data);
+  QInputMethodQueryEvent query (Qt::ImSurroundingText |
+                                Qt::ImCursorPosition  |
+                                Qt::ImAnchorPosition);
+  QCoreApplication::sendEvent (object, &query);
+
+  QString text   = query.value (Qt::ImSurroundingText).toString ();
+  int     size   = text.size ();
+  int     cursor = qBound (0, query.value (Qt::ImCursorPosition).toInt (), size);
+  int     anchor = qBound (0, query.value (Qt::ImAnchorPosition).toInt (), size);
+  int     start  = qMax (0,    cursor - 2 * CIM_SURROUND_WINDOW);
+  int     end    = qMin (size, cursor + 2 * CIM_SURROUND_WINDOW);
 
-  QInputMethodQueryEvent surround_query (Qt::ImSurroundingText);
-  QInputMethodQueryEvent cursor_query   (Qt::ImCursorPosition);
-  QInputMethodQueryEvent anchor_query   (Qt::ImAnchorPosition);
+  if (start > 0 && text.at (start).isLowSurrogate ())
+    start++;
 
-  QCoreApplication::sendEvent (object, &surround_query);
-  QCoreApplication::sendEvent (object, &cursor_query);
-  QCoreApplication::sendEvent (object, &anchor_query);
+  if (end < size && text.at (end).isLowSurrogate ())
+    end--;
 
-  QString string  = surround_query.value (Qt::ImSurroundingText).toString();
-  uint cursor_pos = cursor_query.value   (Qt::ImCursorPosition).toUInt();
-  uint anchor_pos = cursor_query.value   (Qt::ImAnchorPosition).toUInt();
+  anchor = qBound (start, anchor, end);
 
-  context->m_surround.text = (char*) string.toUtf8().constData();
-  context->m_surround.len  = -1;
-  context->m_surround.cursor_pos = cursor_pos;
-  context->m_surround.anchor_pos = anchor_pos;
+  QByteArray before = text.mid (start,  cursor - start).toUtf8 ();
+  QByteArray after  = text.mid (cursor, end - cursor).toUtf8 ();
+  int anchor_index;
 
-  return &context->m_surround;
+  if (anchor <= cursor)
+    anchor_index = text.mid (start, anchor - start).toUtf8 ().size ();
+  else
+    anchor_index = before.size () +
+                   text.mid (cursor, anchor - cursor).toUtf8 ().size ();
+
+  QByteArray utf8 = before + after;
+  cim_ic_set_surround (ic, utf8.constData (), utf8.size (),
+                       before.size (), anchor_index);
+
+  return NULL;
 }
 
 bool CimQic::cb_delete_surround (CimIc* ic,
@@ -212,6 +274,56 @@ bool CimQic::cb_delete_surround (CimIc* ic,
   return true;
 }
 
+/* Delivers a key to the focused window, past the input context. */
+static void cim_qic_forward_key (const CimQicKey& key)
+{
+  QWindow* window = QGuiApplication::focusWindow ();
+
+  if (window)
+    QWindowSystemInterface::handleExtendedKeyEvent
+      <QWindowSystemInterface::SynchronousDelivery> (window,
+                                                     key.timestamp,
+                                                     key.type,
+                                                     key.key,
+                                                     key.modifiers,
+                                                     key.native_scan_code,
+                                                     key.native_virtual_key,
+                                                     key.native_modifiers,
+                                                     key.text,
+                                                     key.auto_repeat,
+                                                     key.count);
+}
+
+/*
+ * Answers arrive in the order the keys were filtered.  A key the engine
+ * did not handle is sent to the window the way the platform plugin would
+ * have, which does not pass it through filterEvent() again.  It is
+ * delivered synchronously, since libcim starts the keys typed after it when
+ * this returns.
+ */
+void CimQic::cb_event_done (CimIc*          ic,
+                            const CimEvent* event,
+                            bool            handled,
+                            void*           user_data)
+{
+  CimQic* context = static_cast<CimQic*>(user_data);
+
+  if (context->m_pending.isEmpty ())
+    return;
+
+  CimQicKey key = context->m_pending.dequeue ();
+
+  if (!handled)
+    cim_qic_forward_key (key);
+}
+
+/* Delivers the keys still waiting for the engine as not handled. */
+void CimQic::forward_pending ()
+{
+  while (!m_pending.isEmpty ())
+    cim_qic_forward_key (m_pending.dequeue ());
+}
+
 CimQic::CimQic ()
 {
   m_ic                  = NULL;
@@ -219,21 +331,17 @@ CimQic::CimQic ()
   m_cursor_area.y       = 0;
   m_cursor_area.width   = 0;
   m_cursor_area.height  = 0;
-  m_surround.text       = NULL;
-  m_surround.len        = 0;
-  m_surround.cursor_pos = 0;
 
-  m_ic = cim_ic_new ();
-  cim_ic_set_callback (m_ic, CIM_CB_PREEDIT_START,
-                       (void*) cb_preedit_start, this);
-  cim_ic_set_callback (m_ic, CIM_CB_PREEDIT_END, (void*) cb_preedit_end, this);
-  cim_ic_set_callback (m_ic, CIM_CB_PREEDIT_CHANGED,
-                       (void*) cb_preedit_changed, this);
-  cim_ic_set_callback (m_ic, CIM_CB_COMMIT, (void*) cb_commit, this);
-  cim_ic_set_callback (m_ic, CIM_CB_GET_SURROUND,
-                       (void*) cb_get_surround, this);
-  cim_ic_set_callback (m_ic, CIM_CB_DELETE_SURROUND,
-                       (void*) cb_delete_surround, this);
+  int fd = cim_get_async_fd ();
+
+  if (fd >= 0)
+  {
+    QSocketNotifier* notifier;
+
+    notifier = new QSocketNotifier (fd, QSocketNotifier::Read, this);
+    connect (notifier, &QSocketNotifier::activated, this,
+             [] () { cim_dispatch (); });
+  }
 }
 
 CimQic::~CimQic ()
@@ -242,26 +350,99 @@ CimQic::~CimQic ()
     cim_ic_free (m_ic);
 }
 
-bool CimQic::isValid () const
+/*
+ * The IC is created on the first focus-in rather than in the constructor,
+ * so the engine preload started by CimQicPlugin::create() can run in the
+ * background while the application starts up.
+ */
+void CimQic::create_ic ()
 {
-  if (m_ic == NULL)
-    return false;
+  CimCallbacks callbacks = {};
+
+  callbacks.preedit_start   = cb_preedit_start;
+  callbacks.preedit_end     = cb_preedit_end;
+  callbacks.preedit_changed = cb_preedit_changed;
+  callbacks.commit          = cb_commit;
+  callbacks.get_surround    = cb_get_surround;
+  callbacks.delete_surround = cb_delete_surround;
+  callbacks.event_done      = cb_event_done;
+
+  m_ic = cim_ic_new ();
+  cim_ic_set_callbacks (m_ic, &callbacks, this);
+}
+
+/*
+ * Maps the Qt::ImHints of the focus object; a QLineEdit in password mode
+ * sets ImhHiddenText, ImhSensitiveData and ImhNoPredictiveText.
+ */
+void CimQic::update_content_type ()
+{
+  QObject* object = qApp->focusObject ();
+
+  if (!object)
+    return;
+
+  QInputMethodQueryEvent query (Qt::ImHints);
+  QCoreApplication::sendEvent (object, &query);
+
+  Qt::InputMethodHints imh (query.value (Qt::ImHints).toInt ());
+  CimPurpose purpose = CIM_PURPOSE_FREE_FORM;
+  uint32_t   hints   = 0;
+
+  if (imh & Qt::ImhHiddenText)
+    purpose = imh & Qt::ImhDigitsOnly ? CIM_PURPOSE_PIN : CIM_PURPOSE_PASSWORD;
+  else if (imh & Qt::ImhDigitsOnly)
+    purpose = CIM_PURPOSE_DIGITS;
+  else if (imh & Qt::ImhFormattedNumbersOnly)
+    purpose = CIM_PURPOSE_NUMBER;
+  else if (imh & Qt::ImhDialableCharactersOnly)
+    purpose = CIM_PURPOSE_PHONE;
+  else if (imh & Qt::ImhEmailCharactersOnly)
+    purpose = CIM_PURPOSE_EMAIL;
+  else if (imh & Qt::ImhUrlCharactersOnly)
+    purpose = CIM_PURPOSE_URL;
+
+  if (imh & Qt::ImhNoPredictiveText)
+    hints |= CIM_HINT_NO_PREDICTION;
+
+  if (imh & Qt::ImhSensitiveData)
+    hints |= CIM_HINT_PRIVATE;
+
+  if (imh & (Qt::ImhPreferLatin | Qt::ImhLatinOnly))
+    hints |= CIM_HINT_LATIN;
+
+  cim_ic_set_content_type (m_ic, purpose, hints);
+}
 
+bool CimQic::isValid () const
+{
   return true;
 }
 
 void CimQic::reset ()
 {
-  cim_ic_reset (m_ic);
+  if (m_ic)
+    cim_ic_reset (m_ic);
 }
 
 void CimQic::commit ()
 {
-  cim_ic_reset (m_ic);
+  if (m_ic)
+    cim_ic_reset (m_ic);
 }
 
 void CimQic::update (Qt::InputMethodQueries queries)
 {
+  if (!m_ic)
+    return;
+
+  if (queries & (Qt::ImSurroundingText | Qt::ImCursorPosition |
+                 Qt::ImAnchorPosition))
+    cim_ic_invalidate_surround (m_ic);
+
+  if (queries & Qt::ImHints)
+    update_content_type ();
+
   if (queries & Qt::ImCursorRectangle)
   {
     QWidget* widget = qApp->focusWidget ();
@@ -294,10 +475,9 @@ void CimQic::invokeAction (QInputMethod::Action, int cursorPosition)
 
 bool CimQic::filterEvent (const QEvent* event)
 {
-  if (!qApp->focusObject() || !inputMethodAccepted())
+  if (!m_ic || !qApp->focusObject() || !inputMethodAccepted())
     return false;
 
-  bool  retval;
   const QKeyEvent* key_event = static_cast<const QKeyEvent*>(event);
   CimEvent cevent;
 
@@ -315,13 +495,33 @@ bool CimQic::filterEvent (const QEvent* event)
       return false;
   }
 
-  cevent.state   = key_event->nativeModifiers  ();
-  cevent.keyval  = key_event->nativeVirtualKey ();
-  cevent.keycode = key_event->nativeScanCode   ();
-
-  retval = cim_ic_filter_event (m_ic, &cevent);
+  cevent.state     = key_event->nativeModifiers  ();
+  cevent.keyval    = key_event->nativeVirtualKey ();
+  cevent.keycode   = key_event->nativeScanCode   ();
+  cevent.time      = key_event->timestamp ();
+  /* on X11 Qt also makes up a release before each repeat */
+  cevent.flags     = key_event->isAutoRepeat () ? CIM_EVENT_REPEAT : 0;
+  cevent.n_repeats = 0;
 
-  return retval;
+  switch (cim_ic_filter_event_async (m_ic, &cevent))
+  {
+    case CIM_FILTER_HANDLED:
+      return true;
+    case CIM_FILTER_PENDING:
+      m_pending.enqueue ({ event->type (),
+                           key_event->key (),
+                           key_event->modifiers (),
+                           key_event->nativeScanCode (),
+                           key_event->nativeVirtualKey (),
+                           key_event->nativeModifiers (),
+                           key_event->text (),
+                           key_event->isAutoRepeat (),
+                           (ushort) key_event->count (),
+                           (ulong) key_event->timestamp () });
+      return true;
+    default:
+      return false;
+  }
 }
 
 QRectF CimQic::keyboardRect() const
@@ -359,13 +559,28 @@ Qt::LayoutDirection CimQic::inputDirection() const
 
 void CimQic::setFocusObject (QObject* object)
 {
-  if (!object || !inputMethodAccepted())
+  if (m_ic && (!object || !inputMethodAccepted()))
     cim_ic_focus_out (m_ic);
 
   QPlatformInputContext::setFocusObject (object);
 
   if (object && inputMethodAccepted())
+  {
+    /* Move to a reloaded engine; Qt keeps one IC for the whole app. */
+    if (m_ic && !cim_ic_is_current (m_ic))
+    {
+      cim_ic_focus_out (m_ic);
+      forward_pending ();
+      cim_ic_free (m_ic);
+      m_ic = NULL;
+    }
+
+    if (!m_ic)
+      create_ic ();
+
+    update_content_type ();
     cim_ic_focus_in (m_ic);
+  }
 
   update (Qt::ImCursorRectangle);
 }
@@ -387,6 +602,7 @@ public:
 
   ~CimQicPlugin ()
   {
+    cim_finalize ();
   }
 
   virtual QStringList keys () const
@@ -397,6 +613,8 @@ public:
   virtual QPlatformInputContext* create (const QString     &key,
                                          const QStringList &paramList)
   {
+    cim_preload ();
+
     return new CimQic ();
   }
 };
@@ -0,0 +1,348 @@
+/* -*- Mode: C; indent-tabs-mode: nil; c-basic-offset: 2; tab-width: 2 -*- */
+/*
+ * c-array.c
+ * This file is part of Clair.
+ *
+ * Copyright (C) 2023 Hodong Kim <hodong@nimfsoft.art>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+#include "c-array.h"
+#include "c-mem.h"
+#include "c-str.h"
+#include "c-utf8.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct
+{
+  CArray     array;
+  unsigned   capa;
+  CFreeFunc  free_func;
+  bool       free_data;
+  void      *inline_data[C_ARRAY_N_INLINE];
+} CRealArray;
+
+/*
+ * Makes room for at least n elements, at least doubling the capacity.
+ * Data still in inline_data is copied to the heap.  Returns the new data.
+ */
+void *c_vec_grow (void     *data,
+                  void     *inline_data,
+                  unsigned *capa,
+                  unsigned  n,
+                  size_t    elem_size)
+{
+  unsigned new_capa = C_MAX (C_MAX (*capa * 2, n), 8);
+
+  if (data == inline_data)
+  {
+    data = memcpy (c_malloc (new_capa * elem_size), inline_data,
+                   *capa * elem_size);
+  }
+  else
+  {
+    data = c_realloc (data, new_capa * elem_size);
+  }
+
+  *capa = new_capa;
+
+  return data;
+}
+
+CArray *c_array_new (CFreeFunc free_func, bool free_data)
+{
+  return c_array_sized_new (free_func, free_data, 0);
+}
+
+/*
+ * Like c_array_new (), but with room for reserved elements.  If the array
+ * ends up with at most that many, including a NULL terminator, the data
+ * handed out by c_array_free () or c_array_free_strv () is the one
+ * allocation made here.
+ */
+CArray *c_array_sized_new (CFreeFunc free_func,
+                           bool      free_data,
+                           unsigned  reserved)
+{
+  CRealArray *real = c_malloc (sizeof (CRealArray));
+
+  real->array.len  = 0;
+  real->array.data = real->inline_data;
+  real->capa       = C_ARRAY_N_INLINE;
+  real->free_func  = free_func;
+  real->free_data  = free_data;
+
+  if (reserved > C_ARRAY_N_INLINE)
+  {
+    real->array.data = c_malloc (reserved * sizeof (void *));
+    real->capa       = reserved;
+  }
+
+  return &real->array;
+}
+
+/* Returns the data as a heap block of its own and frees the array. */
+static void **c_array_steal (CArray *array)
+{
+  CRealArray *real = (CRealArray *) array;
+  void      **data = array->data;
+
+  if (data == real->inline_data)
+    data = c_memdup (data, array->len * sizeof (void *));
+
+  free (real);
+
+  return data;
+}
+
+/*
+ * Frees the array.  Returns the data if the array was created with
+ * free_data false; the caller then owns it.  Otherwise the elements are
+ * freed with free_func and NULL is returned.
+ */
+void **c_array_free (CArray *array)
+{
+  CRealArray *real = (CRealArray *) array;
+
+  if (!array)
+    return NULL;
+
+  if (!real->free_data)
+    return c_array_steal (array);
+
+  c_array_clear (array);
+
+  if (array->data != real->inline_data)
+    free (array->data);
+
+  free (real);
+
+  return NULL;
+}
+
+/*
+ * Appends a NULL terminator, frees the array and returns the elements as
+ * a string vector for c_strv_free ().  The elements are not freed.
+ */
+char **c_array_free_strv (CArray *array)
+{
+  c_array_add (array, NULL);
+
+  return (char **) c_array_steal (array);
+}
+
+void c_array_clear (CArray *array)
+{
+  CRealArray *real = (CRealArray *) array;
+
+  if (real->free_func)
+    for (unsigned i = 0; i < array->len; i++)
+      real->free_func (array->data[i]);
+
+  array->len = 0;
+}
+
+void c_array_add (CArray *array, void *data)
+{
+  CRealArray *real = (CRealArray *) array;
+
+  if (array->len == real->capa)
+    array->data = c_vec_grow (array->data, real->inline_data, &real->capa,
+                              array->len + 1, sizeof (void *));
+
+  array->data[array->len++] = data;
+}
+
+bool c_array_remove_index (CArray *array, unsigned i)
+{
+  CRealArray *real = (CRealArray *) array;
+
+  if (i >= array->len)
+    return false;
+
+  if (real->free_func)
+    real->free_func (array->data[i]);
+
+  memmove (array->data + i, array->data + i + 1,
+           (array->len - i - 1) * sizeof (void *));
+  array->len--;
+
+  return true;
+}
+
+bool c_array_remove (CArray *array, void *data)
+{
+  for (unsigned i = 0; i < array->len; i++)
+    if (array->data[i] == data)
+      return c_array_remove_index (array, i);
+
+  return false;
+}
+
+void *c_array_index (CArray *array, unsigned i)
+{
+  return i < array->len ? array->data[i] : NULL;
+}
+
+/* compare receives pointers to the elements, as with qsort () */
+void c_array_sort (CArray *array, CCompareFunc compare)
+{
+  if (array->len > 1)
+    qsort (array->data, array->len, sizeof (void *), compare);
+}
+
+typedef struct
+{
+  uint64_t    prefix; /* the first eight key bytes, big-endian, zero padded */
+  const char *key;
+  void       *data;
+  bool        free_key;
+} CSortEntry;
+
+static int c_sort_entry_compare (const void *a, const void *b)
+{
+  const CSortEntry *x = a;
+  const CSortEntry *y = b;
+
+  if (x->prefix != y->prefix)
+    return x->prefix < y->prefix ? -1 : 1;
+
+  /* a zero byte in the prefix means both keys ended there */
+  if (!(x->prefix & 0xff))
+    return 0;
+
+  return strcmp (x->key + 8, y->key + 8);
+}
+
+#define C_SORT_RADIX_MIN 256
+
+/*
+ * Stable LSD radix sort on the prefixes, a byte per pass, skipping bytes
+ * all prefixes share; then runs of equal, unfinished prefixes are sorted
+ * on the rest of their keys.
+ */
+static void c_sort_entries_radix (CSortEntry *entries, unsigned n)
+{
+  CSortEntry *src = entries;
+  CSortEntry *dst = entries + n;
+  CSortEntry *tmp;
+  unsigned    counts[256];
+
+  for (int shift = 0; shift < 64; shift += 8)
+  {
+    unsigned sum = 0;
+
+    memset (counts, 0, sizeof counts);
+
+    for (unsigned i = 0; i < n; i++)
+      counts[src[i].prefix >> shift & 0xff]++;
+
+    if (counts[src[0].prefix >> shift & 0xff] == n)
+      continue;
+
+    for (unsigned b = 0; b < 256; b++)
+    {
+      unsigned count = counts[b];
+
+      counts[b] = sum;
+      sum += count;
+    }
+
+    for (unsigned i = 0; i < n; i++)
+      dst[counts[src[i].prefix >> shift & 0xff]++] = src[i];
+
+    tmp = src;
+    src = dst;
+    dst = tmp;
+  }
+
+  if (src != entries)
+    memcpy (entries, src, n * sizeof (CSortEntry));
+
+  for (unsigned i = 0, j; i < n; i = j)
+  {
+    for (j = i + 1; j < n && entries[j].prefix == entries[i].prefix; j++)
+      ;
+
+    if (j - i > 1 && entries[i].prefix & 0xff)
+      qsort (entries + i, j - i, sizeof (CSortEntry), c_sort_entry_compare);
+  }
+}
+
+/*
+ * Sorts like c_array_sort () with c_utf8_collate () on the text key_func
+ * returns for each element, but each text is looked at once.  Valid UTF-8
+ * is its own key, so only malformed texts are copied.
+ */
+void c_array_sort_by_key (CArray *array, CKeyFunc key_func)
+{
+  CSortEntry *entries;
+  unsigned    n = array->len;
+
+  if (n < 2)
+    return;
+
+  /* the second half is scratch space for the radix sort */
+  entries = c_malloc ((n < C_SORT_RADIX_MIN ? n : 2 * n) *
+                     sizeof (CSortEntry));
+
+  for (unsigned i = 0; i < n; i++)
+  {
+    const char *text = key_func (array->data[i]);
+    CSortEntry *entry = &entries[i];
+
+    entry->data     = array->data[i];
+    entry->free_key = !c_utf8_validate (text, strlen (text), NULL);
+    entry->key      = entry->free_key ? c_utf8_collate_key (text, NULL) : text;
+    entry->prefix   = 0;
+
+    for (int k = 0; k < 8 && entry->key[k]; k++)
+      entry->prefix |= (uint64_t) (uint8_t) entry->key[k] << (56 - 8 * k);
+  }
+
+  if (n < C_SORT_RADIX_MIN)
+    qsort (entries, n, sizeof (CSortEntry), c_sort_entry_compare);
+  else
+    c_sort_entries_radix (entries, n);
+
+  for (unsigned i = 0; i < n; i++)
+  {
+    array->data[i] = entries[i].data;
+
+    if (entries[i].free_key)
+      free ((char *) entries[i].key);
+  }
+
+  free (entries);
+}
+
+bool c_array_find (CArray     *array,
+                   const void *needle,
+                   CEqualFunc  equal_func,
+                   unsigned   *index)
+{
+  for (unsigned i = 0; i < array->len; i++)
+  {
+    if (equal_func ? equal_func (array->data[i], needle)
+                   : array->data[i] == needle)
+    {
+      if (index)
+        *index = i;
+
+      return true;
+    }
+  }
+
+  return false;
+}
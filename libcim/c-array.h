@@ -22,9 +22,14 @@
 #include "c-macros.h"
 #include "c-types.h"
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
 
 C_BEGIN_DECLS
 
+/* elements a CArray holds before its data moves to the heap */
+#define C_ARRAY_N_INLINE 8
+
 typedef struct _CArray CArray;
 struct _CArray {
   void     **data;
@@ -32,17 +37,69 @@ struct _CArray {
 };
 
 CArray *c_array_new          (CFreeFunc free_func, bool free_data);
+CArray *c_array_sized_new    (CFreeFunc free_func,
+                              bool      free_data,
+                              unsigned  reserved);
 void  **c_array_free         (CArray *array);
+char  **c_array_free_strv    (CArray *array);
 void    c_array_clear        (CArray *array);
 void    c_array_add          (CArray *array, void *data);
 bool    c_array_remove_index (CArray *array, unsigned i);
 bool    c_array_remove       (CArray *array, void *data);
 void   *c_array_index        (CArray *array, unsigned i);
 void    c_array_sort         (CArray *array, CCompareFunc compare);
+void    c_array_sort_by_key  (CArray *array, CKeyFunc key_func);
 bool    c_array_find         (CArray     *array,
                               const void *needle,
                               CEqualFunc  equal_func,
                               unsigned   *index);
+
+/*
+ * A growable array of elements of any type, with room for the first
+ * n_inline of them inside the vector itself:
+ *
+ *   C_VEC (struct pollfd, 16) pfds;
+ *
+ *   c_vec_init (&pfds);
+ *   c_vec_push (&pfds, ((struct pollfd) { fd, POLLIN, 0 }));
+ *   ...
+ *   c_vec_fini (&pfds);
+ */
+#define C_VEC(type, n_inline) \
+  struct { \
+    type     *data; \
+    unsigned  len; \
+    unsigned  capa; \
+    type      inline_data[n_inline]; \
+  }
+
+#define c_vec_init(vec) \
+  ((vec)->data = (vec)->inline_data, \
+   (vec)->len  = 0, \
+   (vec)->capa = C_N_ELEMENTS ((vec)->inline_data))
+
+#define c_vec_reserve(vec, n) \
+  ((n) > (vec)->capa ? \
+   (void) ((vec)->data = c_vec_grow ((vec)->data, (vec)->inline_data, \
+                                     &(vec)->capa, (n), \
+                                     sizeof *(vec)->data)) : \
+   (void) 0)
+
+#define c_vec_push(vec, value) \
+  (c_vec_reserve ((vec), (vec)->len + 1), \
+   (vec)->data[(vec)->len++] = (value))
+
+#define c_vec_clear(vec) ((vec)->len = 0)
+
+#define c_vec_fini(vec) \
+  ((vec)->data != (vec)->inline_data ? free ((vec)->data) : (void) 0)
+
+void *c_vec_grow (void     *data,
+                  void     *inline_data,
+                  unsigned *capa,
+                  unsigned  n,
+                  size_t    elem_size);
+
 C_END_DECLS
 
 #endif /* __C_ARRAY_H__ */
@@ -0,0 +1,258 @@
+/* -*- Mode: C; indent-tabs-mode: nil; c-basic-offset: 2; tab-width: 2 -*- */
+/*
+ * c-gap.c
+ * This file is part of Clair.
+ *
+ * Copyright (C) 2023 Hodong Kim <hodong@nimfsoft.art>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "c-gap.h"
+#include "c-mem.h"
+#include "c-str.h"
+#include "c-utf8.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define C_GAP_BUFFER_MIN_CAPA    64
+#define C_GAP_BUFFER_SHRINK_CAPA 256
+
+#define C_GAP_IS_CONT(c) (((c) & 0xc0) == 0x80)
+
+void c_gap_buffer_init (CGapBuffer *gb)
+{
+  *gb = (CGapBuffer) C_GAP_BUFFER_INIT;
+}
+
+void c_gap_buffer_fini (CGapBuffer *gb)
+{
+  free (gb->buf);
+  c_gap_buffer_init (gb);
+}
+
+size_t c_gap_buffer_get_len (const CGapBuffer *gb)
+{
+  return gb->capa - (gb->gap_end - gb->gap_start);
+}
+
+static char c_gap_buffer_at (const CGapBuffer *gb, size_t i)
+{
+  return i < gb->gap_start ? gb->buf[i]
+                           : gb->buf[i + gb->gap_end - gb->gap_start];
+}
+
+static void c_gap_buffer_move_gap (CGapBuffer *gb, size_t pos)
+{
+  size_t n;
+
+  if (pos < gb->gap_start)
+  {
+    n = gb->gap_start - pos;
+    memmove (gb->buf + gb->gap_end - n, gb->buf + pos, n);
+    gb->gap_start -= n;
+    gb->gap_end   -= n;
+  }
+  else if (pos > gb->gap_start)
+  {
+    n = pos - gb->gap_start;
+    memmove (gb->buf + gb->gap_start, gb->buf + gb->gap_end, n);
+    gb->gap_start += n;
+    gb->gap_end   += n;
+  }
+}
+
+static void c_gap_buffer_resize (CGapBuffer *gb, size_t capa)
+{
+  size_t tail = gb->capa - gb->gap_end;
+
+  if (capa > gb->capa)
+  {
+    gb->buf = c_realloc (gb->buf, capa);
+    memmove (gb->buf + capa - tail, gb->buf + gb->gap_end, tail);
+  }
+  else
+  {
+    memmove (gb->buf + capa - tail, gb->buf + gb->gap_end, tail);
+    gb->buf = c_realloc (gb->buf, capa);
+  }
+
+  gb->gap_end = capa - tail;
+  gb->capa    = capa;
+}
+
+/* one byte of the gap is always kept for the NUL of get_text */
+static void c_gap_buffer_reserve (CGapBuffer *gb, size_t len)
+{
+  size_t need = c_gap_buffer_get_len (gb) + len + 1;
+  size_t capa = gb->capa ? gb->capa : C_GAP_BUFFER_MIN_CAPA;
+
+  if (need <= gb->capa)
+    return;
+
+  while (capa < need)
+    capa *= 2;
+
+  c_gap_buffer_resize (gb, capa);
+}
+
+/*
+ * Give memory back only far below the growth point, and leave the buffer
+ * half full, so erasing and retyping around a size does not realloc.
+ */
+static void c_gap_buffer_maybe_shrink (CGapBuffer *gb)
+{
+  size_t need = c_gap_buffer_get_len (gb) + 1;
+  size_t capa = C_GAP_BUFFER_MIN_CAPA;
+
+  if (gb->capa <= C_GAP_BUFFER_SHRINK_CAPA || need * 8 >= gb->capa)
+    return;
+
+  while (capa < need * 2)
+    capa *= 2;
+
+  c_gap_buffer_resize (gb, capa);
+}
+
+void c_gap_buffer_clear (CGapBuffer *gb)
+{
+  gb->gap_start   = 0;
+  gb->gap_end     = gb->capa;
+  gb->cursor_byte = 0;
+  gb->cursor      = 0;
+  gb->n_chars     = 0;
+
+  c_gap_buffer_maybe_shrink (gb);
+}
+
+void c_gap_buffer_move_cursor (CGapBuffer *gb, ssize_t n_chars)
+{
+  size_t len = c_gap_buffer_get_len (gb);
+
+  for (; n_chars > 0 && gb->cursor_byte < len; n_chars--)
+  {
+    do
+      gb->cursor_byte++;
+    while (gb->cursor_byte < len &&
+           C_GAP_IS_CONT (c_gap_buffer_at (gb, gb->cursor_byte)));
+
+    gb->cursor++;
+  }
+
+  for (; n_chars < 0 && gb->cursor_byte > 0; n_chars++)
+  {
+    do
+      gb->cursor_byte--;
+    while (gb->cursor_byte > 0 &&
+           C_GAP_IS_CONT (c_gap_buffer_at (gb, gb->cursor_byte)));
+
+    gb->cursor--;
+  }
+}
+
+void c_gap_buffer_set_cursor (CGapBuffer *gb, size_t pos)
+{
+  if (pos >= gb->n_chars)
+  {
+    gb->cursor_byte = c_gap_buffer_get_len (gb);
+    gb->cursor      = gb->n_chars;
+  }
+  else if (pos == 0)
+  {
+    gb->cursor_byte = 0;
+    gb->cursor      = 0;
+  }
+  else
+  {
+    c_gap_buffer_move_cursor (gb, (ssize_t) pos - (ssize_t) gb->cursor);
+  }
+}
+
+void c_gap_buffer_insert (CGapBuffer *gb, const char *utf8, ssize_t len)
+{
+  size_t n_chars;
+
+  if (len < 0)
+    len = strlen (utf8);
+
+  if (len == 0)
+    return;
+
+  c_gap_buffer_reserve (gb, len);
+  c_gap_buffer_move_gap (gb, gb->cursor_byte);
+  memcpy (gb->buf + gb->gap_start, utf8, len);
+
+  n_chars = c_utf8_count (utf8, len, NULL);
+
+  gb->gap_start   += len;
+  gb->cursor_byte += len;
+  gb->cursor      += n_chars;
+  gb->n_chars     += n_chars;
+}
+
+void c_gap_buffer_insert_c (CGapBuffer *gb, char32_t c)
+{
+  char buf[8];
+
+  c_gap_buffer_insert (gb, buf, c_char32_to_utf8_with_buf (c, buf));
+}
+
+/* Deletes after the cursor if n_chars > 0, before it if n_chars < 0. */
+size_t c_gap_buffer_delete (CGapBuffer *gb, ssize_t n_chars)
+{
+  size_t n_deleted = 0;
+
+  if (n_chars == 0 || !gb->buf)
+    return 0;
+
+  c_gap_buffer_move_gap (gb, gb->cursor_byte);
+
+  for (; n_chars > 0 && gb->gap_end < gb->capa; n_chars--, n_deleted++)
+  {
+    do
+      gb->gap_end++;
+    while (gb->gap_end < gb->capa && C_GAP_IS_CONT (gb->buf[gb->gap_end]));
+  }
+
+  for (; n_chars < 0 && gb->gap_start > 0; n_chars++, n_deleted++)
+  {
+    do
+      gb->gap_start--;
+    while (gb->gap_start > 0 && C_GAP_IS_CONT (gb->buf[gb->gap_start]));
+
+    gb->cursor--;
+  }
+
+  gb->cursor_byte  = gb->gap_start;
+  gb->n_chars     -= n_deleted;
+
+  c_gap_buffer_maybe_shrink (gb);
+
+  return n_deleted;
+}
+
+const char *c_gap_buffer_get_text (CGapBuffer *gb, int *cursor_pos)
+{
+  size_t len;
+
+  if (cursor_pos)
+    *cursor_pos = gb->cursor;
+
+  if (!gb->buf)
+    return "";
+
+  len = c_gap_buffer_get_len (gb);
+  c_gap_buffer_move_gap (gb, len);
+  gb->buf[len] = 0;
+
+  return gb->buf;
+}
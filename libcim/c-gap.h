@@ -0,0 +1,67 @@
+/* -*- Mode: C; indent-tabs-mode: nil; c-basic-offset: 2; tab-width: 2 -*- */
+/*
+ * c-gap.h
+ * This file is part of Clair.
+ *
+ * Copyright (C) 2023 Hodong Kim <hodong@nimfsoft.art>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+#ifndef __C_GAP_H__
+#define __C_GAP_H__
+
+#include "c-macros.h"
+#include <stddef.h>
+#include <sys/types.h>
+#include <uchar.h>
+
+C_BEGIN_DECLS
+
+/*
+ * UTF-8 text with a cursor, for editing a preedit.  The free space sits at
+ * the last edit, so typing and erasing at the cursor are amortized O(1).
+ * Positions are in characters; the byte fields are private.
+ */
+typedef struct _CGapBuffer CGapBuffer;
+struct _CGapBuffer {
+  char   *buf;
+  size_t  capa;
+  size_t  gap_start;
+  size_t  gap_end;
+  size_t  cursor_byte;
+  size_t  cursor;
+  size_t  n_chars;
+};
+
+#define C_GAP_BUFFER_INIT { NULL, 0, 0, 0, 0, 0, 0 }
+
+void        c_gap_buffer_init       (CGapBuffer *gb);
+void        c_gap_buffer_fini       (CGapBuffer *gb);
+void        c_gap_buffer_clear      (CGapBuffer *gb);
+size_t      c_gap_buffer_get_len    (const CGapBuffer *gb);
+void        c_gap_buffer_set_cursor (CGapBuffer *gb, size_t pos);
+void        c_gap_buffer_move_cursor (CGapBuffer *gb, ssize_t n_chars);
+void        c_gap_buffer_insert     (CGapBuffer *gb,
+                                     const char *utf8,
+                                     ssize_t     len);
+void        c_gap_buffer_insert_c   (CGapBuffer *gb, char32_t c);
+size_t      c_gap_buffer_delete     (CGapBuffer *gb, ssize_t n_chars);
+/*
+ * Closes the gap and returns the text in place, NUL-terminated, with the
+ * cursor in characters; fit for CimPreedit text and cursor_pos.  The text
+ * is valid until the next call that changes the buffer.
+ */
+const char *c_gap_buffer_get_text   (CGapBuffer *gb, int *cursor_pos);
+
+C_END_DECLS
+
+#endif /* __C_GAP_H__ */
@@ -20,6 +20,7 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <stdalign.h>
 
 void* c_malloc (size_t size)
 {
@@ -37,7 +38,7 @@ void* c_malloc (size_t size)
 
 void* c_calloc (size_t number, size_t size)
 {
-  if (!(number * size))
+  if (!number || !size)
     return NULL;
 
   void* mem = calloc (number, size);
@@ -109,3 +110,158 @@ void c_ref_dec (CRef *ref)
     free (ref);
   }
 }
+
+struct _CArenaChunk
+{
+  CArenaChunk *next;
+  size_t       size; /* of the data after the header */
+};
+
+#define C_ARENA_ALIGN       alignof (max_align_t)
+#define C_ARENA_ROUND(n)    (((n) + C_ARENA_ALIGN - 1) & ~(C_ARENA_ALIGN - 1))
+#define C_ARENA_HEADER      C_ARENA_ROUND (sizeof (CArenaChunk))
+#define C_ARENA_DATA(chunk) ((uint8_t *) (chunk) + C_ARENA_HEADER)
+#define C_ARENA_MIN_SIZE    (4096 - C_ARENA_HEADER)
+#define C_ARENA_MAX_SIZE    (64 * 1024)
+
+static void c_arena_use (CArena *arena, CArenaChunk *chunk)
+{
+  arena->chunk = chunk;
+  arena->ptr   = chunk ? C_ARENA_DATA (chunk) : NULL;
+  arena->end   = chunk ? arena->ptr + chunk->size : NULL;
+}
+
+/*
+ * seed may be NULL.  Otherwise the first seed_size bytes of it serve as the
+ * first chunk until c_arena_clear().
+ */
+void c_arena_init (CArena *arena, void *seed, size_t seed_size)
+{
+  uintptr_t start = C_ARENA_ROUND ((uintptr_t) seed);
+  uintptr_t end   = (uintptr_t) seed + seed_size;
+
+  arena->first  = NULL;
+  arena->seeded = false;
+
+  if (seed && end > start && end - start >= C_ARENA_HEADER + C_ARENA_ALIGN)
+  {
+    arena->first       = (CArenaChunk *) start;
+    arena->first->next = NULL;
+    arena->first->size = (end - start - C_ARENA_HEADER) & ~(C_ARENA_ALIGN - 1);
+    arena->seeded      = true;
+  }
+
+  c_arena_use (arena, arena->first);
+}
+
+/*
+ * Moves on to the next chunk, or puts a new one after the current chunk
+ * if the next one is too small.  Chunks double in size up to
+ * C_ARENA_MAX_SIZE, or are as large as a larger request.
+ */
+static void *c_arena_alloc_slow (CArena *arena, size_t size)
+{
+  CArenaChunk *next = arena->chunk ? arena->chunk->next : arena->first;
+  void        *mem;
+
+  if (!next || next->size < size)
+  {
+    size_t chunk_size = C_ARENA_MIN_SIZE;
+
+    if (arena->chunk)
+      chunk_size = C_MIN (arena->chunk->size * 2, C_ARENA_MAX_SIZE);
+
+    chunk_size = C_MAX (chunk_size, size);
+    next = c_malloc (C_ARENA_HEADER + chunk_size);
+    next->size = chunk_size;
+
+    if (arena->chunk)
+    {
+      next->next = arena->chunk->next;
+      arena->chunk->next = next;
+    }
+    else
+    {
+      next->next = arena->first;
+      arena->first = next;
+    }
+  }
+
+  c_arena_use (arena, next);
+
+  mem = arena->ptr;
+  arena->ptr += size;
+
+  return mem;
+}
+
+/* Returns memory aligned for any type, or NULL if size is 0. */
+void *c_arena_alloc (CArena *arena, size_t size)
+{
+  void *mem;
+
+  if (!size)
+    return NULL;
+
+  size = C_ARENA_ROUND (size);
+
+  if (size > (size_t) (arena->end - arena->ptr))
+    return c_arena_alloc_slow (arena, size);
+
+  mem = arena->ptr;
+  arena->ptr += size;
+
+  return mem;
+}
+
+void *c_arena_memdup (CArena *arena, const void *src, size_t size)
+{
+  if (!size)
+    return NULL;
+
+  return memcpy (c_arena_alloc (arena, size), src, size);
+}
+
+/* Copies at most len bytes of str and NUL-terminates the copy. */
+char *c_arena_strndup (CArena *arena, const char *str, size_t len)
+{
+  char *dst;
+
+  len = strnlen (str, len);
+  dst = c_arena_alloc (arena, len + 1);
+  memcpy (dst, str, len);
+  dst[len] = 0;
+
+  return dst;
+}
+
+/* Frees every allocation at once.  The chunks are kept for reuse. */
+void c_arena_reset (CArena *arena)
+{
+  c_arena_use (arena, arena->first);
+}
+
+/* Frees the chunks; the seed, if any, becomes the only chunk again. */
+void c_arena_clear (CArena *arena)
+{
+  CArenaChunk *chunk = arena->first;
+  CArenaChunk *next;
+
+  if (arena->seeded)
+  {
+    chunk = chunk->next;
+    arena->first->next = NULL;
+  }
+  else
+  {
+    arena->first = NULL;
+  }
+
+  for (; chunk; chunk = next)
+  {
+    next = chunk->next;
+    free (chunk);
+  }
+
+  c_arena_use (arena, arena->first);
+}
@@ -22,6 +22,7 @@
 #include <stddef.h>
 #include "c-macros.h"
 #include <stdint.h>
+#include <stdbool.h>
 #include "c-types.h"
 
 C_BEGIN_DECLS
@@ -41,6 +42,30 @@ void *c_calloc  (size_t number, size_t size);
 void *c_realloc (void *ptr, size_t size);
 void *c_memdup  (const void *src, size_t size);
 
+/*
+ * A region allocator.  Allocations are bumped out of chunks and are all
+ * given back at once by c_arena_reset(), which keeps the chunks for reuse.
+ * The first chunk may be caller memory, for example a stack buffer, so
+ * that small regions never reach malloc().
+ */
+typedef struct _CArenaChunk CArenaChunk;
+
+typedef struct _CArena CArena;
+struct _CArena {
+  CArenaChunk *first;
+  CArenaChunk *chunk; /* being filled */
+  uint8_t     *ptr;
+  uint8_t     *end;
+  bool         seeded; /* first is caller memory */
+};
+
+void  c_arena_init    (CArena *arena, void *seed, size_t seed_size);
+void *c_arena_alloc   (CArena *arena, size_t size);
+void *c_arena_memdup  (CArena *arena, const void *src, size_t size);
+char *c_arena_strndup (CArena *arena, const char *str, size_t len);
+void  c_arena_reset   (CArena *arena);
+void  c_arena_clear   (CArena *arena);
+
 C_END_DECLS
 
 #endif /* __C_MEM_H__ */
@@ -20,13 +20,16 @@
 #include "c-mem.h"
 #include "c-array.h"
 #include "c-log.h"
+#include "c-utf8.h"
 #include <string.h>
+#include <stdint.h>
 #include <stdarg.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <ctype.h>
 
 #define C_STRING_DEFAULT_CAPA  16
+#define C_STRING_SHRINK_CAPA   256
 
 char *c_str_strip (const char *str)
 {
@@ -181,24 +184,19 @@ bool c_str_ends_with (const char *str, const char *suffix)
 
 char *c_strdup (const char *str)
 {
-  void *mem = strdup (str);
-
-  if (mem)
-    return mem;
-
-  perror (__PRETTY_FUNCTION__);
-  abort ();
+  return c_memdup (str, strlen (str) + 1);
 }
 
 char *c_strndup (const char *str, size_t len)
 {
-  void *mem = strndup (str, len);
+  char *mem;
 
-  if (mem)
-    return mem;
+  len = strnlen (str, len);
+  mem = c_malloc (len + 1);
+  memcpy (mem, str, len);
+  mem[len] = 0;
 
-  perror (__PRETTY_FUNCTION__);
-  abort ();
+  return mem;
 }
 
 char **c_str_split (const char *str, char c)
@@ -206,8 +204,12 @@ char **c_str_split (const char *str, char c)
   CArray *array;
   const char *p;
   const char *mark;
+  unsigned n = 2; /* the last piece and the NULL terminator */
+
+  for (p = str; (p = strchr (p, c)); p++)
+    n++;
 
-  array = c_array_new (NULL, false);
+  array = c_array_sized_new (NULL, false, n);
   p = str;
 
   while (1)
@@ -226,9 +228,7 @@ char **c_str_split (const char *str, char c)
     }
   }
 
-  c_array_add (array, NULL);
-
-  return (char **) c_array_free (array);
+  return c_array_free_strv (array);
 }
 
 static char* c_str_resize_capa (char* str, size_t* capa, size_t req_len)
@@ -295,14 +295,12 @@ char **c_strv_dup (char **strv)
   if (strv == NULL)
     return NULL;
 
-  CArray *array = c_array_new (NULL, false);
+  CArray *array = c_array_sized_new (NULL, false, c_strv_len (strv) + 1);
 
   for (int i = 0; strv[i]; i++)
     c_array_add (array, c_strdup (strv[i]));
 
-  c_array_add (array, NULL);
-
-  return (char **) c_array_free (array);
+  return c_array_free_strv (array);
 }
 
 void c_strv_free (char **strv)
@@ -349,33 +347,12 @@ char* c_strv_join (const char** strv, const char* separator)
 
 size_t c_utf8_strlen (const char *utf8)
 {
-  size_t len = 0;
-
-  while (*utf8)
-  {
-    if ((*utf8 & 0b11000000) != 0b10000000)
-      len++;
-
-    utf8++;
-  }
-
-  return len;
+  return c_utf8_count (utf8, strlen (utf8), NULL);
 }
 
 size_t c_utf8_strnlen (const char *utf8, size_t max_n_bytes)
 {
-  size_t len = 0;
-  const char *p = utf8;
-
-  while (*p && p - utf8 < max_n_bytes)
-  {
-    if ((*p & 0b11000000) != 0b10000000)
-      len++;
-
-    p++;
-  }
-
-  return len;
+  return c_utf8_count (utf8, strnlen (utf8, max_n_bytes), NULL);
 }
 
 void c_utf8_strncpy (char * restrict dst,
@@ -432,6 +409,21 @@ char *c_utf8_next_char (const char *utf8)
 
 char *c_utf8_offset_to_pointer (const char *utf8, size_t offset_in_chars)
 {
+  size_t len;
+  size_t n_chars;
+
+  /* Well-formed characters take at most 4 bytes each.  Blocks of 64 bytes
+   * that end before the character are skipped in one go. */
+  len = strnlen (utf8, C_MIN (offset_in_chars, SIZE_MAX / 4 - 1) * 4 + 1);
+
+  while (len > 64 &&
+         (n_chars = c_utf8_count (utf8 + 1, 64, NULL)) < offset_in_chars)
+  {
+    utf8            += 64;
+    len             -= 64;
+    offset_in_chars -= n_chars;
+  }
+
   while (*utf8 && offset_in_chars > 0)
   {
     utf8++;
@@ -442,52 +434,31 @@ char *c_utf8_offset_to_pointer (const char *utf8, size_t offset_in_chars)
   return (char *) utf8;
 }
 
+/*
+ * Returns the characters of utf8 in a buffer of the exact size, terminated
+ * by 0.  Bytes that do not start a well-formed character become U+FFFD.
+ */
 char32_t *c_utf8_to_char32 (const char *utf8)
 {
   if (!utf8)
     return NULL;
 
-  size_t len  = 0;
-  size_t capa = 8;
-  char32_t *c32 = c_malloc (capa * sizeof (char32_t));
+  size_t    len     = strlen (utf8);
+  size_t    n_chars = c_utf8_count (utf8, len, NULL);
+  size_t    n_c32;
+  char32_t *c32;
 
-  while (*utf8)
-  {
-    if (capa < len + 5)
-    {
-      capa *= 2;
-      c32 = c_realloc (c32, capa * sizeof (char32_t));
-    }
+  /* one character per leading byte, unless the text is malformed */
+  c32   = c_malloc ((n_chars + 1) * sizeof (char32_t));
+  n_c32 = c_utf8_decode (utf8, len, c32, n_chars);
 
-    if ((*utf8 & 0b10000000) == 0)
-    {
-      c32[len++] = *utf8++;
-    }
-    else
-    {
-      if ((*utf8 & 0b11110000) == 0b11110000)
-      {
-        c32[len]    = (*utf8++ & 0b00000111) << 18;
-        c32[len]   |= (*utf8++ & 0b00111111) << 12;
-        c32[len]   |= (*utf8++ & 0b00111111) << 6;
-        c32[len++] |= (*utf8++ & 0b00111111);
-      }
-      else if ((*utf8 & 0b11100000) == 0b11100000)
-      {
-        c32[len]    = (*utf8++ & 0b00001111) << 12;
-        c32[len]   |= (*utf8++ & 0b00111111) << 6;
-        c32[len++] |= (*utf8++ & 0b00111111);
-      }
-      else if ((*utf8 & 0b11000000) == 0b11000000)
-      {
-        c32[len]    = (*utf8++ & 0b00011111) << 6;
-        c32[len++] |= (*utf8++ & 0b00111111);
-      }
-    }
+  if (n_c32 > n_chars)
+  {
+    c32 = c_realloc (c32, (n_c32 + 1) * sizeof (char32_t));
+    c_utf8_decode (utf8, len, c32, n_c32);
   }
 
-  c32 = c_realloc (c32, (len + 1) * sizeof (char32_t));
-  c32[len] = 0;
+  c32[n_c32] = 0;
 
   return c32;
 }
@@ -508,17 +479,46 @@ int c_char32_strcmp (const char32_t * restrict a, const char32_t * restrict b)
 
 int c_utf8_collate (const char * restrict s1, const char * restrict s2)
 {
-  char32_t *a, *b;
+  return c_utf8_strcmp (s1, s2);
+}
+
+/*
+ * Returns a key that strcmp () orders the way c_utf8_collate () orders the
+ * texts: the text itself, with malformed bytes replaced by U+FFFD.
+ */
+char *c_utf8_collate_key (const char *utf8, size_t *len)
+{
+  size_t  n = strlen (utf8);
+  size_t  valid;
+  size_t  i = 0;
+  char   *key;
+
+  if (c_utf8_validate (utf8, n, &valid))
+  {
+    if (len)
+      *len = n;
+
+    return c_memdup (utf8, n + 1);
+  }
 
-  a = c_utf8_to_char32 (s1);
-  b = c_utf8_to_char32 (s2);
+  /* each malformed byte grows to three */
+  key = c_malloc (n * 3 + 1);
 
-  int retval = c_char32_strcmp (a, b);
+  do
+  {
+    memcpy (key + i, utf8, valid);
+    memcpy (key + i + valid, "\xef\xbf\xbd", 3);
+    i    += valid + 3;
+    utf8 += valid + 1;
+    n    -= valid + 1;
+  } while (!c_utf8_validate (utf8, n, &valid));
 
-  free (a);
-  free (b);
+  memcpy (key + i, utf8, n + 1);
 
-  return retval;
+  if (len)
+    *len = i + n;
+
+  return key;
 }
 
 int c_char32_to_utf8_with_buf (char32_t char32, char *utf8)
@@ -592,11 +592,8 @@ CString *c_string_new (const char *str, bool free_str)
 {
   CString *string = c_malloc (sizeof (CString));
 
-  string->capa     = C_STRING_DEFAULT_CAPA;
-  string->str      = c_malloc (string->capa);
-  string->len      = 0;
+  c_string_init (string);
   string->free_str = free_str;
-
   c_string_assign (string, str);
 
   return string;
@@ -607,34 +604,76 @@ char *c_string_free (CString *string)
   if (!string)
     return NULL;
 
-  char *str;
-
-  string->str = c_realloc (string->str, string->len + 1);
-  str = string->str;
+  char *str = NULL;
 
   if (string->free_str)
-  {
-    free (str);
-    str = NULL;
-  }
+    c_string_fini (string);
+  else if (string->str == string->inline_str)
+    str = c_strndup (string->str, string->len);
+  else
+    str = c_realloc (string->str, string->len + 1);
 
   free (string);
 
   return str;
 }
 
+void c_string_init (CString *string)
+{
+  *string = (CString) C_STRING_INIT (*string);
+}
+
+void c_string_fini (CString *string)
+{
+  if (string->str != string->inline_str)
+    free (string->str);
+
+  c_string_init (string);
+}
+
 static void c_string_resize_capa (CString *string, size_t req_len)
 {
-  size_t old_capa = string->capa;
+  size_t capa      = string->capa;
+  bool   is_inline = string->str == string->inline_str;
 
-  while (req_len > string->capa)
-    string->capa *= 2;
+  while (req_len > capa)
+    capa *= 2;
 
-  while (req_len + C_STRING_DEFAULT_CAPA < string->capa / 4)
-    string->capa = string->capa / 2;
+  /*
+   * Shrink only well below the growth point, and then to twice the need, so
+   * erasing and retyping around a boundary does not realloc every time.
+   */
+  if (!is_inline && req_len * 8 < capa && capa > C_STRING_SHRINK_CAPA)
+  {
+    if (req_len <= C_STRING_N_INLINE)
+    {
+      memcpy (string->inline_str, string->str, req_len);
+      free (string->str);
+      string->str  = string->inline_str;
+      string->capa = C_STRING_N_INLINE;
+      return;
+    }
 
-  if (string->capa != old_capa)
-    string->str = c_realloc (string->str, string->capa);
+    capa = C_STRING_DEFAULT_CAPA;
+
+    while (capa < req_len * 2)
+      capa *= 2;
+  }
+
+  if (capa == string->capa)
+    return;
+
+  if (is_inline)
+  {
+    string->str = c_malloc (capa);
+    memcpy (string->str, string->inline_str, C_STRING_N_INLINE);
+  }
+  else
+  {
+    string->str = c_realloc (string->str, capa);
+  }
+
+  string->capa = capa;
 }
 
 void c_string_append (CString *string, const char *str)
@@ -666,18 +705,10 @@ void c_string_assign (CString *string, const char *str)
 
 void c_string_insert_c (CString *string, ssize_t pos, char c)
 {
-  /* save */
-  uint8_t *save = c_malloc (string->len - pos);
-  memcpy (save, string->str + pos, string->len - pos);
-  /* realloc */
+  c_string_resize_capa (string, string->len + 2);
+  memmove (string->str + pos + 1, string->str + pos, string->len - pos + 1);
+  string->str[pos] = c;
   string->len += 1;
-  c_string_resize_capa (string, string->len + 1);
-  /* copy */
-  memcpy (string->str + pos, &c, 1);
-  memcpy (string->str + pos + 1, save, string->len - 1 - pos);
-  string->str[string->len] = 0;
-
-  free (save);
 }
 
 void c_string_erase (CString *string, ssize_t pos, ssize_t len)
@@ -709,19 +740,15 @@ void c_string_erase (CString *string, ssize_t pos, ssize_t len)
 
 void c_string_insert (CString *string, ssize_t pos, const char *str)
 {
-  /* save */
-  uint8_t *save = c_malloc (string->len - pos);
-  memcpy (save, string->str + pos, string->len - pos);
-  /* realloc */
   size_t len = strlen (str);
-  string->len += len;
-  c_string_resize_capa (string, string->len + 1);
-  /* copy */
-  memcpy (string->str + pos, str, len);
-  memcpy (string->str + pos + len, save, string->len - len - pos);
-  string->str[string->len] = 0;
 
-  free (save);
+  if (len == 0)
+    return;
+
+  c_string_resize_capa (string, string->len + len + 1);
+  memmove (string->str + pos + len, string->str + pos, string->len - pos + 1);
+  memcpy (string->str + pos, str, len);
+  string->len += len;
 }
 
 void c_string_overwrite (CString *string, size_t pos, const char *str)
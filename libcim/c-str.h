@@ -65,17 +65,35 @@ int       c_char32_to_utf8_with_buf (char32_t char32, char *utf8);
 char32_t *c_utf8_to_char32  (const char *utf8);
 int       c_utf8_collate    (const char * restrict s1,
                              const char * restrict s2);
+char     *c_utf8_collate_key (const char *utf8, size_t *len);
 
+/* bytes, with the NUL, a CString holds before its text moves to the heap */
+#define C_STRING_N_INLINE 24
+
+/*
+ * Short text lives in the CString itself, so str may point into the
+ * struct; a CString must not be copied or moved by value.  On the stack:
+ *
+ *   CString string = C_STRING_INIT (string);
+ *   ...
+ *   c_string_fini (&string);
+ */
 typedef struct _CString  CString;
 struct _CString {
   char   *str;
   size_t  len;
   size_t  capa;
   bool    free_str;
+  char    inline_str[C_STRING_N_INLINE];
 };
 
+#define C_STRING_INIT(string) \
+  { (string).inline_str, 0, C_STRING_N_INLINE, false, { 0 } }
+
 CString *c_string_new       (const char *str, bool free_str);
 char    *c_string_free      (CString *string);
+void     c_string_init      (CString *string);
+void     c_string_fini      (CString *string);
 void     c_string_append    (CString *string, const char *str);
 void     c_string_append_c  (CString *string, char c);
 void     c_string_assign    (CString *string, const char *str);
@@ -0,0 +1,712 @@
+/* -*- Mode: C; indent-tabs-mode: nil; c-basic-offset: 2; tab-width: 2 -*- */
+/*
+ * c-utf8.c
+ * This file is part of Clair.
+ *
+ * Copyright (C) 2023 Hodong Kim <hodong@nimfsoft.art>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+#include "c-utf8.h"
+#include <stdint.h>
+#include <string.h>
+
+#if defined (__x86_64__) || defined (__i386__)
+#define C_UTF8_X86
+#include <immintrin.h>
+#endif
+
+/*
+ * The kernels.  count returns the number of bytes that start a character
+ * and adds the 4-byte leads to *n_four; ascii_len returns the length of
+ * the ASCII run at the start; widen copies ASCII bytes to char32_t;
+ * validate is c_utf8_validate ().
+ */
+typedef struct
+{
+  size_t (* count)     (const uint8_t *p, size_t len, size_t *n_four);
+  size_t (* ascii_len) (const uint8_t *p, size_t len);
+  void   (* widen)     (char32_t *dst, const uint8_t *p, size_t len);
+  bool   (* validate)  (const uint8_t *p, size_t len, size_t *valid_len);
+} CUtf8Kernels;
+
+#define C_UTF8_HIGH_BITS 0x8080808080808080ull
+
+static uint64_t c_utf8_load64 (const uint8_t *p)
+{
+  uint64_t word;
+
+  memcpy (&word, p, sizeof word);
+
+  return word;
+}
+
+/*
+ * Decodes one character of at most len bytes.  Returns its length, or 0
+ * if the bytes are not well-formed UTF-8: overlong forms, surrogates and
+ * values above U+10FFFF are rejected.
+ */
+static inline int c_utf8_decode_one (const uint8_t *p,
+                                     size_t         len,
+                                     char32_t      *c32)
+{
+  uint8_t c = p[0];
+
+  if (c < 0x80)
+  {
+    *c32 = c;
+    return 1;
+  }
+
+  if (c < 0xe0)
+  {
+    if (c < 0xc2 || len < 2 || (p[1] & 0xc0) != 0x80)
+      return 0;
+
+    *c32 = (c & 0x1f) << 6 | (p[1] & 0x3f);
+    return 2;
+  }
+
+  if (c < 0xf0)
+  {
+    if (len < 3 || (p[1] & 0xc0) != 0x80 || (p[2] & 0xc0) != 0x80 ||
+        (c == 0xe0 && p[1] < 0xa0) || (c == 0xed && p[1] > 0x9f))
+      return 0;
+
+    *c32 = (c & 0x0f) << 12 | (p[1] & 0x3f) << 6 | (p[2] & 0x3f);
+    return 3;
+  }
+
+  if (c > 0xf4 || len < 4 || (p[1] & 0xc0) != 0x80 ||
+      (p[2] & 0xc0) != 0x80 || (p[3] & 0xc0) != 0x80 ||
+      (c == 0xf0 && p[1] < 0x90) || (c == 0xf4 && p[1] > 0x8f))
+    return 0;
+
+  *c32 = (c & 0x07) << 18 | (p[1] & 0x3f) << 12 | (p[2] & 0x3f) << 6 |
+         (p[3] & 0x3f);
+  return 4;
+}
+
+/*
+ * Validates from byte i on, skipping ASCII runs with ascii_len.  On
+ * failure valid_len, if not NULL, gets the length of the valid part.
+ */
+static bool c_utf8_validate_from (const uint8_t *p,
+                                  size_t         len,
+                                  size_t         i,
+                                  size_t       (*ascii_len) (const uint8_t *,
+                                                             size_t),
+                                  size_t        *valid_len)
+{
+  char32_t c32;
+  int      n;
+
+  while (i < len)
+  {
+    i += ascii_len (p + i, len - i);
+
+    while (i < len && p[i] >= 0x80)
+    {
+      if (!(n = c_utf8_decode_one (p + i, len - i, &c32)))
+      {
+        if (valid_len)
+          *valid_len = i;
+
+        return false;
+      }
+
+      i += n;
+    }
+  }
+
+  if (valid_len)
+    *valid_len = len;
+
+  return true;
+}
+
+/* adds up the eight byte lanes of word */
+static size_t c_utf8_sum_lanes (uint64_t word)
+{
+  const uint64_t even = 0x00ff00ff00ff00ffull;
+
+  word = (word & even) + (word >> 8 & even);
+
+  return word * 0x0001000100010001ull >> 48;
+}
+
+/*
+ * Eight bytes at a time.  A continuation byte is 10xxxxxx and a 4-byte
+ * lead 11110xxx; matches are counted in byte lanes, summed every 255 words.
+ */
+static size_t c_utf8_count_scalar (const uint8_t *p,
+                                   size_t         len,
+                                   size_t        *n_four)
+{
+  const uint64_t ones   = C_UTF8_HIGH_BITS >> 7;
+  size_t         n_cont = 0;
+  size_t         four   = 0;
+  size_t         i      = 0;
+
+  while (i + 8 <= len)
+  {
+    uint64_t acc_cont = 0;
+    uint64_t acc_four = 0;
+
+    for (int k = 0; k < 255 && i + 8 <= len; k++, i += 8)
+    {
+      uint64_t word = c_utf8_load64 (p + i);
+
+      acc_cont += (word & ~(word << 1)) >> 7 & ones;
+      acc_four += (word & word << 1 & word << 2 & word << 3) >> 7 & ones;
+    }
+
+    n_cont += c_utf8_sum_lanes (acc_cont);
+    four   += c_utf8_sum_lanes (acc_four);
+  }
+
+  for (; i < len; i++)
+  {
+    n_cont += (p[i] & 0xc0) == 0x80;
+    four   += p[i] >= 0xf0;
+  }
+
+  *n_four += four;
+
+  return len - n_cont;
+}
+
+static size_t c_utf8_ascii_len_scalar (const uint8_t *p, size_t len)
+{
+  size_t i = 0;
+
+  while (i + 8 <= len && !(c_utf8_load64 (p + i) & C_UTF8_HIGH_BITS))
+    i += 8;
+
+  while (i < len && p[i] < 0x80)
+    i++;
+
+  return i;
+}
+
+static void c_utf8_widen_scalar (char32_t *dst, const uint8_t *p, size_t len)
+{
+  for (size_t i = 0; i < len; i++)
+    dst[i] = p[i];
+}
+
+static bool c_utf8_validate_scalar (const uint8_t *p,
+                                    size_t         len,
+                                    size_t        *valid_len)
+{
+  return c_utf8_validate_from (p, len, 0, c_utf8_ascii_len_scalar, valid_len);
+}
+
+static const CUtf8Kernels c_utf8_scalar = {
+  c_utf8_count_scalar,
+  c_utf8_ascii_len_scalar,
+  c_utf8_widen_scalar,
+  c_utf8_validate_scalar
+};
+
+#ifdef C_UTF8_X86
+/*
+ * Matches are counted into byte lanes, which are summed with psadbw
+ * before they can overflow.
+ */
+__attribute__ ((target ("sse2")))
+static size_t c_utf8_count_sse2 (const uint8_t *p,
+                                 size_t         len,
+                                 size_t        *n_four)
+{
+  const __m128i min_lead = _mm_set1_epi8 ((char) 0xc0);
+  const __m128i four     = _mm_set1_epi8 ((char) 0xf0);
+  const __m128i zero     = _mm_setzero_si128 ();
+  size_t        n_cont   = 0;
+  size_t        i        = 0;
+
+  while (i + 16 <= len)
+  {
+    __m128i acc_cont = zero;
+    __m128i acc_four = zero;
+    __m128i sum;
+
+    for (int k = 0; k < 255 && i + 16 <= len; k++, i += 16)
+    {
+      __m128i v = _mm_loadu_si128 ((const __m128i *) (p + i));
+
+      /* as signed bytes, 0x80..0xbf are the ones below 0xc0 */
+      acc_cont = _mm_sub_epi8 (acc_cont, _mm_cmplt_epi8 (v, min_lead));
+      acc_four = _mm_sub_epi8 (acc_four,
+                               _mm_cmpeq_epi8 (_mm_and_si128 (v, four), four));
+    }
+
+    sum      = _mm_sad_epu8 (acc_cont, zero);
+    n_cont  += _mm_cvtsi128_si32 (sum) + _mm_extract_epi16 (sum, 4);
+    sum      = _mm_sad_epu8 (acc_four, zero);
+    *n_four += _mm_cvtsi128_si32 (sum) + _mm_extract_epi16 (sum, 4);
+  }
+
+  return i - n_cont + c_utf8_count_scalar (p + i, len - i, n_four);
+}
+
+__attribute__ ((target ("sse2")))
+static size_t c_utf8_ascii_len_sse2 (const uint8_t *p, size_t len)
+{
+  size_t i = 0;
+
+  for (; i + 16 <= len; i += 16)
+  {
+    int mask = _mm_movemask_epi8 (_mm_loadu_si128 ((const __m128i *) (p + i)));
+
+    if (mask)
+      return i + __builtin_ctz (mask);
+  }
+
+  return i + c_utf8_ascii_len_scalar (p + i, len - i);
+}
+
+__attribute__ ((target ("sse2")))
+static void c_utf8_widen_sse2 (char32_t *dst, const uint8_t *p, size_t len)
+{
+  const __m128i zero = _mm_setzero_si128 ();
+  size_t        i    = 0;
+
+  for (; i + 16 <= len; i += 16)
+  {
+    __m128i  v  = _mm_loadu_si128 ((const __m128i *) (p + i));
+    __m128i  lo = _mm_unpacklo_epi8 (v, zero);
+    __m128i  hi = _mm_unpackhi_epi8 (v, zero);
+    __m128i *d  = (__m128i *) (dst + i);
+
+    _mm_storeu_si128 (d,     _mm_unpacklo_epi16 (lo, zero));
+    _mm_storeu_si128 (d + 1, _mm_unpackhi_epi16 (lo, zero));
+    _mm_storeu_si128 (d + 2, _mm_unpacklo_epi16 (hi, zero));
+    _mm_storeu_si128 (d + 3, _mm_unpackhi_epi16 (hi, zero));
+  }
+
+  c_utf8_widen_scalar (dst + i, p + i, len - i);
+}
+
+/* SSE2 has no byte shuffle for table lookups, so only ASCII is skipped. */
+__attribute__ ((target ("sse2")))
+static bool c_utf8_validate_sse2 (const uint8_t *p,
+                                  size_t         len,
+                                  size_t        *valid_len)
+{
+  return c_utf8_validate_from (p, len, 0, c_utf8_ascii_len_sse2, valid_len);
+}
+
+static const CUtf8Kernels c_utf8_sse2 = {
+  c_utf8_count_sse2,
+  c_utf8_ascii_len_sse2,
+  c_utf8_widen_sse2,
+  c_utf8_validate_sse2
+};
+
+__attribute__ ((target ("avx2")))
+static size_t c_utf8_count_avx2 (const uint8_t *p,
+                                 size_t         len,
+                                 size_t        *n_four)
+{
+  const __m256i min_lead = _mm256_set1_epi8 ((char) 0xc0);
+  const __m256i four     = _mm256_set1_epi8 ((char) 0xf0);
+  const __m256i zero     = _mm256_setzero_si256 ();
+  size_t        n_cont   = 0;
+  size_t        i        = 0;
+
+  while (i + 32 <= len)
+  {
+    __m256i  acc_cont = zero;
+    __m256i  acc_four = zero;
+    uint64_t sum[4];
+
+    for (int k = 0; k < 255 && i + 32 <= len; k++, i += 32)
+    {
+      __m256i v = _mm256_loadu_si256 ((const __m256i *) (p + i));
+
+      acc_cont = _mm256_sub_epi8 (acc_cont, _mm256_cmpgt_epi8 (min_lead, v));
+      acc_four = _mm256_sub_epi8 (acc_four,
+                                  _mm256_cmpeq_epi8 (_mm256_and_si256 (v, four),
+                                                     four));
+    }
+
+    _mm256_storeu_si256 ((__m256i *) sum, _mm256_sad_epu8 (acc_cont, zero));
+    n_cont  += sum[0] + sum[1] + sum[2] + sum[3];
+    _mm256_storeu_si256 ((__m256i *) sum, _mm256_sad_epu8 (acc_four, zero));
+    *n_four += sum[0] + sum[1] + sum[2] + sum[3];
+  }
+
+  return i - n_cont + c_utf8_count_scalar (p + i, len - i, n_four);
+}
+
+__attribute__ ((target ("avx2")))
+static size_t c_utf8_ascii_len_avx2 (const uint8_t *p, size_t len)
+{
+  size_t i = 0;
+
+  for (; i + 32 <= len; i += 32)
+  {
+    unsigned mask = _mm256_movemask_epi8 (
+                      _mm256_loadu_si256 ((const __m256i *) (p + i)));
+
+    if (mask)
+      return i + __builtin_ctz (mask);
+  }
+
+  return i + c_utf8_ascii_len_scalar (p + i, len - i);
+}
+
+__attribute__ ((target ("avx2")))
+static void c_utf8_widen_avx2 (char32_t *dst, const uint8_t *p, size_t len)
+{
+  size_t i = 0;
+
+  for (; i + 8 <= len; i += 8)
+  {
+    __m128i v = _mm_loadl_epi64 ((const __m128i *) (p + i));
+
+    _mm256_storeu_si256 ((__m256i *) (dst + i), _mm256_cvtepu8_epi32 (v));
+  }
+
+  c_utf8_widen_scalar (dst + i, p + i, len - i);
+}
+
+/*
+ * The lookup algorithm of Keiser and Lemire, "Validating UTF-8 in less than
+ * one instruction per byte".  Three 16-entry tables, indexed by the high
+ * and low nibbles of the previous byte and the high nibble of the current
+ * one, flag every error that shows in two consecutive bytes; the 3- and
+ * 4-byte lengths are checked against the bytes two and three back.
+ */
+#define C_UTF8_TOO_SHORT  (1 << 0)
+#define C_UTF8_TOO_LONG   (1 << 1)
+#define C_UTF8_OVERLONG_3 (1 << 2)
+#define C_UTF8_TOO_LARGE  (1 << 3)
+#define C_UTF8_SURROGATE  (1 << 4)
+#define C_UTF8_OVERLONG_2 (1 << 5)
+#define C_UTF8_TOO_LARGE_1000 (1 << 6)
+#define C_UTF8_OVERLONG_4 (1 << 6)
+#define C_UTF8_TWO_CONTS  (1 << 7)
+#define C_UTF8_CARRY (C_UTF8_TOO_SHORT | C_UTF8_TOO_LONG | C_UTF8_TWO_CONTS)
+
+#define C_UTF8_TABLE(...) _mm256_setr_epi8 (__VA_ARGS__, __VA_ARGS__)
+
+/* the 32 bytes that end n bytes before the end of input */
+#define C_UTF8_PREV(input, prev, n) \
+  _mm256_alignr_epi8 ((input), \
+                      _mm256_permute2x128_si256 ((prev), (input), 0x21), \
+                      16 - (n))
+
+__attribute__ ((target ("avx2")))
+static __m256i c_utf8_check_avx2 (__m256i input, __m256i prev)
+{
+  const __m256i byte_1_high = C_UTF8_TABLE (
+    C_UTF8_TOO_LONG, C_UTF8_TOO_LONG, C_UTF8_TOO_LONG, C_UTF8_TOO_LONG,
+    C_UTF8_TOO_LONG, C_UTF8_TOO_LONG, C_UTF8_TOO_LONG, C_UTF8_TOO_LONG,
+    C_UTF8_TWO_CONTS, C_UTF8_TWO_CONTS, C_UTF8_TWO_CONTS, C_UTF8_TWO_CONTS,
+    C_UTF8_TOO_SHORT | C_UTF8_OVERLONG_2,
+    C_UTF8_TOO_SHORT,
+    C_UTF8_TOO_SHORT | C_UTF8_OVERLONG_3 | C_UTF8_SURROGATE,
+    C_UTF8_TOO_SHORT | C_UTF8_TOO_LARGE | C_UTF8_TOO_LARGE_1000 |
+      C_UTF8_OVERLONG_4);
+  const __m256i byte_1_low = C_UTF8_TABLE (
+    C_UTF8_CARRY | C_UTF8_OVERLONG_3 | C_UTF8_OVERLONG_2 | C_UTF8_OVERLONG_4,
+    C_UTF8_CARRY | C_UTF8_OVERLONG_2,
+    C_UTF8_CARRY,
+    C_UTF8_CARRY,
+    C_UTF8_CARRY | C_UTF8_TOO_LARGE,
+    C_UTF8_CARRY | C_UTF8_TOO_LARGE | C_UTF8_TOO_LARGE_1000,
+    C_UTF8_CARRY | C_UTF8_TOO_LARGE | C_UTF8_TOO_LARGE_1000,
+    C_UTF8_CARRY | C_UTF8_TOO_LARGE | C_UTF8_TOO_LARGE_1000,
+    C_UTF8_CARRY | C_UTF8_TOO_LARGE | C_UTF8_TOO_LARGE_1000,
+    C_UTF8_CARRY | C_UTF8_TOO_LARGE | C_UTF8_TOO_LARGE_1000,
+    C_UTF8_CARRY | C_UTF8_TOO_LARGE | C_UTF8_TOO_LARGE_1000,
+    C_UTF8_CARRY | C_UTF8_TOO_LARGE | C_UTF8_TOO_LARGE_1000,
+    C_UTF8_CARRY | C_UTF8_TOO_LARGE | C_UTF8_TOO_LARGE_1000,
+    C_UTF8_CARRY | C_UTF8_TOO_LARGE | C_UTF8_TOO_LARGE_1000 |
+      C_UTF8_SURROGATE,
+    C_UTF8_CARRY | C_UTF8_TOO_LARGE | C_UTF8_TOO_LARGE_1000,
+    C_UTF8_CARRY | C_UTF8_TOO_LARGE | C_UTF8_TOO_LARGE_1000);
+  const __m256i byte_2_high = C_UTF8_TABLE (
+    C_UTF8_TOO_SHORT, C_UTF8_TOO_SHORT, C_UTF8_TOO_SHORT, C_UTF8_TOO_SHORT,
+    C_UTF8_TOO_SHORT, C_UTF8_TOO_SHORT, C_UTF8_TOO_SHORT, C_UTF8_TOO_SHORT,
+    C_UTF8_TOO_LONG | C_UTF8_OVERLONG_2 | C_UTF8_TWO_CONTS |
+      C_UTF8_OVERLONG_3 | C_UTF8_TOO_LARGE_1000 | C_UTF8_OVERLONG_4,
+    C_UTF8_TOO_LONG | C_UTF8_OVERLONG_2 | C_UTF8_TWO_CONTS |
+      C_UTF8_OVERLONG_3 | C_UTF8_TOO_LARGE,
+    C_UTF8_TOO_LONG | C_UTF8_OVERLONG_2 | C_UTF8_TWO_CONTS |
+      C_UTF8_SURROGATE | C_UTF8_TOO_LARGE,
+    C_UTF8_TOO_LONG | C_UTF8_OVERLONG_2 | C_UTF8_TWO_CONTS |
+      C_UTF8_SURROGATE | C_UTF8_TOO_LARGE,
+    C_UTF8_TOO_SHORT, C_UTF8_TOO_SHORT, C_UTF8_TOO_SHORT, C_UTF8_TOO_SHORT);
+  const __m256i nibble = _mm256_set1_epi8 (0x0f);
+  __m256i       prev1  = C_UTF8_PREV (input, prev, 1);
+  __m256i       special;
+  __m256i       must23;
+
+  special = _mm256_and_si256 (
+    _mm256_and_si256 (
+      _mm256_shuffle_epi8 (byte_1_high,
+        _mm256_and_si256 (_mm256_srli_epi16 (prev1, 4), nibble)),
+      _mm256_shuffle_epi8 (byte_1_low, _mm256_and_si256 (prev1, nibble))),
+    _mm256_shuffle_epi8 (byte_2_high,
+      _mm256_and_si256 (_mm256_srli_epi16 (input, 4), nibble)));
+
+  /* 0x80 where the byte must be the third or fourth of a character */
+  must23 = _mm256_or_si256 (
+    _mm256_subs_epu8 (C_UTF8_PREV (input, prev, 2), _mm256_set1_epi8 (0x60)),
+    _mm256_subs_epu8 (C_UTF8_PREV (input, prev, 3), _mm256_set1_epi8 (0x70)));
+  must23 = _mm256_and_si256 (must23, _mm256_set1_epi8 ((char) 0x80));
+
+  return _mm256_xor_si256 (must23, special);
+}
+
+__attribute__ ((target ("avx2")))
+static bool c_utf8_validate_avx2 (const uint8_t *p,
+                                  size_t         len,
+                                  size_t        *valid_len)
+{
+  /* a lead in the last three bytes that its character does not fit in */
+  const __m256i max = _mm256_setr_epi8 (
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    0xf0 - 1, 0xe0 - 1, 0xc0 - 1);
+  __m256i prev            = _mm256_setzero_si256 ();
+  __m256i prev_incomplete = _mm256_setzero_si256 ();
+  uint8_t tail[32];
+  size_t  i;
+
+  /* the tail is padded with NULs, which end any unfinished character */
+  for (i = 0; i <= len; i += 32)
+  {
+    __m256i input;
+    __m256i error;
+
+    if (i + 32 <= len)
+    {
+      input = _mm256_loadu_si256 ((const __m256i *) (p + i));
+    }
+    else
+    {
+      memset (tail, 0, sizeof tail);
+      memcpy (tail, p + i, len - i);
+      input = _mm256_loadu_si256 ((const __m256i *) tail);
+    }
+
+    if (!_mm256_movemask_epi8 (input))
+    {
+      error = prev_incomplete;
+    }
+    else
+    {
+      error           = c_utf8_check_avx2 (input, prev);
+      prev_incomplete = _mm256_subs_epu8 (input, max);
+    }
+
+    if (!_mm256_testz_si256 (error, error))
+    {
+      /* Earlier blocks were fine, so a character that the error may be
+       * in starts in the last three bytes before this block at most. */
+      size_t start = i > 3 ? i - 3 : 0;
+
+      while (start < i && (p[start] & 0xc0) == 0x80)
+        start++;
+
+      return c_utf8_validate_from (p, len, start, c_utf8_ascii_len_avx2,
+                                   valid_len);
+    }
+
+    prev = input;
+  }
+
+  if (valid_len)
+    *valid_len = len;
+
+  return true;
+}
+
+static const CUtf8Kernels c_utf8_avx2 = {
+  c_utf8_count_avx2,
+  c_utf8_ascii_len_avx2,
+  c_utf8_widen_avx2,
+  c_utf8_validate_avx2
+};
+#endif
+
+static const CUtf8Kernels *c_utf8_kernels = &c_utf8_scalar;
+
+bool c_utf8_use_kernels (const char *name)
+{
+  const CUtf8Kernels *kernels = &c_utf8_scalar;
+
+#ifdef C_UTF8_X86
+  __builtin_cpu_init ();
+
+  if (!name)
+  {
+    if (__builtin_cpu_supports ("avx2"))
+      kernels = &c_utf8_avx2;
+    else if (__builtin_cpu_supports ("sse2"))
+      kernels = &c_utf8_sse2;
+  }
+  else if (!strcmp (name, "avx2"))
+  {
+    if (!__builtin_cpu_supports ("avx2"))
+      return false;
+
+    kernels = &c_utf8_avx2;
+  }
+  else if (!strcmp (name, "sse2"))
+  {
+    if (!__builtin_cpu_supports ("sse2"))
+      return false;
+
+    kernels = &c_utf8_sse2;
+  }
+  else
+#endif
+  if (name && strcmp (name, "scalar"))
+    return false;
+
+  c_utf8_kernels = kernels;
+
+  return true;
+}
+
+__attribute__ ((constructor))
+static void c_utf8_init (void)
+{
+  c_utf8_use_kernels (NULL);
+}
+
+/*
+ * Counts the characters, by their first bytes, and if n_utf16 is not NULL
+ * the UTF-16 code units they take.
+ */
+size_t c_utf8_count (const char *utf8, size_t len, size_t *n_utf16)
+{
+  size_t n_four  = 0;
+  size_t n_chars = c_utf8_kernels->count ((const uint8_t *) utf8, len,
+                                          &n_four);
+
+  if (n_utf16)
+    *n_utf16 = n_chars + n_four;
+
+  return n_chars;
+}
+
+/*
+ * Returns true if the len bytes are well-formed UTF-8.  Otherwise, if
+ * valid_len is not NULL, it gets the length of the valid part.
+ */
+bool c_utf8_validate (const char *utf8, size_t len, size_t *valid_len)
+{
+  return c_utf8_kernels->validate ((const uint8_t *) utf8, len, valid_len);
+}
+
+/*
+ * Decodes len bytes into dst, at most n_dst characters, and returns the
+ * number of characters in all of them, like snprintf ().  Each byte that
+ * does not start a well-formed character becomes U+FFFD, so the number is
+ * at least c_utf8_count (), and equal to it for well-formed text.
+ */
+size_t c_utf8_decode (const char *utf8,
+                      size_t      len,
+                      char32_t   *dst,
+                      size_t      n_dst)
+{
+  const uint8_t *p     = (const uint8_t *) utf8;
+  size_t         i     = 0;
+  size_t         n_c32 = 0;
+  char32_t       c32;
+  int            n;
+
+  while (i < len)
+  {
+    size_t n_ascii = c_utf8_kernels->ascii_len (p + i, len - i);
+
+    if (n_c32 < n_dst)
+      c_utf8_kernels->widen (dst + n_c32, p + i,
+                             C_MIN (n_ascii, n_dst - n_c32));
+
+    i     += n_ascii;
+    n_c32 += n_ascii;
+
+    while (i < len && p[i] >= 0x80)
+    {
+      if (!(n = c_utf8_decode_one (p + i, len - i, &c32)))
+      {
+        n   = 1;
+        c32 = 0xfffd;
+      }
+
+      if (n_c32 < n_dst)
+        dst[n_c32] = c32;
+
+      i += n;
+      n_c32++;
+    }
+  }
+
+  return n_c32;
+}
+
+/*
+ * Well-formed UTF-8 sorts bytewise in code point order, so the common
+ * prefix is skipped as bytes.  Decoding resumes at the last byte that is
+ * not a continuation, which starts a character in both strings.
+ */
+int c_utf8_strcmp (const char *s1, const char *s2)
+{
+  const uint8_t *a = (const uint8_t *) s1;
+  const uint8_t *b = (const uint8_t *) s2;
+  size_t         i = 0;
+  char32_t       ca, cb;
+  int            na, nb;
+
+  while (a[i] == b[i])
+  {
+    if (!a[i])
+      return 0;
+
+    i++;
+  }
+
+  while (i > 0 && ((a[i] & 0xc0) == 0x80 || (b[i] & 0xc0) == 0x80))
+    i--;
+
+  a += i;
+  b += i;
+
+  /* the terminating NUL stops the decoder before any byte past it */
+  for (;;)
+  {
+    if (!(na = c_utf8_decode_one (a, 4, &ca)))
+    {
+      na = 1;
+      ca = 0xfffd;
+    }
+
+    if (!(nb = c_utf8_decode_one (b, 4, &cb)))
+    {
+      nb = 1;
+      cb = 0xfffd;
+    }
+
+    if (ca != cb || !ca)
+      return (int) ca - (int) cb;
+
+    a += na;
+    b += nb;
+  }
+}
@@ -0,0 +1,53 @@
+/* -*- Mode: C; indent-tabs-mode: nil; c-basic-offset: 2; tab-width: 2 -*- */
+/*
+ * c-utf8.h
+ * This file is part of Clair.
+ *
+ * Copyright (C) 2023 Hodong Kim <hodong@nimfsoft.art>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+#ifndef __C_UTF8_H__
+#define __C_UTF8_H__
+
+#include "c-macros.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <uchar.h>
+
+C_BEGIN_DECLS
+
+/*
+ * UTF-8 kernels over len bytes, which may contain NULs.  The SSE2 or AVX2
+ * versions are picked once, when the library is loaded.
+ */
+size_t c_utf8_count    (const char *utf8, size_t len, size_t *n_utf16);
+bool   c_utf8_validate (const char *utf8, size_t len, size_t *valid_len);
+size_t c_utf8_decode   (const char *utf8,
+                        size_t      len,
+                        char32_t   *dst,
+                        size_t      n_dst);
+/*
+ * Compares two NUL-terminated strings in code point order without
+ * decoding them up front; malformed bytes compare as U+FFFD.
+ */
+int    c_utf8_strcmp   (const char *s1, const char *s2);
+/*
+ * Switches to the "scalar", "sse2" or "avx2" kernels, or back to the best
+ * ones for the CPU if name is NULL.  Returns false if the CPU has no such
+ * kernels.  For tests and benchmarks: it is not thread-safe.
+ */
+bool   c_utf8_use_kernels (const char *name);
+
+C_END_DECLS
+
+#endif /* __C_UTF8_H__ */
@@ -73,6 +73,7 @@ const char* c_get_user_home_dir ()
 }
 
 /*
+ * Returns $XDG_CONFIG_HOME, or ~/.config if it is not set.
  * Returns the newly allocated string on success, or NULL on failure.
  * Free it with free().
  */
@@ -81,6 +82,10 @@ char* c_get_user_config_dir ()
   const char* s1;
   const char* s2 = "/.config";
 
+  /* relative paths are invalid by the XDG spec and ignored */
+  if ((s1 = getenv ("XDG_CONFIG_HOME")) && s1[0] == '/')
+    return c_strdup (s1);
+
   s1 = c_get_user_home_dir ();
 
   if (!s1)
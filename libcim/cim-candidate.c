@@ -0,0 +1,124 @@
+/* -*- Mode: C; indent-tabs-mode: nil; c-basic-offset: 2; tab-width: 2 -*- */
+/*
+ * cim-candidate.c
+ * This file is part of Cim.
+ *
+ * Copyright (C) 2023 Hodong Kim <hodong@nimfsoft.art>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+#include "cim-private.h"
+#include "c-mem.h"
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Storage for one candidate update.  Texts go one after another into a
+ * single buffer, the per-item data into parallel arrays.  Resetting keeps
+ * the buffers, so a page flip allocates nothing once they are big enough.
+ */
+
+void cim_candidate_arena_reserve (CimCandidateArena* arena, int n_items)
+{
+  int capa;
+
+  if (n_items <= arena->capa)
+    return;
+
+  capa = arena->capa ? arena->capa : 16;
+
+  while (capa < n_items)
+    capa *= 2;
+
+  arena->offsets = c_realloc (arena->offsets, capa * sizeof (uint32_t));
+  arena->lens    = c_realloc (arena->lens,    capa * sizeof (uint32_t));
+  arena->types   = c_realloc (arena->types,   capa * sizeof (uint8_t));
+  arena->items   = c_realloc (arena->items,   capa * sizeof (CimItem));
+  arena->table   = c_realloc (arena->table,   capa * sizeof (CimItem*));
+  arena->capa    = capa;
+}
+
+void cim_candidate_arena_reset (CimCandidateArena* arena, int index)
+{
+  arena->text_len      = 0;
+  arena->block.index   = index;
+  arena->block.n_items = 0;
+}
+
+void cim_candidate_arena_add (CimCandidateArena* arena,
+                              int                type,
+                              const char*        text,
+                              size_t             len)
+{
+  int n = arena->block.n_items;
+
+  cim_candidate_arena_reserve (arena, n + 1);
+
+  if (arena->text_len + len + 1 > arena->text_capa)
+  {
+    size_t capa = arena->text_capa ? arena->text_capa : 256;
+
+    while (capa < arena->text_len + len + 1)
+      capa *= 2;
+
+    arena->text      = c_realloc (arena->text, capa);
+    arena->text_capa = capa;
+  }
+
+  memcpy (arena->text + arena->text_len, text, len);
+  arena->text[arena->text_len + len] = 0;
+
+  arena->offsets[n] = arena->text_len;
+  arena->lens[n]    = len;
+  arena->types[n]   = type;
+  arena->text_len  += len + 1;
+  arena->block.n_items++;
+}
+
+/* The buffers may move while items are added; look them up at the end. */
+const CimCandidateBlock* cim_candidate_arena_block (CimCandidateArena* arena)
+{
+  arena->block.text    = arena->text;
+  arena->block.offsets = arena->offsets;
+  arena->block.lens    = arena->lens;
+  arena->block.types   = arena->types;
+
+  return &arena->block;
+}
+
+/*
+ * Points arena->items into the texts and arena->table at the items, with
+ * NULL for CIM_ITEM_NONE, as CimCandidate wants them.
+ */
+CimItem** cim_candidate_arena_table (CimCandidateArena* arena)
+{
+  for (int i = 0; i < arena->block.n_items; i++)
+  {
+    arena->items[i].type = arena->types[i];
+    arena->items[i].data = arena->text + arena->offsets[i];
+    arena->table[i] = arena->types[i] == CIM_ITEM_NONE ? NULL
+                                                        : &arena->items[i];
+  }
+
+  return arena->table;
+}
+
+void cim_candidate_arena_clear (CimCandidateArena* arena)
+{
+  free (arena->text);
+  free (arena->offsets);
+  free (arena->lens);
+  free (arena->types);
+  free (arena->items);
+  free (arena->table);
+  memset (arena, 0, sizeof (CimCandidateArena));
+}
@@ -0,0 +1,796 @@
+/* -*- Mode: C; indent-tabs-mode: nil; c-basic-offset: 2; tab-width: 2 -*- */
+/*
+ * cim-client.c
+ * This file is part of Cim.
+ *
+ * Copyright (C) 2023 Hodong Kim <hodong@nimfsoft.art>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+#include "cim-private.h"
+#include "cim-ipc.h"
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "c-array.h"
+#include "c-mem.h"
+#include "c-str.h"
+
+/*
+ * The engine used when cim-server is running.  Every CimIc operation is
+ * forwarded to the server, which runs the real engine once per session.
+ * The server's callbacks come back while the request is in progress and
+ * are delivered to the toolkit on the calling thread.
+ */
+struct _CimClient {
+  CimIpc          ipc;
+  CimShm*         shm;
+  pthread_mutex_t mutex; /* recursive; callbacks may call into the IC */
+  bool            dead;
+  CimIcOps        ops;
+  uint32_t        next_id;
+  CArray*         ics;
+};
+
+/* candidates fetched from the server; the items point into payload */
+typedef struct _CimClientRange CimClientRange;
+struct _CimClientRange {
+  int      index;
+  int      n_items;
+  bool     last;    /* reaches the end of the list */
+  CimItem* items;
+  uint8_t* payload;
+};
+
+typedef struct _CimClientIc CimClientIc;
+struct _CimClientIc {
+  CimIc               parent;
+  CimClient*          client;
+  uint32_t            id;
+  const CimCallbacks* callbacks;
+  void*               user_data;
+  CimPreedit          preedit;
+  CimCandidate        candidate;
+  CimCandidateArena   arena;      /* holds the candidate table */
+  /* valid until the next candidate message */
+  bool                n_known;
+  bool                exact;
+  int                 n_candidates;
+  CimClientRange      fetched;    /* returned by the last get_candidates */
+  CimClientRange      prefetched;
+  CimClientRange      incoming;
+  /* sent before libcim has set up the IC */
+  CimInterest         interest;
+  bool                has_interest;
+};
+
+static CimClientIc* cim_client_lookup (CimClient* client, uint32_t id)
+{
+  for (unsigned i = 0; i < client->ics->len; i++)
+  {
+    CimClientIc* cic = client->ics->data[i];
+
+    if (cic->id == id)
+      return cic;
+  }
+
+  return NULL;
+}
+
+static int32_t cim_client_get_int (const uint8_t* payload, int i)
+{
+  int32_t value;
+
+  memcpy (&value, payload + i * sizeof (int32_t), sizeof (int32_t));
+
+  return value;
+}
+
+static void cim_client_clear_preedit (CimPreedit* preedit)
+{
+  free (preedit->text);
+  free (preedit->attrs);
+
+  preedit->text       = c_strdup ("");
+  preedit->attrs      = NULL;
+  preedit->attrs_len  = 0;
+  preedit->cursor_pos = 0;
+}
+
+
+static void cim_client_clear_range (CimClientRange* range)
+{
+  free (range->items);
+  free (range->payload);
+  memset (range, 0, sizeof (CimClientRange));
+}
+
+static void cim_client_forget_candidates (CimClientIc* cic)
+{
+  cim_client_clear_range (&cic->fetched);
+  cim_client_clear_range (&cic->prefetched);
+  cim_client_clear_range (&cic->incoming);
+  cic->n_known = false;
+}
+
+/*
+ * int32 n_candidates, exact, index, n_items;
+ * n_items * { int32 type, uint32 len, bytes with a NUL }
+ *
+ * Takes over the payload buffer; the items point into it.
+ */
+static void cim_client_set_range (CimClientIc* cic, CimIpc* ipc)
+{
+  CimClientRange* range   = &cic->incoming;
+  uint8_t*        payload = ipc->payload;
+  uint32_t        len     = ipc->msg.len;
+  uint32_t        pos     = 4 * sizeof (int32_t);
+  int32_t         n_items;
+
+  cim_client_clear_range (range);
+
+  if (len < pos)
+    return;
+
+  ipc->payload      = NULL;
+  ipc->payload_capa = 0;
+
+  cic->n_known      = true;
+  cic->n_candidates = cim_client_get_int (payload, 0);
+  cic->exact        = cim_client_get_int (payload, 1);
+  range->index      = cim_client_get_int (payload, 2);
+  n_items           = cim_client_get_int (payload, 3);
+  range->payload    = payload;
+
+  if (n_items < 0 || n_items > (len - pos) / (2 * sizeof (int32_t)))
+    n_items = 0;
+
+  range->items = c_calloc (C_MAX (n_items, 1), sizeof (CimItem));
+
+  for (int i = 0; i < n_items; i++)
+  {
+    int32_t  type;
+    uint32_t item_len;
+
+    if (len - pos < 2 * sizeof (int32_t))
+      break;
+
+    memcpy (&type,     payload + pos, sizeof (int32_t));
+    memcpy (&item_len, payload + pos + sizeof (int32_t), sizeof (uint32_t));
+    pos += 2 * sizeof (int32_t);
+
+    if (item_len < 1 || item_len > len - pos || payload[pos + item_len - 1])
+      break;
+
+    range->items[i].type = type;
+    range->items[i].data = payload + pos;
+    range->n_items++;
+    pos += item_len;
+  }
+
+  range->last = range->index + range->n_items >= cic->n_candidates;
+}
+
+/* int32 cursor_pos, attrs_len; attrs_len * { int32 type, start, end }; text */
+static void cim_client_set_preedit (CimClientIc* cic,
+                                    const uint8_t* payload,
+                                    uint32_t len)
+{
+  CimPreedit* preedit = &cic->preedit;
+  int32_t     n_attrs;
+
+  cim_client_clear_preedit (preedit);
+
+  if (len < 2 * sizeof (int32_t))
+    return;
+
+  n_attrs = cim_client_get_int (payload, 1);
+
+  if (n_attrs < 0 || n_attrs > (len / sizeof (int32_t) - 2) / 3)
+    return;
+
+  preedit->cursor_pos = cim_client_get_int (payload, 0);
+  preedit->attrs_len  = n_attrs;
+  preedit->attrs      = c_calloc (n_attrs, sizeof (CimPreeditAttr));
+
+  for (int i = 0; i < n_attrs; i++)
+  {
+    preedit->attrs[i].type        = cim_client_get_int (payload, 2 + i * 3);
+    preedit->attrs[i].start_index = cim_client_get_int (payload, 3 + i * 3);
+    preedit->attrs[i].end_index   = cim_client_get_int (payload, 4 + i * 3);
+  }
+
+  free (preedit->text);
+  preedit->text = c_strdup ((const char*) payload +
+                            (2 + n_attrs * 3) * sizeof (int32_t));
+}
+
+/*
+ * int32 page_index, n_pages, n_rows, n_cols;
+ * n_rows * n_cols * { int32 type (-1 for none), uint32 len, bytes }
+ */
+static void cim_client_set_candidate (CimClientIc* cic,
+                                      const uint8_t* payload,
+                                      uint32_t len)
+{
+  CimCandidate* candidate = &cic->candidate;
+  uint32_t      pos       = 4 * sizeof (int32_t);
+  int           n_items;
+
+  memset (candidate, 0, sizeof (CimCandidate));
+  cim_candidate_arena_reset (&cic->arena, 0);
+
+  if (len < pos)
+    return;
+
+  candidate->page_index = cim_client_get_int (payload, 0);
+  candidate->n_pages    = cim_client_get_int (payload, 1);
+  candidate->n_rows     = cim_client_get_int (payload, 2);
+  candidate->n_cols     = cim_client_get_int (payload, 3);
+
+  if (candidate->n_rows < 0 || candidate->n_cols < 0 ||
+      candidate->n_rows > 1024 || candidate->n_cols > 1024)
+  {
+    memset (candidate, 0, sizeof (CimCandidate));
+    return;
+  }
+
+  n_items = candidate->n_rows * candidate->n_cols;
+  cim_candidate_arena_reserve (&cic->arena, n_items);
+
+  for (int i = 0; i < n_items; i++)
+  {
+    int32_t  type     = -1;
+    uint32_t item_len = 0;
+
+    if (len - pos >= 2 * sizeof (int32_t))
+    {
+      memcpy (&type,     payload + pos, sizeof (int32_t));
+      memcpy (&item_len, payload + pos + sizeof (int32_t), sizeof (uint32_t));
+      pos += 2 * sizeof (int32_t);
+    }
+
+    if (item_len > len - pos)
+    {
+      type     = -1;
+      item_len = 0;
+    }
+
+    cim_candidate_arena_add (&cic->arena,
+                             type >= 0 && type < CIM_ITEM_NONE ? type
+                                                               : CIM_ITEM_NONE,
+                             (const char*) payload + pos, item_len);
+    pos += item_len;
+  }
+
+  candidate->table = cim_candidate_arena_table (&cic->arena);
+}
+
+static void cim_client_reply_surround (CimClient* client, CimClientIc* cic)
+{
+  const CimSurround* surround = NULL;
+  int32_t            head[3]  = { 0, 0, 0 };
+  uint32_t           len      = 0;
+
+  if (cic && cic->callbacks && cic->callbacks->get_surround)
+    surround = cic->callbacks->get_surround (&cic->parent, cic->user_data);
+
+  if (surround && surround->text)
+  {
+    len = surround->len >= 0 ? surround->len : strlen (surround->text);
+
+    if (len <= CIM_RING_SIZE - sizeof (CimMsg) - sizeof head)
+    {
+      head[0] = 1;
+      head[1] = surround->cursor_pos;
+      head[2] = surround->anchor_pos;
+    }
+    else
+    {
+      len = 0;
+    }
+  }
+
+  if (!cim_ipc_begin (&client->ipc, CIM_MSG_SURROUND, cic ? cic->id : 0,
+                      sizeof head + len))
+  {
+    client->dead = true;
+    return;
+  }
+
+  cim_ipc_write (&client->ipc, head, sizeof head);
+
+  if (len)
+    cim_ipc_write (&client->ipc, surround->text, len);
+
+  if (!cim_ipc_end (&client->ipc))
+    client->dead = true;
+}
+
+/*
+ * Handles a callback from the server.  The payload buffer is reused by
+ * nested requests, so everything is copied out before calling the toolkit.
+ */
+static void cim_client_dispatch (CimClient* client)
+{
+  CimIpc*             ipc = &client->ipc;
+  CimClientIc*        cic = cim_client_lookup (client, ipc->msg.ic_id);
+  CimIc*              ic  = cic ? &cic->parent : NULL;
+  uint32_t            deleted = 0;
+  const CimCallbacks* cb;
+
+  switch (ipc->msg.type)
+  {
+    case CIM_MSG_GET_SURROUND:
+      cim_client_reply_surround (client, cic);
+      return;
+    case CIM_MSG_DELETE_SURROUND:
+      if (cic && cic->callbacks && ipc->msg.len == 2 * sizeof (int32_t))
+      {
+        int32_t offset  = cim_client_get_int (ipc->payload, 0);
+        int32_t n_chars = cim_client_get_int (ipc->payload, 1);
+
+        deleted = cic->callbacks->delete_surround (ic, offset, n_chars,
+                                                   cic->user_data);
+      }
+
+      if (!cim_ipc_send (ipc, CIM_MSG_DELETED, ipc->msg.ic_id, &deleted,
+                         sizeof deleted))
+        client->dead = true;
+      return;
+    default:
+      break;
+  }
+
+  if (!cic)
+    return;
+
+  /* Until libcim has set up the IC there are no callbacks; the state is
+   * still kept, like the interest. */
+  cb = cic->callbacks;
+
+  switch (ipc->msg.type)
+  {
+    case CIM_MSG_PREEDIT_START:
+      if (cb)
+        cb->preedit_start (ic, cic->user_data);
+      break;
+    case CIM_MSG_PREEDIT_END:
+      if (cb)
+        cb->preedit_end (ic, cic->user_data);
+      break;
+    case CIM_MSG_PREEDIT_CHANGED:
+      cim_client_set_preedit (cic, ipc->payload, ipc->msg.len);
+
+      if (cb)
+        cb->preedit_changed (ic, &cic->preedit, cic->user_data);
+      break;
+    case CIM_MSG_COMMIT:
+      {
+        char* text = (char*) ipc->payload;
+
+        ipc->payload      = NULL;
+        ipc->payload_capa = 0;
+
+        if (cb)
+          cb->commit (ic, text, cic->user_data);
+
+        free (text);
+      }
+      break;
+    case CIM_MSG_CANDIDATE_START:
+      cim_client_forget_candidates (cic);
+
+      if (cb)
+        cb->candidate_start (ic, cic->user_data);
+      break;
+    case CIM_MSG_CANDIDATE_END:
+      cim_client_forget_candidates (cic);
+
+      if (cb)
+        cb->candidate_end (ic, cic->user_data);
+      break;
+    case CIM_MSG_CANDIDATES:
+      cim_client_set_range (cic, ipc);
+      break;
+    case CIM_MSG_CANDIDATE_CHANGED:
+      cim_client_forget_candidates (cic);
+      cim_client_set_candidate (cic, ipc->payload, ipc->msg.len);
+
+      if (cb)
+        cb->candidate_changed (ic, &cic->candidate, cic->user_data);
+      break;
+    case CIM_MSG_INTEREST:
+      if (ipc->msg.len == sizeof (CimInterest))
+      {
+        memcpy (&cic->interest, ipc->payload, sizeof (CimInterest));
+
+        if (ic->priv)
+          cim_ic_set_interest (ic, &cic->interest);
+        else
+          cic->has_interest = true;
+      }
+      break;
+    default:
+      break;
+  }
+}
+
+/*
+ * Reads messages until CIM_MSG_DONE, handling callbacks on the way.
+ * Marks the connection dead if the server does not answer in time.
+ */
+static bool cim_client_wait (CimClient* client, uint32_t* value)
+{
+  while (!client->dead && cim_ipc_read (&client->ipc, CIM_IPC_TIMEOUT))
+  {
+    if (client->ipc.msg.type == CIM_MSG_DONE)
+    {
+      if (value && client->ipc.msg.len == sizeof (uint32_t))
+        memcpy (value, client->ipc.payload, sizeof (uint32_t));
+
+      return true;
+    }
+
+    cim_client_dispatch (client);
+  }
+
+  client->dead = true;
+
+  return false;
+}
+
+static uint32_t cim_client_request (CimIc*      ic,
+                                    CimMsgType  type,
+                                    const void* data,
+                                    uint32_t    len)
+{
+  CimClientIc* cic    = (CimClientIc*) ic;
+  CimClient*   client = cic->client;
+  uint32_t     retval = 0;
+
+  pthread_mutex_lock (&client->mutex);
+
+  if (!client->dead)
+  {
+    if (cim_ipc_send (&client->ipc, type, cic->id, data, len))
+      cim_client_wait (client, &retval);
+    else
+      client->dead = true;
+  }
+
+  pthread_mutex_unlock (&client->mutex);
+
+  return retval;
+}
+
+static void cim_client_focus_in (CimIc* ic)
+{
+  cim_client_request (ic, CIM_MSG_FOCUS_IN, NULL, 0);
+}
+
+static void cim_client_focus_out (CimIc* ic)
+{
+  cim_client_request (ic, CIM_MSG_FOCUS_OUT, NULL, 0);
+}
+
+static void cim_client_reset (CimIc* ic)
+{
+  cim_client_request (ic, CIM_MSG_RESET, NULL, 0);
+}
+
+static bool cim_client_filter_event (CimIc* ic, const CimEvent* event)
+{
+  uint32_t retval = cim_client_request (ic, CIM_MSG_FILTER_EVENT, event,
+                                        sizeof (CimEvent));
+
+  if (retval >> 1)
+    cim_ic_set_repeats_used (ic, event, event->n_repeats - (retval >> 1));
+
+  return retval & 1;
+}
+
+static void cim_client_set_cursor_pos (CimIc* ic, const CimRect* area)
+{
+  cim_client_request (ic, CIM_MSG_SET_CURSOR_POS, area, sizeof (CimRect));
+}
+
+static void cim_client_set_content_type (CimIc*     ic,
+                                         CimPurpose purpose,
+                                         uint32_t   hints)
+{
+  uint32_t args[2] = { purpose, hints };
+
+  cim_client_request (ic, CIM_MSG_SET_CONTENT_TYPE, args, sizeof args);
+}
+
+static const CimPreedit* cim_client_get_preedit (CimIc* ic)
+{
+  return &((CimClientIc*) ic)->preedit;
+}
+
+static const CimCandidate* cim_client_get_candidate (CimIc* ic)
+{
+  return &((CimClientIc*) ic)->candidate;
+}
+
+/* Asks the server for a range and moves the answer into range. */
+static void cim_client_fetch (CimClientIc*    cic,
+                              int             index,
+                              int             n_items,
+                              CimClientRange* range)
+{
+  int32_t args[2] = { index, n_items };
+
+  cim_client_clear_range (&cic->incoming);
+  cim_client_request (&cic->parent, CIM_MSG_GET_CANDIDATES, args, sizeof args);
+
+  cim_client_clear_range (range);
+  *range = cic->incoming;
+  memset (&cic->incoming, 0, sizeof (CimClientRange));
+}
+
+static bool cim_client_range_covers (const CimClientRange* range,
+                                     int                   index,
+                                     int                   n_items)
+{
+  if (!range->items || index < range->index)
+    return false;
+
+  if (range->last)
+    return index <= range->index + range->n_items;
+
+  return index + n_items <= range->index + range->n_items;
+}
+
+static int cim_client_get_n_candidates (CimIc* ic, bool* exact)
+{
+  CimClientIc* cic = (CimClientIc*) ic;
+
+  if (!cic->n_known)
+  {
+    CimClientRange range = { 0 };
+
+    cim_client_fetch (cic, 0, 0, &range);
+    cim_client_clear_range (&range);
+  }
+
+  *exact = cic->exact;
+
+  return cic->n_candidates;
+}
+
+static int cim_client_get_candidates (CimIc*   ic,
+                                      int      index,
+                                      int      n_items,
+                                      CimItem* items)
+{
+  CimClientIc*    cic   = (CimClientIc*) ic;
+  CimClientRange* range = &cic->fetched;
+  int             n;
+
+  if (cim_client_range_covers (&cic->prefetched, index, n_items))
+  {
+    cim_client_clear_range (&cic->fetched);
+    cic->fetched = cic->prefetched;
+    memset (&cic->prefetched, 0, sizeof (CimClientRange));
+  }
+  else if (!cim_client_range_covers (range, index, n_items))
+  {
+    cim_client_fetch (cic, index, n_items, range);
+
+    if (!range->items || index < range->index)
+      return 0;
+  }
+
+  n = C_MAX (C_MIN (n_items, range->index + range->n_items - index), 0);
+  memcpy (items, range->items + index - range->index, n * sizeof (CimItem));
+
+  return n;
+}
+
+static void cim_client_prefetch_candidates (CimIc* ic, int index, int n_items)
+{
+  CimClientIc* cic = (CimClientIc*) ic;
+
+  if (!cim_client_range_covers (&cic->fetched,    index, n_items) &&
+      !cim_client_range_covers (&cic->prefetched, index, n_items))
+    cim_client_fetch (cic, index, n_items, &cic->prefetched);
+}
+
+static void cim_client_set_callbacks (CimIc*              ic,
+                                      const CimCallbacks* callbacks,
+                                      void*               user_data)
+{
+  CimClientIc* cic = (CimClientIc*) ic;
+
+  cic->callbacks = callbacks;
+  cic->user_data = user_data;
+
+  if (cic->has_interest)
+  {
+    cic->has_interest = false;
+    cim_ic_set_interest (ic, &cic->interest);
+  }
+}
+
+/*
+ * Returns a client connected to cim-server, or NULL if no server is
+ * running for this user.
+ */
+CimClient* cim_client_new ()
+{
+  CimClient*          client;
+  CimShm*             shm;
+  char*               path;
+  int                 sock;
+  int                 memfd;
+  uint32_t            hello[2];
+  struct sockaddr_un  addr = { .sun_family = AF_UNIX };
+  pthread_mutexattr_t attr;
+
+  if (!(path = cim_ipc_get_socket_path ()))
+    return NULL;
+
+  if (strlen (path) >= sizeof addr.sun_path)
+  {
+    free (path);
+    return NULL;
+  }
+
+  strcpy (addr.sun_path, path);
+  free (path);
+
+  if ((sock = socket (AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0)) < 0)
+    return NULL;
+
+  if (connect (sock, (struct sockaddr*) &addr, sizeof addr) ||
+      !cim_ipc_peer_is_same_user (sock) ||
+      (memfd = cim_ipc_memfd_new ()) < 0)
+  {
+    close (sock);
+    return NULL;
+  }
+
+  shm = mmap (NULL, sizeof (CimShm), PROT_READ | PROT_WRITE, MAP_SHARED,
+              memfd, 0);
+
+  if (shm == MAP_FAILED || !cim_ipc_send_fd (sock, memfd))
+  {
+    if (shm != MAP_FAILED)
+      munmap (shm, sizeof (CimShm));
+
+    close (memfd);
+    close (sock);
+    return NULL;
+  }
+
+  close (memfd);
+
+  client = c_calloc (1, sizeof (CimClient));
+  client->shm = shm;
+  client->ics = c_array_new (NULL, true);
+  cim_ipc_init (&client->ipc, sock, shm, false);
+
+  pthread_mutexattr_init (&attr);
+  pthread_mutexattr_settype (&attr, PTHREAD_MUTEX_RECURSIVE);
+  pthread_mutex_init (&client->mutex, &attr);
+  pthread_mutexattr_destroy (&attr);
+
+  if (!cim_ipc_read (&client->ipc, CIM_IPC_TIMEOUT) ||
+      client->ipc.msg.type != CIM_MSG_HELLO ||
+      client->ipc.msg.len  != sizeof hello)
+  {
+    cim_client_free (client);
+    return NULL;
+  }
+
+  memcpy (hello, client->ipc.payload, sizeof hello);
+
+  if (hello[0] != CIM_IPC_VERSION)
+  {
+    cim_client_free (client);
+    return NULL;
+  }
+
+  client->ops = (CimIcOps) {
+    .size           = sizeof (CimIcOps),
+    .abi_version    = CIM_ABI_VERSION,
+    .caps           = hello[1],
+    .focus_in       = cim_client_focus_in,
+    .focus_out      = cim_client_focus_out,
+    .reset          = cim_client_reset,
+    .filter_event   = cim_client_filter_event,
+    .set_cursor_pos = cim_client_set_cursor_pos,
+    .get_preedit    = cim_client_get_preedit,
+    .get_candidate  = cim_client_get_candidate,
+    .set_callbacks  = cim_client_set_callbacks,
+    .get_n_candidates    = cim_client_get_n_candidates,
+    .get_candidates      = cim_client_get_candidates,
+    .prefetch_candidates = cim_client_prefetch_candidates,
+    .set_content_type    = cim_client_set_content_type
+  };
+
+  return client;
+}
+
+void cim_client_free (CimClient* client)
+{
+  cim_ipc_clear (&client->ipc);
+  munmap (client->shm, sizeof (CimShm));
+  c_array_free (client->ics);
+  pthread_mutex_destroy (&client->mutex);
+  free (client);
+}
+
+const CimIcOps* cim_client_query (CimClient* client)
+{
+  return &client->ops;
+}
+
+/*
+ * Returns true once the server has gone away.  libcim then switches to a
+ * locally loaded engine, and toolkit modules move their ICs on focus-in.
+ */
+bool cim_client_is_dead (CimClient* client)
+{
+  bool dead;
+
+  pthread_mutex_lock (&client->mutex);
+  dead = client->dead;
+  pthread_mutex_unlock (&client->mutex);
+
+  return dead;
+}
+
+CimIc* cim_client_ic_new (CimClient* client)
+{
+  CimClientIc* cic = c_calloc (1, sizeof (CimClientIc));
+
+  cic->client = client;
+  cim_client_clear_preedit (&cic->preedit);
+
+  pthread_mutex_lock (&client->mutex);
+  cic->id = ++client->next_id;
+  c_array_add (client->ics, cic);
+  pthread_mutex_unlock (&client->mutex);
+
+  cim_client_request (&cic->parent, CIM_MSG_IC_NEW, NULL, 0);
+
+  return &cic->parent;
+}
+
+void cim_client_ic_free (CimIc* ic)
+{
+  CimClientIc* cic    = (CimClientIc*) ic;
+  CimClient*   client = cic->client;
+
+  pthread_mutex_lock (&client->mutex);
+
+  if (!client->dead &&
+      !cim_ipc_send (&client->ipc, CIM_MSG_IC_FREE, cic->id, NULL, 0))
+    client->dead = true;
+
+  c_array_remove (client->ics, cic);
+
+  pthread_mutex_unlock (&client->mutex);
+
+  cim_client_clear_preedit (&cic->preedit);
+  free (cic->preedit.text);
+  cim_candidate_arena_clear (&cic->arena);
+  cim_client_forget_candidates (cic);
+  free (cic);
+}
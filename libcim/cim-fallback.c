@@ -0,0 +1,178 @@
+/* -*- Mode: C; indent-tabs-mode: nil; c-basic-offset: 2; tab-width: 2 -*- */
+/*
+ * cim-fallback.c
+ * This file is part of Cim.
+ *
+ * Copyright (C) 2023 Hodong Kim <hodong@nimfsoft.art>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+#include "cim-private.h"
+#include "c-mem.h"
+#include "c-str.h"
+#include <stdlib.h>
+
+/*
+ * A passthrough engine with dead key composition.  Everything except dead
+ * key sequences is left to the toolkit, so typing keeps working when
+ * cim.so is missing.
+ */
+
+typedef struct _CimFallbackIc CimFallbackIc;
+struct _CimFallbackIc {
+  CimIc               parent;
+  uint32_t            dead_key;
+  const CimCallbacks* callbacks;
+  void*               user_data;
+};
+
+typedef struct _CimDeadKey CimDeadKey;
+struct _CimDeadKey {
+  uint32_t        keyval;
+  char32_t        spacing;
+  const char*     bases;
+  const char32_t* composed; /* one character per base */
+};
+
+static const CimDeadKey cim_dead_keys[] = {
+  { CIM_KEY_dead_grave,      0x0060, "AEIOUaeiou",   U"ÀÈÌÒÙàèìòù"   },
+  { CIM_KEY_dead_acute,      0x00b4, "AEIOUYaeiouy", U"ÁÉÍÓÚÝáéíóúý" },
+  { CIM_KEY_dead_circumflex, 0x005e, "AEIOUaeiou",   U"ÂÊÎÔÛâêîôû"   },
+  { CIM_KEY_dead_tilde,      0x007e, "ANOano",       U"ÃÑÕãñõ"       },
+  { CIM_KEY_dead_diaeresis,  0x00a8, "AEIOUaeiouy",  U"ÄËÏÖÜäëïöüÿ"  },
+  { CIM_KEY_dead_cedilla,    0x00b8, "Cc",           U"Çç"           }
+};
+
+static const CimDeadKey* cim_dead_key_lookup (uint32_t keyval)
+{
+  for (size_t i = 0; i < C_N_ELEMENTS (cim_dead_keys); i++)
+    if (cim_dead_keys[i].keyval == keyval)
+      return &cim_dead_keys[i];
+
+  return NULL;
+}
+
+static void cim_fallback_commit (CimFallbackIc* fic, char32_t c)
+{
+  char buf[8];
+
+  c_char32_to_utf8_with_buf (c, buf);
+  fic->callbacks->commit ((CimIc*) fic, buf, fic->user_data);
+}
+
+static bool cim_fallback_filter_event (CimIc* ic, const CimEvent* event)
+{
+  CimFallbackIc*    fic = (CimFallbackIc*) ic;
+  const CimDeadKey* dead;
+  const CimDeadKey* pending;
+
+  if (event->type == CIM_EVENT_KEY_RELEASE)
+    return false;
+
+  if ((event->keyval >= CIM_KEY_Shift_L && event->keyval <= CIM_KEY_Hyper_R) ||
+      event->keyval == CIM_KEY_ISO_Level3_Shift)
+    return false;
+
+  pending = cim_dead_key_lookup (fic->dead_key);
+  dead    = cim_dead_key_lookup (event->keyval);
+
+  if (dead)
+  {
+    if (pending == dead)
+    {
+      fic->dead_key = 0;
+      cim_fallback_commit (fic, dead->spacing);
+    }
+    else
+    {
+      fic->dead_key = dead->keyval;
+    }
+
+    return true;
+  }
+
+  if (!pending)
+    return false;
+
+  fic->dead_key = 0;
+
+  if (event->state & (CIM_CONTROL_MASK | CIM_MOD1_MASK))
+    return false;
+
+  if (event->keyval == CIM_KEY_Escape || event->keyval == CIM_KEY_BackSpace)
+    return true;
+
+  if (event->keyval == CIM_KEY_space)
+  {
+    cim_fallback_commit (fic, pending->spacing);
+    return true;
+  }
+
+  if (event->keyval < 0x80)
+  {
+    for (int i = 0; pending->bases[i]; i++)
+    {
+      if (pending->bases[i] == event->keyval)
+      {
+        cim_fallback_commit (fic, pending->composed[i]);
+        return true;
+      }
+    }
+  }
+
+  /* Not composable: emit the accent and let the key through. */
+  cim_fallback_commit (fic, pending->spacing);
+
+  return false;
+}
+
+static void cim_fallback_reset (CimIc* ic)
+{
+  ((CimFallbackIc*) ic)->dead_key = 0;
+}
+
+static void cim_fallback_set_callbacks (CimIc*              ic,
+                                        const CimCallbacks* callbacks,
+                                        void*               user_data)
+{
+  CimFallbackIc* fic = (CimFallbackIc*) ic;
+
+  fic->callbacks = callbacks;
+  fic->user_data = user_data;
+
+  /* key releases never compose */
+  cim_ic_set_interest (ic, &(CimInterest) { 0 });
+}
+
+static const CimIcOps cim_fallback_ops = {
+  .size          = sizeof (CimIcOps),
+  .abi_version   = CIM_ABI_VERSION,
+  .focus_out     = cim_fallback_reset,
+  .reset         = cim_fallback_reset,
+  .filter_event  = cim_fallback_filter_event,
+  .set_callbacks = cim_fallback_set_callbacks
+};
+
+const CimIcOps* cim_fallback_query (uint32_t abi_version)
+{
+  return &cim_fallback_ops;
+}
+
+CimIc* cim_fallback_ic_new ()
+{
+  return c_calloc (1, sizeof (CimFallbackIc));
+}
+
+void cim_fallback_ic_free (CimIc* ic)
+{
+  free (ic);
+}
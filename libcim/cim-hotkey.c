@@ -0,0 +1,309 @@
+/* -*- Mode: C; indent-tabs-mode: nil; c-basic-offset: 2; tab-width: 2 -*- */
+/*
+ * cim-hotkey.c
+ * This file is part of Cim.
+ *
+ * Copyright (C) 2023 Hodong Kim <hodong@nimfsoft.art>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "cim.h"
+#include "c-array.h"
+#include "c-mem.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* what cim_hotkeys_add_string () leaves out of the comparison */
+#define CIM_HOTKEY_IGNORED (CIM_LOCK_MASK    | CIM_MOD2_MASK    | \
+                            CIM_BUTTON1_MASK | CIM_BUTTON2_MASK | \
+                            CIM_BUTTON3_MASK | CIM_BUTTON4_MASK | \
+                            CIM_BUTTON5_MASK)
+
+typedef struct
+{
+  uint32_t key;  /* keyval << 1 | release */
+  uint32_t mods;
+  uint32_t mask; /* the modifiers compared */
+  int      action;
+} CimHotkey;
+
+/*
+ * The compiled form: bindings sorted by key, and an open addressed table
+ * from each key to its run of bindings.  A key of 0 marks a free slot;
+ * real keys are at least 2 since keyval 0 is refused.
+ */
+typedef struct
+{
+  uint32_t key;
+  uint16_t first;
+  uint16_t n;
+} CimHotkeySlot;
+
+struct _CimHotkeys {
+  C_VEC (CimHotkey, 8) hotkeys;
+  CimHotkey*     sorted;
+  CimHotkeySlot* slots;
+  uint32_t       slot_mask;
+  bool           dirty;
+};
+
+static uint32_t cim_hotkey_key (uint32_t keyval, bool release)
+{
+  /* ASCII letters in lower case */
+  if (keyval >= 'A' && keyval <= 'Z')
+    keyval |= 0x20;
+
+  return keyval << 1 | release;
+}
+
+/*
+ * The modifier bits a modifier key sets itself.  They are in the state of
+ * its release and, if another key of the same kind is held, of its press,
+ * so they are not compared for it.
+ */
+static uint32_t cim_hotkey_own_mask (uint32_t keyval)
+{
+  switch (keyval)
+  {
+    case CIM_KEY_Shift_L:
+    case CIM_KEY_Shift_R:
+      return CIM_SHIFT_MASK;
+    case CIM_KEY_Control_L:
+    case CIM_KEY_Control_R:
+      return CIM_CONTROL_MASK;
+    case CIM_KEY_Caps_Lock:
+      return CIM_LOCK_MASK;
+    case CIM_KEY_Alt_L:
+    case CIM_KEY_Alt_R:
+    case CIM_KEY_Meta_L:
+    case CIM_KEY_Meta_R:
+      return CIM_MOD1_MASK | CIM_META_MASK;
+    case CIM_KEY_Super_L:
+    case CIM_KEY_Super_R:
+      return CIM_MOD4_MASK | CIM_SUPER_MASK;
+    case CIM_KEY_Hyper_L:
+    case CIM_KEY_Hyper_R:
+      return CIM_MOD3_MASK | CIM_HYPER_MASK;
+    case CIM_KEY_ISO_Level3_Shift:
+      return CIM_MOD5_MASK;
+    default:
+      return 0;
+  }
+}
+
+static uint32_t cim_hotkey_hash (uint32_t key, uint32_t slot_mask)
+{
+  return (key * 0x9e3779b9u >> 15) & slot_mask;
+}
+
+CimHotkeys* cim_hotkeys_new ()
+{
+  CimHotkeys* hotkeys = c_calloc (1, sizeof (CimHotkeys));
+
+  c_vec_init (&hotkeys->hotkeys);
+
+  return hotkeys;
+}
+
+void cim_hotkeys_free (CimHotkeys* hotkeys)
+{
+  if (!hotkeys)
+    return;
+
+  c_vec_fini (&hotkeys->hotkeys);
+  free (hotkeys->sorted);
+  free (hotkeys->slots);
+  free (hotkeys);
+}
+
+bool cim_hotkeys_add (CimHotkeys*  hotkeys,
+                      CimEventType type,
+                      uint32_t     keyval,
+                      uint32_t     mods,
+                      uint32_t     ignored,
+                      int          action)
+{
+  CimHotkey hotkey;
+
+  if (!keyval || keyval > 0x7fffffff || !action ||
+      hotkeys->hotkeys.len >= UINT16_MAX)
+    return false;
+
+  hotkey.key    = cim_hotkey_key (keyval, type == CIM_EVENT_KEY_RELEASE);
+  hotkey.mask   = CIM_MODIFIER_MASK & ~ignored &
+                  ~cim_hotkey_own_mask (keyval);
+  hotkey.mods   = mods & hotkey.mask;
+  hotkey.action = action;
+
+  c_vec_push (&hotkeys->hotkeys, hotkey);
+  hotkeys->dirty = true;
+
+  return true;
+}
+
+/*
+ * Takes bindings such as "Hangul", "<Shift>space" or "<Release>Shift_L",
+ * in the style of GTK accelerators.  Lock, NumLock (Mod2) and the mouse
+ * buttons are ignored.
+ */
+bool cim_hotkeys_add_string (CimHotkeys* hotkeys,
+                             const char* binding,
+                             int         action)
+{
+  static const struct {
+    const char* name;
+    uint32_t    mask;
+  } modifiers[] = {
+    { "Shift",   CIM_SHIFT_MASK   },
+    { "Control", CIM_CONTROL_MASK },
+    { "Ctrl",    CIM_CONTROL_MASK },
+    { "Alt",     CIM_MOD1_MASK    },
+    { "Mod1",    CIM_MOD1_MASK    },
+    { "Mod2",    CIM_MOD2_MASK    },
+    { "Mod3",    CIM_MOD3_MASK    },
+    { "Mod4",    CIM_MOD4_MASK    },
+    { "Mod5",    CIM_MOD5_MASK    },
+    { "Super",   CIM_SUPER_MASK   },
+    { "Hyper",   CIM_HYPER_MASK   },
+    { "Meta",    CIM_META_MASK    }
+  };
+
+  CimEventType type = CIM_EVENT_KEY_PRESS;
+  uint32_t     mods = 0;
+  const char*  p    = binding;
+
+  while (*p == '<')
+  {
+    const char* end = strchr (p, '>');
+    size_t      len;
+    size_t      i;
+
+    if (!end)
+      return false;
+
+    p++;
+    len = end - p;
+
+    if (len == 7 && !strncmp (p, "Release", len))
+    {
+      type = CIM_EVENT_KEY_RELEASE;
+    }
+    else
+    {
+      for (i = 0; i < C_N_ELEMENTS (modifiers); i++)
+      {
+        if (strlen (modifiers[i].name) == len &&
+            !strncmp (p, modifiers[i].name, len))
+        {
+          mods |= modifiers[i].mask;
+          break;
+        }
+      }
+
+      if (i == C_N_ELEMENTS (modifiers))
+        return false;
+    }
+
+    p = end + 1;
+  }
+
+  return cim_hotkeys_add (hotkeys, type, cim_keysym_from_name (p), mods,
+                          CIM_HOTKEY_IGNORED, action);
+}
+
+static int cim_hotkey_compare (const void* a, const void* b)
+{
+  const CimHotkey* x = a;
+  const CimHotkey* y = b;
+
+  if (x->key != y->key)
+    return x->key < y->key ? -1 : 1;
+
+  /* action holds the index while compiling */
+  return x->action - y->action;
+}
+
+static void cim_hotkeys_compile (CimHotkeys* hotkeys)
+{
+  unsigned n = hotkeys->hotkeys.len;
+  unsigned n_slots = 8;
+
+  hotkeys->dirty = false;
+
+  while (n_slots < n * 2)
+    n_slots *= 2;
+
+  /* sorted by key, stable so the first added still wins */
+  hotkeys->sorted = c_realloc (hotkeys->sorted,
+                               (n ? n : 1) * sizeof (CimHotkey));
+  memcpy (hotkeys->sorted, hotkeys->hotkeys.data, n * sizeof (CimHotkey));
+
+  for (unsigned i = 0; i < n; i++)
+    hotkeys->sorted[i].action = i;
+
+  qsort (hotkeys->sorted, n, sizeof (CimHotkey), cim_hotkey_compare);
+
+  for (unsigned i = 0; i < n; i++)
+    hotkeys->sorted[i] = hotkeys->hotkeys.data[hotkeys->sorted[i].action];
+
+  free (hotkeys->slots);
+  hotkeys->slots     = c_calloc (n_slots, sizeof (CimHotkeySlot));
+  hotkeys->slot_mask = n_slots - 1;
+
+  for (unsigned i = 0, j; i < n; i = j)
+  {
+    uint32_t key = hotkeys->sorted[i].key;
+    uint32_t k   = cim_hotkey_hash (key, hotkeys->slot_mask);
+
+    for (j = i + 1; j < n && hotkeys->sorted[j].key == key; j++)
+      ;
+
+    while (hotkeys->slots[k].key)
+      k = (k + 1) & hotkeys->slot_mask;
+
+    hotkeys->slots[k] = (CimHotkeySlot) { key, i, j - i };
+  }
+}
+
+/* Returns the action bound to event, or 0. */
+int cim_hotkeys_lookup (CimHotkeys* hotkeys, const CimEvent* event)
+{
+  uint32_t key;
+  uint32_t k;
+
+  if (hotkeys->dirty)
+    cim_hotkeys_compile (hotkeys);
+
+  if (!hotkeys->slots)
+    return 0;
+
+  key = cim_hotkey_key (event->keyval, event->type == CIM_EVENT_KEY_RELEASE);
+
+  for (k = cim_hotkey_hash (key, hotkeys->slot_mask);
+       hotkeys->slots[k].key;
+       k = (k + 1) & hotkeys->slot_mask)
+  {
+    if (hotkeys->slots[k].key == key)
+    {
+      const CimHotkey* hotkey = hotkeys->sorted + hotkeys->slots[k].first;
+
+      for (int i = 0; i < hotkeys->slots[k].n; i++, hotkey++)
+        if ((event->state & hotkey->mask) == hotkey->mods)
+          return hotkey->action;
+
+      return 0;
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,299 @@
+/* -*- Mode: C; indent-tabs-mode: nil; c-basic-offset: 2; tab-width: 2 -*- */
+/*
+ * cim-ipc.c
+ * This file is part of Cim.
+ *
+ * Copyright (C) 2023 Hodong Kim <hodong@nimfsoft.art>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+#ifdef __linux__
+#define _GNU_SOURCE /* memfd_create () */
+#endif
+#include "cim-ipc.h"
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include "c-mem.h"
+#include "c-str.h"
+
+/*
+ * Returns the newly allocated socket path, or NULL if the server is not
+ * used.  $CIM_SERVER overrides the default; an empty value disables it.
+ * Free it with free().
+ */
+char* cim_ipc_get_socket_path ()
+{
+  const char* path;
+
+  if ((path = getenv ("CIM_SERVER")))
+    return path[0] ? c_strdup (path) : NULL;
+
+  if ((path = getenv ("XDG_RUNTIME_DIR")) && path[0])
+    return c_str_join (path, "/cim-server", NULL);
+
+  return NULL;
+}
+
+/*
+ * Returns an anonymous shared memory fd large enough for a CimShm,
+ * or -1 on failure.
+ */
+int cim_ipc_memfd_new ()
+{
+  int fd;
+
+#if defined (__linux__)
+  fd = memfd_create ("cim", MFD_CLOEXEC);
+#elif defined (__FreeBSD__)
+  fd = shm_open (SHM_ANON, O_RDWR | O_CLOEXEC, 0600);
+#else
+  fd = -1;
+#endif
+
+  if (fd >= 0 && ftruncate (fd, sizeof (CimShm)) < 0)
+  {
+    close (fd);
+    fd = -1;
+  }
+
+  return fd;
+}
+
+bool cim_ipc_send_fd (int sock, int fd)
+{
+  char            byte = 0;
+  struct iovec    iov  = { &byte, 1 };
+  struct msghdr   msg  = { 0 };
+  struct cmsghdr* cmsg;
+  union {
+    char           buf[CMSG_SPACE (sizeof (int))];
+    struct cmsghdr align;
+  } control;
+
+  memset (&control, 0, sizeof control);
+
+  msg.msg_iov        = &iov;
+  msg.msg_iovlen     = 1;
+  msg.msg_control    = control.buf;
+  msg.msg_controllen = sizeof control.buf;
+
+  cmsg = CMSG_FIRSTHDR (&msg);
+  cmsg->cmsg_level = SOL_SOCKET;
+  cmsg->cmsg_type  = SCM_RIGHTS;
+  cmsg->cmsg_len   = CMSG_LEN (sizeof (int));
+  memcpy (CMSG_DATA (cmsg), &fd, sizeof (int));
+
+  return sendmsg (sock, &msg, MSG_NOSIGNAL) == 1;
+}
+
+/*
+ * Returns the fd sent with cim_ipc_send_fd(), or -1 on failure.  It does
+ * not wait, so poll the socket first.
+ */
+int cim_ipc_recv_fd (int sock)
+{
+  char            byte;
+  int             fd   = -1;
+  struct iovec    iov  = { &byte, 1 };
+  struct msghdr   msg  = { 0 };
+  struct cmsghdr* cmsg;
+  union {
+    char           buf[CMSG_SPACE (sizeof (int))];
+    struct cmsghdr align;
+  } control;
+
+  msg.msg_iov        = &iov;
+  msg.msg_iovlen     = 1;
+  msg.msg_control    = control.buf;
+  msg.msg_controllen = sizeof control.buf;
+
+  if (recvmsg (sock, &msg, MSG_CMSG_CLOEXEC | MSG_DONTWAIT) != 1)
+    return -1;
+
+  cmsg = CMSG_FIRSTHDR (&msg);
+
+  if (cmsg && cmsg->cmsg_level == SOL_SOCKET &&
+      cmsg->cmsg_type == SCM_RIGHTS &&
+      cmsg->cmsg_len == CMSG_LEN (sizeof (int)))
+    memcpy (&fd, CMSG_DATA (cmsg), sizeof (int));
+
+  return fd;
+}
+
+bool cim_ipc_peer_is_same_user (int sock)
+{
+#ifdef __linux__
+  struct ucred cred;
+  socklen_t    len = sizeof cred;
+
+  return !getsockopt (sock, SOL_SOCKET, SO_PEERCRED, &cred, &len) &&
+         cred.uid == getuid ();
+#else
+  uid_t uid;
+  gid_t gid;
+
+  return !getpeereid (sock, &uid, &gid) && uid == getuid ();
+#endif
+}
+
+void cim_ipc_init (CimIpc* ipc, int sock, CimShm* shm, bool server)
+{
+  memset (ipc, 0, sizeof (CimIpc));
+
+  ipc->fd = sock;
+  ipc->tx = server ? &shm->to_client : &shm->to_server;
+  ipc->rx = server ? &shm->to_server : &shm->to_client;
+}
+
+void cim_ipc_clear (CimIpc* ipc)
+{
+  if (ipc->fd >= 0)
+    close (ipc->fd);
+
+  free (ipc->payload);
+
+  ipc->fd           = -1;
+  ipc->payload      = NULL;
+  ipc->payload_capa = 0;
+}
+
+/*
+ * Starts a message of len payload bytes, waiting briefly for the reader to
+ * make room if needed.  Fails at once if the peer has hung up.  Follow
+ * with cim_ipc_write() for exactly len bytes and cim_ipc_end().
+ */
+bool cim_ipc_begin (CimIpc*    ipc,
+                    CimMsgType type,
+                    uint32_t   ic_id,
+                    uint32_t   len)
+{
+  CimMsg   msg  = { type, ic_id, len };
+  uint32_t need = sizeof msg + len;
+
+  if (len > CIM_RING_SIZE - sizeof msg)
+    return false;
+
+  ipc->pos = atomic_load_explicit (&ipc->tx->head, memory_order_relaxed);
+
+  for (int i = 0; CIM_RING_SIZE - (ipc->pos -
+       atomic_load_explicit (&ipc->tx->tail, memory_order_acquire)) < need;
+       i++)
+  {
+    /* no events: only a hangup or an error ends the wait early */
+    struct pollfd pfd = { ipc->fd, 0, 0 };
+
+    if (i == CIM_IPC_FULL_TIMEOUT || poll (&pfd, 1, 1) < 0 || pfd.revents)
+      return false;
+  }
+
+  cim_ipc_write (ipc, &msg, sizeof msg);
+
+  return true;
+}
+
+void cim_ipc_write (CimIpc* ipc, const void* data, uint32_t len)
+{
+  uint32_t offset = ipc->pos & (CIM_RING_SIZE - 1);
+  uint32_t n      = C_MIN (len, CIM_RING_SIZE - offset);
+
+  memcpy (ipc->tx->data + offset, data, n);
+  memcpy (ipc->tx->data, (const uint8_t*) data + n, len - n);
+
+  ipc->pos += len;
+}
+
+/* Publishes the message and wakes up the reader. */
+bool cim_ipc_end (CimIpc* ipc)
+{
+  char byte = 0;
+
+  atomic_store_explicit (&ipc->tx->head, ipc->pos, memory_order_release);
+
+  return send (ipc->fd, &byte, 1, MSG_NOSIGNAL) == 1;
+}
+
+bool cim_ipc_send (CimIpc*     ipc,
+                   CimMsgType  type,
+                   uint32_t    ic_id,
+                   const void* data,
+                   uint32_t    len)
+{
+  if (!cim_ipc_begin (ipc, type, ic_id, len))
+    return false;
+
+  if (len)
+    cim_ipc_write (ipc, data, len);
+
+  return cim_ipc_end (ipc);
+}
+
+static void cim_ring_read (CimRing* ring,
+                           uint32_t pos,
+                           void*    data,
+                           uint32_t len)
+{
+  uint32_t offset = pos & (CIM_RING_SIZE - 1);
+  uint32_t n      = C_MIN (len, CIM_RING_SIZE - offset);
+
+  memcpy (data, ring->data + offset, n);
+  memcpy ((uint8_t*) data + n, ring->data, len - n);
+}
+
+/*
+ * Waits up to timeout milliseconds (-1 for ever) for the next message and
+ * reads it into ipc->msg and ipc->payload.  Returns false if the peer has
+ * gone away, timed out or sent something malformed.
+ */
+bool cim_ipc_read (CimIpc* ipc, int timeout)
+{
+  struct pollfd pfd = { ipc->fd, POLLIN, 0 };
+  uint32_t      head;
+  uint32_t      tail;
+  char          byte;
+
+  if (poll (&pfd, 1, timeout) <= 0 || recv (ipc->fd, &byte, 1, 0) != 1)
+    return false;
+
+  tail = atomic_load_explicit (&ipc->rx->tail, memory_order_relaxed);
+  head = atomic_load_explicit (&ipc->rx->head, memory_order_acquire);
+
+  /* the peer writes head, so it is not trusted to stay within the ring */
+  if (head - tail < sizeof (CimMsg) || head - tail > CIM_RING_SIZE)
+    return false;
+
+  cim_ring_read (ipc->rx, tail, &ipc->msg, sizeof (CimMsg));
+  tail += sizeof (CimMsg);
+
+  if (ipc->msg.len > CIM_RING_SIZE - sizeof (CimMsg) ||
+      head - tail < ipc->msg.len)
+    return false;
+
+  if (ipc->payload_capa < ipc->msg.len + 1)
+  {
+    ipc->payload_capa = ipc->msg.len + 1;
+    ipc->payload      = c_realloc (ipc->payload, ipc->payload_capa);
+  }
+
+  cim_ring_read (ipc->rx, tail, ipc->payload, ipc->msg.len);
+  ipc->payload[ipc->msg.len] = 0;
+
+  atomic_store_explicit (&ipc->rx->tail, tail + ipc->msg.len,
+                         memory_order_release);
+
+  return true;
+}
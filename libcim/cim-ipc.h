@@ -0,0 +1,132 @@
+/* -*- Mode: C; indent-tabs-mode: nil; c-basic-offset: 2; tab-width: 2 -*- */
+/*
+ * cim-ipc.h
+ * This file is part of Cim.
+ *
+ * Copyright (C) 2023 Hodong Kim <hodong@nimfsoft.art>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+#ifndef __CIM_IPC_H__
+#define __CIM_IPC_H__
+
+#include "cim.h"
+#include "c-macros.h"
+#include <stdatomic.h>
+#include <stddef.h>
+
+C_BEGIN_DECLS
+
+/*
+ * Transport between libcim and cim-server.
+ *
+ * The client creates a memfd holding two rings, one per direction, and
+ * passes it over the Unix socket when it connects.  Messages are written
+ * into a ring and announced by one byte on the socket; the byte only wakes
+ * the reader, the payload never goes through the socket.  Each ring has a
+ * single writer and a single reader.
+ *
+ * Every request from the client is answered with CIM_MSG_DONE.  Before
+ * that the server may send callbacks; CIM_MSG_GET_SURROUND and
+ * CIM_MSG_DELETE_SURROUND are answered by the client with
+ * CIM_MSG_SURROUND and CIM_MSG_DELETED.  CIM_MSG_GET_CANDIDATES gets
+ * CIM_MSG_CANDIDATES before its CIM_MSG_DONE.  A request that arrives
+ * while one side waits for an answer is handled first, like a nested call.
+ * The CIM_MSG_DONE of CIM_MSG_FILTER_EVENT holds whether the event was
+ * handled in bit 0 and the repeats the engine did not use above it.
+ */
+
+#define CIM_IPC_VERSION   6
+#define CIM_RING_SIZE     (256 * 1024) /* a power of 2 */
+#define CIM_IPC_TIMEOUT   2000         /* milliseconds */
+#define CIM_IPC_FULL_TIMEOUT 50        /* for room in a full ring, ditto */
+
+enum _CimMsgType {
+  /* client to server */
+  CIM_MSG_IC_NEW = 1,
+  CIM_MSG_IC_FREE,            /* not answered */
+  CIM_MSG_FOCUS_IN,
+  CIM_MSG_FOCUS_OUT,
+  CIM_MSG_RESET,
+  CIM_MSG_FILTER_EVENT,       /* CimEvent */
+  CIM_MSG_SET_CURSOR_POS,     /* CimRect */
+  CIM_MSG_SURROUND,           /* int32 valid, cursor, anchor; text */
+  CIM_MSG_DELETED,            /* uint32 */
+  CIM_MSG_GET_CANDIDATES,     /* int32 index, n_items */
+  CIM_MSG_SET_CONTENT_TYPE,   /* uint32 purpose, hints */
+  /* server to client */
+  CIM_MSG_HELLO,              /* uint32 version, caps */
+  CIM_MSG_DONE,               /* uint32 */
+  CIM_MSG_PREEDIT_START,
+  CIM_MSG_PREEDIT_END,
+  CIM_MSG_PREEDIT_CHANGED,    /* int32 cursor, n_attrs; attrs; text */
+  CIM_MSG_COMMIT,             /* text */
+  CIM_MSG_GET_SURROUND,
+  CIM_MSG_DELETE_SURROUND,    /* int32 offset, n_chars */
+  CIM_MSG_CANDIDATE_START,
+  CIM_MSG_CANDIDATE_END,
+  CIM_MSG_CANDIDATE_CHANGED,  /* int32 page, n_pages, rows, cols; items */
+  CIM_MSG_CANDIDATES,         /* int32 total, exact, index, n; items */
+  CIM_MSG_INTEREST            /* CimInterest */
+};
+typedef enum _CimMsgType CimMsgType;
+
+typedef struct _CimMsg CimMsg;
+struct _CimMsg {
+  uint32_t type;
+  uint32_t ic_id;
+  uint32_t len;   /* of the payload */
+};
+
+typedef struct _CimRing CimRing;
+struct _CimRing {
+  _Alignas (64) atomic_uint head; /* written by the writer */
+  _Alignas (64) atomic_uint tail; /* written by the reader */
+  _Alignas (64) uint8_t     data[CIM_RING_SIZE];
+};
+
+typedef struct _CimShm CimShm;
+struct _CimShm {
+  CimRing to_server;
+  CimRing to_client;
+};
+
+typedef struct _CimIpc CimIpc;
+struct _CimIpc {
+  int      fd;       /* the socket */
+  CimRing* tx;
+  CimRing* rx;
+  CimMsg   msg;      /* the last message read */
+  uint8_t* payload;  /* its payload, NUL-terminated */
+  size_t   payload_capa;
+  uint32_t pos;      /* pending write position in tx */
+};
+
+char* cim_ipc_get_socket_path ();
+int   cim_ipc_memfd_new       ();
+bool  cim_ipc_send_fd         (int sock, int fd);
+int   cim_ipc_recv_fd         (int sock);
+bool  cim_ipc_peer_is_same_user (int sock);
+
+void  cim_ipc_init    (CimIpc* ipc, int sock, CimShm* shm, bool server);
+void  cim_ipc_clear   (CimIpc* ipc);
+bool  cim_ipc_begin   (CimIpc* ipc, CimMsgType type, uint32_t ic_id,
+                       uint32_t len);
+void  cim_ipc_write   (CimIpc* ipc, const void* data, uint32_t len);
+bool  cim_ipc_end     (CimIpc* ipc);
+bool  cim_ipc_send    (CimIpc* ipc, CimMsgType type, uint32_t ic_id,
+                       const void* data, uint32_t len);
+bool  cim_ipc_read    (CimIpc* ipc, int timeout);
+
+C_END_DECLS
+
+#endif /* __CIM_IPC_H__ */
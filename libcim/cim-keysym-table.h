@@ -0,0 +1,6764 @@
+/* Generated by gen-keysym-table.rb from keysymdef.h and XF86keysym.h; do not edit. */
+
+static const char cim_keysym_names[] =
+  "VoidSymbol\0" "BackSpace\0" "Tab\0" "Linefeed\0"
+  "Clear\0" "Return\0" "Pause\0" "Scroll_Lock\0"
+  "Sys_Req\0" "Escape\0" "Delete\0" "Multi_key\0"
+  "Codeinput\0" "SingleCandidate\0" "MultipleCandidate\0" "PreviousCandidate\0"
+  "Kanji\0" "Muhenkan\0" "Henkan_Mode\0" "Henkan\0"
+  "Romaji\0" "Hiragana\0" "Katakana\0" "Hiragana_Katakana\0"
+  "Zenkaku\0" "Hankaku\0" "Zenkaku_Hankaku\0" "Touroku\0"
+  "Massyo\0" "Kana_Lock\0" "Kana_Shift\0" "Eisu_Shift\0"
+  "Eisu_toggle\0" "Kanji_Bangou\0" "Zen_Koho\0" "Mae_Koho\0"
+  "Home\0" "Left\0" "Up\0" "Right\0"
+  "Down\0" "Prior\0" "Page_Up\0" "Next\0"
+  "Page_Down\0" "End\0" "Begin\0" "Select\0"
+  "Print\0" "Execute\0" "Insert\0" "Undo\0"
+  "Redo\0" "Menu\0" "Find\0" "Cancel\0"
+  "Help\0" "Break\0" "Mode_switch\0" "script_switch\0"
+  "Num_Lock\0" "KP_Space\0" "KP_Tab\0" "KP_Enter\0"
+  "KP_F1\0" "KP_F2\0" "KP_F3\0" "KP_F4\0"
+  "KP_Home\0" "KP_Left\0" "KP_Up\0" "KP_Right\0"
+  "KP_Down\0" "KP_Prior\0" "KP_Page_Up\0" "KP_Next\0"
+  "KP_Page_Down\0" "KP_End\0" "KP_Begin\0" "KP_Insert\0"
+  "KP_Delete\0" "KP_Equal\0" "KP_Multiply\0" "KP_Add\0"
+  "KP_Separator\0" "KP_Subtract\0" "KP_Decimal\0" "KP_Divide\0"
+  "KP_0\0" "KP_1\0" "KP_2\0" "KP_3\0"
+  "KP_4\0" "KP_5\0" "KP_6\0" "KP_7\0"
+  "KP_8\0" "KP_9\0" "F1\0" "F2\0"
+  "F3\0" "F4\0" "F5\0" "F6\0"
+  "F7\0" "F8\0" "F9\0" "F10\0"
+  "F11\0" "L1\0" "F12\0" "L2\0"
+  "F13\0" "L3\0" "F14\0" "L4\0"
+  "F15\0" "L5\0" "F16\0" "L6\0"
+  "F17\0" "L7\0" "F18\0" "L8\0"
+  "F19\0" "L9\0" "F20\0" "L10\0"
+  "F21\0" "R1\0" "F22\0" "R2\0"
+  "F23\0" "R3\0" "F24\0" "R4\0"
+  "F25\0" "R5\0" "F26\0" "R6\0"
+  "F27\0" "R7\0" "F28\0" "R8\0"
+  "F29\0" "R9\0" "F30\0" "R10\0"
+  "F31\0" "R11\0" "F32\0" "R12\0"
+  "F33\0" "R13\0" "F34\0" "R14\0"
+  "F35\0" "R15\0" "Shift_L\0" "Shift_R\0"
+  "Control_L\0" "Control_R\0" "Caps_Lock\0" "Shift_Lock\0"
+  "Meta_L\0" "Meta_R\0" "Alt_L\0" "Alt_R\0"
+  "Super_L\0" "Super_R\0" "Hyper_L\0" "Hyper_R\0"
+  "ISO_Lock\0" "ISO_Level2_Latch\0" "ISO_Level3_Shift\0" "ISO_Level3_Latch\0"
+  "ISO_Level3_Lock\0" "ISO_Level5_Shift\0" "ISO_Level5_Latch\0" "ISO_Level5_Lock\0"
+  "ISO_Group_Shift\0" "ISO_Group_Latch\0" "ISO_Group_Lock\0" "ISO_Next_Group\0"
+  "ISO_Next_Group_Lock\0" "ISO_Prev_Group\0" "ISO_Prev_Group_Lock\0" "ISO_First_Group\0"
+  "ISO_First_Group_Lock\0" "ISO_Last_Group\0" "ISO_Last_Group_Lock\0" "ISO_Left_Tab\0"
+  "ISO_Move_Line_Up\0" "ISO_Move_Line_Down\0" "ISO_Partial_Line_Up\0" "ISO_Partial_Line_Down\0"
+  "ISO_Partial_Space_Left\0" "ISO_Partial_Space_Right\0" "ISO_Set_Margin_Left\0" "ISO_Set_Margin_Right\0"
+  "ISO_Release_Margin_Left\0" "ISO_Release_Margin_Right\0" "ISO_Release_Both_Margins\0" "ISO_Fast_Cursor_Left\0"
+  "ISO_Fast_Cursor_Right\0" "ISO_Fast_Cursor_Up\0" "ISO_Fast_Cursor_Down\0" "ISO_Continuous_Underline\0"
+  "ISO_Discontinuous_Underline\0" "ISO_Emphasize\0" "ISO_Center_Object\0" "ISO_Enter\0"
+  "dead_grave\0" "dead_acute\0" "dead_circumflex\0" "dead_tilde\0"
+  "dead_perispomeni\0" "dead_macron\0" "dead_breve\0" "dead_abovedot\0"
+  "dead_diaeresis\0" "dead_abovering\0" "dead_doubleacute\0" "dead_caron\0"
+  "dead_cedilla\0" "dead_ogonek\0" "dead_iota\0" "dead_voiced_sound\0"
+  "dead_semivoiced_sound\0" "dead_belowdot\0" "dead_hook\0" "dead_horn\0"
+  "dead_stroke\0" "dead_abovecomma\0" "dead_psili\0" "dead_abovereversedcomma\0"
+  "dead_dasia\0" "dead_doublegrave\0" "dead_belowring\0" "dead_belowmacron\0"
+  "dead_belowcircumflex\0" "dead_belowtilde\0" "dead_belowbreve\0" "dead_belowdiaeresis\0"
+  "dead_invertedbreve\0" "dead_belowcomma\0" "dead_currency\0" "dead_lowline\0"
+  "dead_aboveverticalline\0" "dead_belowverticalline\0" "dead_longsolidusoverlay\0" "dead_a\0"
+  "dead_A\0" "dead_e\0" "dead_E\0" "dead_i\0"
+  "dead_I\0" "dead_o\0" "dead_O\0" "dead_u\0"
+  "dead_U\0" "dead_small_schwa\0" "dead_capital_schwa\0" "dead_greek\0"
+  "First_Virtual_Screen\0" "Prev_Virtual_Screen\0" "Next_Virtual_Screen\0" "Last_Virtual_Screen\0"
+  "Terminate_Server\0" "AccessX_Enable\0" "AccessX_Feedback_Enable\0" "RepeatKeys_Enable\0"
+  "SlowKeys_Enable\0" "BounceKeys_Enable\0" "StickyKeys_Enable\0" "MouseKeys_Enable\0"
+  "MouseKeys_Accel_Enable\0" "Overlay1_Enable\0" "Overlay2_Enable\0" "AudibleBell_Enable\0"
+  "Pointer_Left\0" "Pointer_Right\0" "Pointer_Up\0" "Pointer_Down\0"
+  "Pointer_UpLeft\0" "Pointer_UpRight\0" "Pointer_DownLeft\0" "Pointer_DownRight\0"
+  "Pointer_Button_Dflt\0" "Pointer_Button1\0" "Pointer_Button2\0" "Pointer_Button3\0"
+  "Pointer_Button4\0" "Pointer_Button5\0" "Pointer_DblClick_Dflt\0" "Pointer_DblClick1\0"
+  "Pointer_DblClick2\0" "Pointer_DblClick3\0" "Pointer_DblClick4\0" "Pointer_DblClick5\0"
+  "Pointer_Drag_Dflt\0" "Pointer_Drag1\0" "Pointer_Drag2\0" "Pointer_Drag3\0"
+  "Pointer_Drag4\0" "Pointer_Drag5\0" "Pointer_EnableKeys\0" "Pointer_Accelerate\0"
+  "Pointer_DfltBtnNext\0" "Pointer_DfltBtnPrev\0" "ch\0" "Ch\0"
+  "CH\0" "c_h\0" "C_h\0" "C_H\0"
+  "3270_Duplicate\0" "3270_FieldMark\0" "3270_Right2\0" "3270_Left2\0"
+  "3270_BackTab\0" "3270_EraseEOF\0" "3270_EraseInput\0" "3270_Reset\0"
+  "3270_Quit\0" "3270_PA1\0" "3270_PA2\0" "3270_PA3\0"
+  "3270_Test\0" "3270_Attn\0" "3270_CursorBlink\0" "3270_AltCursor\0"
+  "3270_KeyClick\0" "3270_Jump\0" "3270_Ident\0" "3270_Rule\0"
+  "3270_Copy\0" "3270_Play\0" "3270_Setup\0" "3270_Record\0"
+  "3270_ChangeScreen\0" "3270_DeleteWord\0" "3270_ExSelect\0" "3270_CursorSelect\0"
+  "3270_PrintScreen\0" "3270_Enter\0" "space\0" "exclam\0"
+  "quotedbl\0" "numbersign\0" "dollar\0" "percent\0"
+  "ampersand\0" "apostrophe\0" "quoteright\0" "parenleft\0"
+  "parenright\0" "asterisk\0" "plus\0" "comma\0"
+  "minus\0" "period\0" "slash\0" "0\0"
+  "1\0" "2\0" "3\0" "4\0"
+  "5\0" "6\0" "7\0" "8\0"
+  "9\0" "colon\0" "semicolon\0" "less\0"
+  "equal\0" "greater\0" "question\0" "at\0"
+  "A\0" "B\0" "C\0" "D\0"
+  "E\0" "F\0" "G\0" "H\0"
+  "I\0" "J\0" "K\0" "L\0"
+  "M\0" "N\0" "O\0" "P\0"
+  "Q\0" "R\0" "S\0" "T\0"
+  "U\0" "V\0" "W\0" "X\0"
+  "Y\0" "Z\0" "bracketleft\0" "backslash\0"
+  "bracketright\0" "asciicircum\0" "underscore\0" "grave\0"
+  "quoteleft\0" "a\0" "b\0" "c\0"
+  "d\0" "e\0" "f\0" "g\0"
+  "h\0" "i\0" "j\0" "k\0"
+  "l\0" "m\0" "n\0" "o\0"
+  "p\0" "q\0" "r\0" "s\0"
+  "t\0" "u\0" "v\0" "w\0"
+  "x\0" "y\0" "z\0" "braceleft\0"
+  "bar\0" "braceright\0" "asciitilde\0" "nobreakspace\0"
+  "exclamdown\0" "cent\0" "sterling\0" "currency\0"
+  "yen\0" "brokenbar\0" "section\0" "diaeresis\0"
+  "copyright\0" "ordfeminine\0" "guillemotleft\0" "notsign\0"
+  "hyphen\0" "registered\0" "macron\0" "degree\0"
+  "plusminus\0" "twosuperior\0" "threesuperior\0" "acute\0"
+  "mu\0" "paragraph\0" "periodcentered\0" "cedilla\0"
+  "onesuperior\0" "masculine\0" "guillemotright\0" "onequarter\0"
+  "onehalf\0" "threequarters\0" "questiondown\0" "Agrave\0"
+  "Aacute\0" "Acircumflex\0" "Atilde\0" "Adiaeresis\0"
+  "Aring\0" "AE\0" "Ccedilla\0" "Egrave\0"
+  "Eacute\0" "Ecircumflex\0" "Ediaeresis\0" "Igrave\0"
+  "Iacute\0" "Icircumflex\0" "Idiaeresis\0" "ETH\0"
+  "Eth\0" "Ntilde\0" "Ograve\0" "Oacute\0"
+  "Ocircumflex\0" "Otilde\0" "Odiaeresis\0" "multiply\0"
+  "Oslash\0" "Ooblique\0" "Ugrave\0" "Uacute\0"
+  "Ucircumflex\0" "Udiaeresis\0" "Yacute\0" "THORN\0"
+  "Thorn\0" "ssharp\0" "agrave\0" "aacute\0"
+  "acircumflex\0" "atilde\0" "adiaeresis\0" "aring\0"
+  "ae\0" "ccedilla\0" "egrave\0" "eacute\0"
+  "ecircumflex\0" "ediaeresis\0" "igrave\0" "iacute\0"
+  "icircumflex\0" "idiaeresis\0" "eth\0" "ntilde\0"
+  "ograve\0" "oacute\0" "ocircumflex\0" "otilde\0"
+  "odiaeresis\0" "division\0" "oslash\0" "ooblique\0"
+  "ugrave\0" "uacute\0" "ucircumflex\0" "udiaeresis\0"
+  "yacute\0" "thorn\0" "ydiaeresis\0" "Aogonek\0"
+  "breve\0" "Lstroke\0" "Lcaron\0" "Sacute\0"
+  "Scaron\0" "Scedilla\0" "Tcaron\0" "Zacute\0"
+  "Zcaron\0" "Zabovedot\0" "aogonek\0" "ogonek\0"
+  "lstroke\0" "lcaron\0" "sacute\0" "caron\0"
+  "scaron\0" "scedilla\0" "tcaron\0" "zacute\0"
+  "doubleacute\0" "zcaron\0" "zabovedot\0" "Racute\0"
+  "Abreve\0" "Lacute\0" "Cacute\0" "Ccaron\0"
+  "Eogonek\0" "Ecaron\0" "Dcaron\0" "Dstroke\0"
+  "Nacute\0" "Ncaron\0" "Odoubleacute\0" "Rcaron\0"
+  "Uring\0" "Udoubleacute\0" "Tcedilla\0" "racute\0"
+  "abreve\0" "lacute\0" "cacute\0" "ccaron\0"
+  "eogonek\0" "ecaron\0" "dcaron\0" "dstroke\0"
+  "nacute\0" "ncaron\0" "odoubleacute\0" "rcaron\0"
+  "uring\0" "udoubleacute\0" "tcedilla\0" "abovedot\0"
+  "Hstroke\0" "Hcircumflex\0" "Iabovedot\0" "Gbreve\0"
+  "Jcircumflex\0" "hstroke\0" "hcircumflex\0" "idotless\0"
+  "gbreve\0" "jcircumflex\0" "Cabovedot\0" "Ccircumflex\0"
+  "Gabovedot\0" "Gcircumflex\0" "Ubreve\0" "Scircumflex\0"
+  "cabovedot\0" "ccircumflex\0" "gabovedot\0" "gcircumflex\0"
+  "ubreve\0" "scircumflex\0" "kra\0" "kappa\0"
+  "Rcedilla\0" "Itilde\0" "Lcedilla\0" "Emacron\0"
+  "Gcedilla\0" "Tslash\0" "rcedilla\0" "itilde\0"
+  "lcedilla\0" "emacron\0" "gcedilla\0" "tslash\0"
+  "ENG\0" "eng\0" "Amacron\0" "Iogonek\0"
+  "Eabovedot\0" "Imacron\0" "Ncedilla\0" "Omacron\0"
+  "Kcedilla\0" "Uogonek\0" "Utilde\0" "Umacron\0"
+  "amacron\0" "iogonek\0" "eabovedot\0" "imacron\0"
+  "ncedilla\0" "omacron\0" "kcedilla\0" "uogonek\0"
+  "utilde\0" "umacron\0" "Wcircumflex\0" "wcircumflex\0"
+  "Ycircumflex\0" "ycircumflex\0" "Babovedot\0" "babovedot\0"
+  "Dabovedot\0" "dabovedot\0" "Fabovedot\0" "fabovedot\0"
+  "Mabovedot\0" "mabovedot\0" "Pabovedot\0" "pabovedot\0"
+  "Sabovedot\0" "sabovedot\0" "Tabovedot\0" "tabovedot\0"
+  "Wgrave\0" "wgrave\0" "Wacute\0" "wacute\0"
+  "Wdiaeresis\0" "wdiaeresis\0" "Ygrave\0" "ygrave\0"
+  "OE\0" "oe\0" "Ydiaeresis\0" "overline\0"
+  "kana_fullstop\0" "kana_openingbracket\0" "kana_closingbracket\0" "kana_comma\0"
+  "kana_conjunctive\0" "kana_middledot\0" "kana_WO\0" "kana_a\0"
+  "kana_i\0" "kana_u\0" "kana_e\0" "kana_o\0"
+  "kana_ya\0" "kana_yu\0" "kana_yo\0" "kana_tsu\0"
+  "kana_tu\0" "prolongedsound\0" "kana_A\0" "kana_I\0"
+  "kana_U\0" "kana_E\0" "kana_O\0" "kana_KA\0"
+  "kana_KI\0" "kana_KU\0" "kana_KE\0" "kana_KO\0"
+  "kana_SA\0" "kana_SHI\0" "kana_SU\0" "kana_SE\0"
+  "kana_SO\0" "kana_TA\0" "kana_CHI\0" "kana_TI\0"
+  "kana_TSU\0" "kana_TU\0" "kana_TE\0" "kana_TO\0"
+  "kana_NA\0" "kana_NI\0" "kana_NU\0" "kana_NE\0"
+  "kana_NO\0" "kana_HA\0" "kana_HI\0" "kana_FU\0"
+  "kana_HU\0" "kana_HE\0" "kana_HO\0" "kana_MA\0"
+  "kana_MI\0" "kana_MU\0" "kana_ME\0" "kana_MO\0"
+  "kana_YA\0" "kana_YU\0" "kana_YO\0" "kana_RA\0"
+  "kana_RI\0" "kana_RU\0" "kana_RE\0" "kana_RO\0"
+  "kana_WA\0" "kana_N\0" "voicedsound\0" "semivoicedsound\0"
+  "kana_switch\0" "Farsi_0\0" "Farsi_1\0" "Farsi_2\0"
+  "Farsi_3\0" "Farsi_4\0" "Farsi_5\0" "Farsi_6\0"
+  "Farsi_7\0" "Farsi_8\0" "Farsi_9\0" "Arabic_percent\0"
+  "Arabic_superscript_alef\0" "Arabic_tteh\0" "Arabic_peh\0" "Arabic_tcheh\0"
+  "Arabic_ddal\0" "Arabic_rreh\0" "Arabic_comma\0" "Arabic_fullstop\0"
+  "Arabic_0\0" "Arabic_1\0" "Arabic_2\0" "Arabic_3\0"
+  "Arabic_4\0" "Arabic_5\0" "Arabic_6\0" "Arabic_7\0"
+  "Arabic_8\0" "Arabic_9\0" "Arabic_semicolon\0" "Arabic_question_mark\0"
+  "Arabic_hamza\0" "Arabic_maddaonalef\0" "Arabic_hamzaonalef\0" "Arabic_hamzaonwaw\0"
+  "Arabic_hamzaunderalef\0" "Arabic_hamzaonyeh\0" "Arabic_alef\0" "Arabic_beh\0"
+  "Arabic_tehmarbuta\0" "Arabic_teh\0" "Arabic_theh\0" "Arabic_jeem\0"
+  "Arabic_hah\0" "Arabic_khah\0" "Arabic_dal\0" "Arabic_thal\0"
+  "Arabic_ra\0" "Arabic_zain\0" "Arabic_seen\0" "Arabic_sheen\0"
+  "Arabic_sad\0" "Arabic_dad\0" "Arabic_tah\0" "Arabic_zah\0"
+  "Arabic_ain\0" "Arabic_ghain\0" "Arabic_tatweel\0" "Arabic_feh\0"
+  "Arabic_qaf\0" "Arabic_kaf\0" "Arabic_lam\0" "Arabic_meem\0"
+  "Arabic_noon\0" "Arabic_ha\0" "Arabic_heh\0" "Arabic_waw\0"
+  "Arabic_alefmaksura\0" "Arabic_yeh\0" "Arabic_fathatan\0" "Arabic_dammatan\0"
+  "Arabic_kasratan\0" "Arabic_fatha\0" "Arabic_damma\0" "Arabic_kasra\0"
+  "Arabic_shadda\0" "Arabic_sukun\0" "Arabic_madda_above\0" "Arabic_hamza_above\0"
+  "Arabic_hamza_below\0" "Arabic_jeh\0" "Arabic_veh\0" "Arabic_keheh\0"
+  "Arabic_gaf\0" "Arabic_noon_ghunna\0" "Arabic_heh_doachashmee\0" "Farsi_yeh\0"
+  "Arabic_farsi_yeh\0" "Arabic_yeh_baree\0" "Arabic_heh_goal\0" "Arabic_switch\0"
+  "Cyrillic_GHE_bar\0" "Cyrillic_ghe_bar\0" "Cyrillic_ZHE_descender\0" "Cyrillic_zhe_descender\0"
+  "Cyrillic_KA_descender\0" "Cyrillic_ka_descender\0" "Cyrillic_KA_vertstroke\0" "Cyrillic_ka_vertstroke\0"
+  "Cyrillic_EN_descender\0" "Cyrillic_en_descender\0" "Cyrillic_U_straight\0" "Cyrillic_u_straight\0"
+  "Cyrillic_U_straight_bar\0" "Cyrillic_u_straight_bar\0" "Cyrillic_HA_descender\0" "Cyrillic_ha_descender\0"
+  "Cyrillic_CHE_descender\0" "Cyrillic_che_descender\0" "Cyrillic_CHE_vertstroke\0" "Cyrillic_che_vertstroke\0"
+  "Cyrillic_SHHA\0" "Cyrillic_shha\0" "Cyrillic_SCHWA\0" "Cyrillic_schwa\0"
+  "Cyrillic_I_macron\0" "Cyrillic_i_macron\0" "Cyrillic_O_bar\0" "Cyrillic_o_bar\0"
+  "Cyrillic_U_macron\0" "Cyrillic_u_macron\0" "Serbian_dje\0" "Macedonia_gje\0"
+  "Cyrillic_io\0" "Ukrainian_ie\0" "Ukranian_je\0" "Macedonia_dse\0"
+  "Ukrainian_i\0" "Ukranian_i\0" "Ukrainian_yi\0" "Ukranian_yi\0"
+  "Cyrillic_je\0" "Serbian_je\0" "Cyrillic_lje\0" "Serbian_lje\0"
+  "Cyrillic_nje\0" "Serbian_nje\0" "Serbian_tshe\0" "Macedonia_kje\0"
+  "Ukrainian_ghe_with_upturn\0" "Byelorussian_shortu\0" "Cyrillic_dzhe\0" "Serbian_dze\0"
+  "numerosign\0" "Serbian_DJE\0" "Macedonia_GJE\0" "Cyrillic_IO\0"
+  "Ukrainian_IE\0" "Ukranian_JE\0" "Macedonia_DSE\0" "Ukrainian_I\0"
+  "Ukranian_I\0" "Ukrainian_YI\0" "Ukranian_YI\0" "Cyrillic_JE\0"
+  "Serbian_JE\0" "Cyrillic_LJE\0" "Serbian_LJE\0" "Cyrillic_NJE\0"
+  "Serbian_NJE\0" "Serbian_TSHE\0" "Macedonia_KJE\0" "Ukrainian_GHE_WITH_UPTURN\0"
+  "Byelorussian_SHORTU\0" "Cyrillic_DZHE\0" "Serbian_DZE\0" "Cyrillic_yu\0"
+  "Cyrillic_a\0" "Cyrillic_be\0" "Cyrillic_tse\0" "Cyrillic_de\0"
+  "Cyrillic_ie\0" "Cyrillic_ef\0" "Cyrillic_ghe\0" "Cyrillic_ha\0"
+  "Cyrillic_i\0" "Cyrillic_shorti\0" "Cyrillic_ka\0" "Cyrillic_el\0"
+  "Cyrillic_em\0" "Cyrillic_en\0" "Cyrillic_o\0" "Cyrillic_pe\0"
+  "Cyrillic_ya\0" "Cyrillic_er\0" "Cyrillic_es\0" "Cyrillic_te\0"
+  "Cyrillic_u\0" "Cyrillic_zhe\0" "Cyrillic_ve\0" "Cyrillic_softsign\0"
+  "Cyrillic_yeru\0" "Cyrillic_ze\0" "Cyrillic_sha\0" "Cyrillic_e\0"
+  "Cyrillic_shcha\0" "Cyrillic_che\0" "Cyrillic_hardsign\0" "Cyrillic_YU\0"
+  "Cyrillic_A\0" "Cyrillic_BE\0" "Cyrillic_TSE\0" "Cyrillic_DE\0"
+  "Cyrillic_IE\0" "Cyrillic_EF\0" "Cyrillic_GHE\0" "Cyrillic_HA\0"
+  "Cyrillic_I\0" "Cyrillic_SHORTI\0" "Cyrillic_KA\0" "Cyrillic_EL\0"
+  "Cyrillic_EM\0" "Cyrillic_EN\0" "Cyrillic_O\0" "Cyrillic_PE\0"
+  "Cyrillic_YA\0" "Cyrillic_ER\0" "Cyrillic_ES\0" "Cyrillic_TE\0"
+  "Cyrillic_U\0" "Cyrillic_ZHE\0" "Cyrillic_VE\0" "Cyrillic_SOFTSIGN\0"
+  "Cyrillic_YERU\0" "Cyrillic_ZE\0" "Cyrillic_SHA\0" "Cyrillic_E\0"
+  "Cyrillic_SHCHA\0" "Cyrillic_CHE\0" "Cyrillic_HARDSIGN\0" "Greek_ALPHAaccent\0"
+  "Greek_EPSILONaccent\0" "Greek_ETAaccent\0" "Greek_IOTAaccent\0" "Greek_IOTAdieresis\0"
+  "Greek_IOTAdiaeresis\0" "Greek_OMICRONaccent\0" "Greek_UPSILONaccent\0" "Greek_UPSILONdieresis\0"
+  "Greek_OMEGAaccent\0" "Greek_accentdieresis\0" "Greek_horizbar\0" "Greek_alphaaccent\0"
+  "Greek_epsilonaccent\0" "Greek_etaaccent\0" "Greek_iotaaccent\0" "Greek_iotadieresis\0"
+  "Greek_iotaaccentdieresis\0" "Greek_omicronaccent\0" "Greek_upsilonaccent\0" "Greek_upsilondieresis\0"
+  "Greek_upsilonaccentdieresis\0" "Greek_omegaaccent\0" "Greek_ALPHA\0" "Greek_BETA\0"
+  "Greek_GAMMA\0" "Greek_DELTA\0" "Greek_EPSILON\0" "Greek_ZETA\0"
+  "Greek_ETA\0" "Greek_THETA\0" "Greek_IOTA\0" "Greek_KAPPA\0"
+  "Greek_LAMDA\0" "Greek_LAMBDA\0" "Greek_MU\0" "Greek_NU\0"
+  "Greek_XI\0" "Greek_OMICRON\0" "Greek_PI\0" "Greek_RHO\0"
+  "Greek_SIGMA\0" "Greek_TAU\0" "Greek_UPSILON\0" "Greek_PHI\0"
+  "Greek_CHI\0" "Greek_PSI\0" "Greek_OMEGA\0" "Greek_alpha\0"
+  "Greek_beta\0" "Greek_gamma\0" "Greek_delta\0" "Greek_epsilon\0"
+  "Greek_zeta\0" "Greek_eta\0" "Greek_theta\0" "Greek_iota\0"
+  "Greek_kappa\0" "Greek_lamda\0" "Greek_lambda\0" "Greek_mu\0"
+  "Greek_nu\0" "Greek_xi\0" "Greek_omicron\0" "Greek_pi\0"
+  "Greek_rho\0" "Greek_sigma\0" "Greek_finalsmallsigma\0" "Greek_tau\0"
+  "Greek_upsilon\0" "Greek_phi\0" "Greek_chi\0" "Greek_psi\0"
+  "Greek_omega\0" "Greek_switch\0" "leftradical\0" "topleftradical\0"
+  "horizconnector\0" "topintegral\0" "botintegral\0" "vertconnector\0"
+  "topleftsqbracket\0" "botleftsqbracket\0" "toprightsqbracket\0" "botrightsqbracket\0"
+  "topleftparens\0" "botleftparens\0" "toprightparens\0" "botrightparens\0"
+  "leftmiddlecurlybrace\0" "rightmiddlecurlybrace\0" "topleftsummation\0" "botleftsummation\0"
+  "topvertsummationconnector\0" "botvertsummationconnector\0" "toprightsummation\0" "botrightsummation\0"
+  "rightmiddlesummation\0" "lessthanequal\0" "notequal\0" "greaterthanequal\0"
+  "integral\0" "therefore\0" "variation\0" "infinity\0"
+  "nabla\0" "approximate\0" "similarequal\0" "ifonlyif\0"
+  "implies\0" "identical\0" "radical\0" "includedin\0"
+  "includes\0" "intersection\0" "union\0" "logicaland\0"
+  "logicalor\0" "partialderivative\0" "function\0" "leftarrow\0"
+  "uparrow\0" "rightarrow\0" "downarrow\0" "blank\0"
+  "soliddiamond\0" "checkerboard\0" "ht\0" "ff\0"
+  "cr\0" "lf\0" "nl\0" "vt\0"
+  "lowrightcorner\0" "uprightcorner\0" "upleftcorner\0" "lowleftcorner\0"
+  "crossinglines\0" "horizlinescan1\0" "horizlinescan3\0" "horizlinescan5\0"
+  "horizlinescan7\0" "horizlinescan9\0" "leftt\0" "rightt\0"
+  "bott\0" "topt\0" "vertbar\0" "emspace\0"
+  "enspace\0" "em3space\0" "em4space\0" "digitspace\0"
+  "punctspace\0" "thinspace\0" "hairspace\0" "emdash\0"
+  "endash\0" "signifblank\0" "ellipsis\0" "doubbaselinedot\0"
+  "onethird\0" "twothirds\0" "onefifth\0" "twofifths\0"
+  "threefifths\0" "fourfifths\0" "onesixth\0" "fivesixths\0"
+  "careof\0" "figdash\0" "leftanglebracket\0" "decimalpoint\0"
+  "rightanglebracket\0" "marker\0" "oneeighth\0" "threeeighths\0"
+  "fiveeighths\0" "seveneighths\0" "trademark\0" "signaturemark\0"
+  "trademarkincircle\0" "leftopentriangle\0" "rightopentriangle\0" "emopencircle\0"
+  "emopenrectangle\0" "leftsinglequotemark\0" "rightsinglequotemark\0" "leftdoublequotemark\0"
+  "rightdoublequotemark\0" "prescription\0" "permille\0" "minutes\0"
+  "seconds\0" "latincross\0" "hexagram\0" "filledrectbullet\0"
+  "filledlefttribullet\0" "filledrighttribullet\0" "emfilledcircle\0" "emfilledrect\0"
+  "enopencircbullet\0" "enopensquarebullet\0" "openrectbullet\0" "opentribulletup\0"
+  "opentribulletdown\0" "openstar\0" "enfilledcircbullet\0" "enfilledsqbullet\0"
+  "filledtribulletup\0" "filledtribulletdown\0" "leftpointer\0" "rightpointer\0"
+  "club\0" "diamond\0" "heart\0" "maltesecross\0"
+  "dagger\0" "doubledagger\0" "checkmark\0" "ballotcross\0"
+  "musicalsharp\0" "musicalflat\0" "malesymbol\0" "femalesymbol\0"
+  "telephone\0" "telephonerecorder\0" "phonographcopyright\0" "caret\0"
+  "singlelowquotemark\0" "doublelowquotemark\0" "cursor\0" "leftcaret\0"
+  "rightcaret\0" "downcaret\0" "upcaret\0" "overbar\0"
+  "downtack\0" "upshoe\0" "downstile\0" "underbar\0"
+  "jot\0" "quad\0" "uptack\0" "circle\0"
+  "upstile\0" "downshoe\0" "rightshoe\0" "leftshoe\0"
+  "lefttack\0" "righttack\0" "hebrew_doublelowline\0" "hebrew_aleph\0"
+  "hebrew_bet\0" "hebrew_beth\0" "hebrew_gimel\0" "hebrew_gimmel\0"
+  "hebrew_dalet\0" "hebrew_daleth\0" "hebrew_he\0" "hebrew_waw\0"
+  "hebrew_zain\0" "hebrew_zayin\0" "hebrew_chet\0" "hebrew_het\0"
+  "hebrew_tet\0" "hebrew_teth\0" "hebrew_yod\0" "hebrew_finalkaph\0"
+  "hebrew_kaph\0" "hebrew_lamed\0" "hebrew_finalmem\0" "hebrew_mem\0"
+  "hebrew_finalnun\0" "hebrew_nun\0" "hebrew_samech\0" "hebrew_samekh\0"
+  "hebrew_ayin\0" "hebrew_finalpe\0" "hebrew_pe\0" "hebrew_finalzade\0"
+  "hebrew_finalzadi\0" "hebrew_zade\0" "hebrew_zadi\0" "hebrew_qoph\0"
+  "hebrew_kuf\0" "hebrew_resh\0" "hebrew_shin\0" "hebrew_taw\0"
+  "hebrew_taf\0" "Hebrew_switch\0" "Thai_kokai\0" "Thai_khokhai\0"
+  "Thai_khokhuat\0" "Thai_khokhwai\0" "Thai_khokhon\0" "Thai_khorakhang\0"
+  "Thai_ngongu\0" "Thai_chochan\0" "Thai_choching\0" "Thai_chochang\0"
+  "Thai_soso\0" "Thai_chochoe\0" "Thai_yoying\0" "Thai_dochada\0"
+  "Thai_topatak\0" "Thai_thothan\0" "Thai_thonangmontho\0" "Thai_thophuthao\0"
+  "Thai_nonen\0" "Thai_dodek\0" "Thai_totao\0" "Thai_thothung\0"
+  "Thai_thothahan\0" "Thai_thothong\0" "Thai_nonu\0" "Thai_bobaimai\0"
+  "Thai_popla\0" "Thai_phophung\0" "Thai_fofa\0" "Thai_phophan\0"
+  "Thai_fofan\0" "Thai_phosamphao\0" "Thai_moma\0" "Thai_yoyak\0"
+  "Thai_rorua\0" "Thai_ru\0" "Thai_loling\0" "Thai_lu\0"
+  "Thai_wowaen\0" "Thai_sosala\0" "Thai_sorusi\0" "Thai_sosua\0"
+  "Thai_hohip\0" "Thai_lochula\0" "Thai_oang\0" "Thai_honokhuk\0"
+  "Thai_paiyannoi\0" "Thai_saraa\0" "Thai_maihanakat\0" "Thai_saraaa\0"
+  "Thai_saraam\0" "Thai_sarai\0" "Thai_saraii\0" "Thai_saraue\0"
+  "Thai_sarauee\0" "Thai_sarau\0" "Thai_sarauu\0" "Thai_phinthu\0"
+  "Thai_maihanakat_maitho\0" "Thai_baht\0" "Thai_sarae\0" "Thai_saraae\0"
+  "Thai_sarao\0" "Thai_saraaimaimuan\0" "Thai_saraaimaimalai\0" "Thai_lakkhangyao\0"
+  "Thai_maiyamok\0" "Thai_maitaikhu\0" "Thai_maiek\0" "Thai_maitho\0"
+  "Thai_maitri\0" "Thai_maichattawa\0" "Thai_thanthakhat\0" "Thai_nikhahit\0"
+  "Thai_leksun\0" "Thai_leknung\0" "Thai_leksong\0" "Thai_leksam\0"
+  "Thai_leksi\0" "Thai_lekha\0" "Thai_lekhok\0" "Thai_lekchet\0"
+  "Thai_lekpaet\0" "Thai_lekkao\0" "Hangul\0" "Hangul_Start\0"
+  "Hangul_End\0" "Hangul_Hanja\0" "Hangul_Jamo\0" "Hangul_Romaja\0"
+  "Hangul_Codeinput\0" "Hangul_Jeonja\0" "Hangul_Banja\0" "Hangul_PreHanja\0"
+  "Hangul_PostHanja\0" "Hangul_SingleCandidate\0" "Hangul_MultipleCandidate\0" "Hangul_PreviousCandidate\0"
+  "Hangul_Special\0" "Hangul_switch\0" "Hangul_Kiyeog\0" "Hangul_SsangKiyeog\0"
+  "Hangul_KiyeogSios\0" "Hangul_Nieun\0" "Hangul_NieunJieuj\0" "Hangul_NieunHieuh\0"
+  "Hangul_Dikeud\0" "Hangul_SsangDikeud\0" "Hangul_Rieul\0" "Hangul_RieulKiyeog\0"
+  "Hangul_RieulMieum\0" "Hangul_RieulPieub\0" "Hangul_RieulSios\0" "Hangul_RieulTieut\0"
+  "Hangul_RieulPhieuf\0" "Hangul_RieulHieuh\0" "Hangul_Mieum\0" "Hangul_Pieub\0"
+  "Hangul_SsangPieub\0" "Hangul_PieubSios\0" "Hangul_Sios\0" "Hangul_SsangSios\0"
+  "Hangul_Ieung\0" "Hangul_Jieuj\0" "Hangul_SsangJieuj\0" "Hangul_Cieuc\0"
+  "Hangul_Khieuq\0" "Hangul_Tieut\0" "Hangul_Phieuf\0" "Hangul_Hieuh\0"
+  "Hangul_A\0" "Hangul_AE\0" "Hangul_YA\0" "Hangul_YAE\0"
+  "Hangul_EO\0" "Hangul_E\0" "Hangul_YEO\0" "Hangul_YE\0"
+  "Hangul_O\0" "Hangul_WA\0" "Hangul_WAE\0" "Hangul_OE\0"
+  "Hangul_YO\0" "Hangul_U\0" "Hangul_WEO\0" "Hangul_WE\0"
+  "Hangul_WI\0" "Hangul_YU\0" "Hangul_EU\0" "Hangul_YI\0"
+  "Hangul_I\0" "Hangul_J_Kiyeog\0" "Hangul_J_SsangKiyeog\0" "Hangul_J_KiyeogSios\0"
+  "Hangul_J_Nieun\0" "Hangul_J_NieunJieuj\0" "Hangul_J_NieunHieuh\0" "Hangul_J_Dikeud\0"
+  "Hangul_J_Rieul\0" "Hangul_J_RieulKiyeog\0" "Hangul_J_RieulMieum\0" "Hangul_J_RieulPieub\0"
+  "Hangul_J_RieulSios\0" "Hangul_J_RieulTieut\0" "Hangul_J_RieulPhieuf\0" "Hangul_J_RieulHieuh\0"
+  "Hangul_J_Mieum\0" "Hangul_J_Pieub\0" "Hangul_J_PieubSios\0" "Hangul_J_Sios\0"
+  "Hangul_J_SsangSios\0" "Hangul_J_Ieung\0" "Hangul_J_Jieuj\0" "Hangul_J_Cieuc\0"
+  "Hangul_J_Khieuq\0" "Hangul_J_Tieut\0" "Hangul_J_Phieuf\0" "Hangul_J_Hieuh\0"
+  "Hangul_RieulYeorinHieuh\0" "Hangul_SunkyeongeumMieum\0" "Hangul_SunkyeongeumPieub\0" "Hangul_PanSios\0"
+  "Hangul_KkogjiDalrinIeung\0" "Hangul_SunkyeongeumPhieuf\0" "Hangul_YeorinHieuh\0" "Hangul_AraeA\0"
+  "Hangul_AraeAE\0" "Hangul_J_PanSios\0" "Hangul_J_KkogjiDalrinIeung\0" "Hangul_J_YeorinHieuh\0"
+  "Korean_Won\0" "Armenian_ligature_ew\0" "Armenian_full_stop\0" "Armenian_verjaket\0"
+  "Armenian_separation_mark\0" "Armenian_but\0" "Armenian_hyphen\0" "Armenian_yentamna\0"
+  "Armenian_exclam\0" "Armenian_amanak\0" "Armenian_accent\0" "Armenian_shesht\0"
+  "Armenian_question\0" "Armenian_paruyk\0" "Armenian_AYB\0" "Armenian_ayb\0"
+  "Armenian_BEN\0" "Armenian_ben\0" "Armenian_GIM\0" "Armenian_gim\0"
+  "Armenian_DA\0" "Armenian_da\0" "Armenian_YECH\0" "Armenian_yech\0"
+  "Armenian_ZA\0" "Armenian_za\0" "Armenian_E\0" "Armenian_e\0"
+  "Armenian_AT\0" "Armenian_at\0" "Armenian_TO\0" "Armenian_to\0"
+  "Armenian_ZHE\0" "Armenian_zhe\0" "Armenian_INI\0" "Armenian_ini\0"
+  "Armenian_LYUN\0" "Armenian_lyun\0" "Armenian_KHE\0" "Armenian_khe\0"
+  "Armenian_TSA\0" "Armenian_tsa\0" "Armenian_KEN\0" "Armenian_ken\0"
+  "Armenian_HO\0" "Armenian_ho\0" "Armenian_DZA\0" "Armenian_dza\0"
+  "Armenian_GHAT\0" "Armenian_ghat\0" "Armenian_TCHE\0" "Armenian_tche\0"
+  "Armenian_MEN\0" "Armenian_men\0" "Armenian_HI\0" "Armenian_hi\0"
+  "Armenian_NU\0" "Armenian_nu\0" "Armenian_SHA\0" "Armenian_sha\0"
+  "Armenian_VO\0" "Armenian_vo\0" "Armenian_CHA\0" "Armenian_cha\0"
+  "Armenian_PE\0" "Armenian_pe\0" "Armenian_JE\0" "Armenian_je\0"
+  "Armenian_RA\0" "Armenian_ra\0" "Armenian_SE\0" "Armenian_se\0"
+  "Armenian_VEV\0" "Armenian_vev\0" "Armenian_TYUN\0" "Armenian_tyun\0"
+  "Armenian_RE\0" "Armenian_re\0" "Armenian_TSO\0" "Armenian_tso\0"
+  "Armenian_VYUN\0" "Armenian_vyun\0" "Armenian_PYUR\0" "Armenian_pyur\0"
+  "Armenian_KE\0" "Armenian_ke\0" "Armenian_O\0" "Armenian_o\0"
+  "Armenian_FE\0" "Armenian_fe\0" "Armenian_apostrophe\0" "Georgian_an\0"
+  "Georgian_ban\0" "Georgian_gan\0" "Georgian_don\0" "Georgian_en\0"
+  "Georgian_vin\0" "Georgian_zen\0" "Georgian_tan\0" "Georgian_in\0"
+  "Georgian_kan\0" "Georgian_las\0" "Georgian_man\0" "Georgian_nar\0"
+  "Georgian_on\0" "Georgian_par\0" "Georgian_zhar\0" "Georgian_rae\0"
+  "Georgian_san\0" "Georgian_tar\0" "Georgian_un\0" "Georgian_phar\0"
+  "Georgian_khar\0" "Georgian_ghan\0" "Georgian_qar\0" "Georgian_shin\0"
+  "Georgian_chin\0" "Georgian_can\0" "Georgian_jil\0" "Georgian_cil\0"
+  "Georgian_char\0" "Georgian_xan\0" "Georgian_jhan\0" "Georgian_hae\0"
+  "Georgian_he\0" "Georgian_hie\0" "Georgian_we\0" "Georgian_har\0"
+  "Georgian_hoe\0" "Georgian_fi\0" "Xabovedot\0" "Ibreve\0"
+  "Zstroke\0" "Gcaron\0" "Ocaron\0" "Obarred\0"
+  "xabovedot\0" "ibreve\0" "zstroke\0" "gcaron\0"
+  "ocaron\0" "obarred\0" "SCHWA\0" "schwa\0"
+  "EZH\0" "ezh\0" "Lbelowdot\0" "lbelowdot\0"
+  "Abelowdot\0" "abelowdot\0" "Ahook\0" "ahook\0"
+  "Acircumflexacute\0" "acircumflexacute\0" "Acircumflexgrave\0" "acircumflexgrave\0"
+  "Acircumflexhook\0" "acircumflexhook\0" "Acircumflextilde\0" "acircumflextilde\0"
+  "Acircumflexbelowdot\0" "acircumflexbelowdot\0" "Abreveacute\0" "abreveacute\0"
+  "Abrevegrave\0" "abrevegrave\0" "Abrevehook\0" "abrevehook\0"
+  "Abrevetilde\0" "abrevetilde\0" "Abrevebelowdot\0" "abrevebelowdot\0"
+  "Ebelowdot\0" "ebelowdot\0" "Ehook\0" "ehook\0"
+  "Etilde\0" "etilde\0" "Ecircumflexacute\0" "ecircumflexacute\0"
+  "Ecircumflexgrave\0" "ecircumflexgrave\0" "Ecircumflexhook\0" "ecircumflexhook\0"
+  "Ecircumflextilde\0" "ecircumflextilde\0" "Ecircumflexbelowdot\0" "ecircumflexbelowdot\0"
+  "Ihook\0" "ihook\0" "Ibelowdot\0" "ibelowdot\0"
+  "Obelowdot\0" "obelowdot\0" "Ohook\0" "ohook\0"
+  "Ocircumflexacute\0" "ocircumflexacute\0" "Ocircumflexgrave\0" "ocircumflexgrave\0"
+  "Ocircumflexhook\0" "ocircumflexhook\0" "Ocircumflextilde\0" "ocircumflextilde\0"
+  "Ocircumflexbelowdot\0" "ocircumflexbelowdot\0" "Ohornacute\0" "ohornacute\0"
+  "Ohorngrave\0" "ohorngrave\0" "Ohornhook\0" "ohornhook\0"
+  "Ohorntilde\0" "ohorntilde\0" "Ohornbelowdot\0" "ohornbelowdot\0"
+  "Ubelowdot\0" "ubelowdot\0" "Uhook\0" "uhook\0"
+  "Uhornacute\0" "uhornacute\0" "Uhorngrave\0" "uhorngrave\0"
+  "Uhornhook\0" "uhornhook\0" "Uhorntilde\0" "uhorntilde\0"
+  "Uhornbelowdot\0" "uhornbelowdot\0" "Ybelowdot\0" "ybelowdot\0"
+  "Yhook\0" "yhook\0" "Ytilde\0" "ytilde\0"
+  "Ohorn\0" "ohorn\0" "Uhorn\0" "uhorn\0"
+  "combining_tilde\0" "combining_grave\0" "combining_acute\0" "combining_hook\0"
+  "combining_belowdot\0" "EcuSign\0" "ColonSign\0" "CruzeiroSign\0"
+  "FFrancSign\0" "LiraSign\0" "MillSign\0" "NairaSign\0"
+  "PesetaSign\0" "RupeeSign\0" "WonSign\0" "NewSheqelSign\0"
+  "DongSign\0" "EuroSign\0" "zerosuperior\0" "foursuperior\0"
+  "fivesuperior\0" "sixsuperior\0" "sevensuperior\0" "eightsuperior\0"
+  "ninesuperior\0" "zerosubscript\0" "onesubscript\0" "twosubscript\0"
+  "threesubscript\0" "foursubscript\0" "fivesubscript\0" "sixsubscript\0"
+  "sevensubscript\0" "eightsubscript\0" "ninesubscript\0" "partdifferential\0"
+  "emptyset\0" "elementof\0" "notelementof\0" "containsas\0"
+  "squareroot\0" "cuberoot\0" "fourthroot\0" "dintegral\0"
+  "tintegral\0" "because\0" "approxeq\0" "notapproxeq\0"
+  "notidentical\0" "stricteq\0" "braille_dot_1\0" "braille_dot_2\0"
+  "braille_dot_3\0" "braille_dot_4\0" "braille_dot_5\0" "braille_dot_6\0"
+  "braille_dot_7\0" "braille_dot_8\0" "braille_dot_9\0" "braille_dot_10\0"
+  "braille_blank\0" "braille_dots_1\0" "braille_dots_2\0" "braille_dots_12\0"
+  "braille_dots_3\0" "braille_dots_13\0" "braille_dots_23\0" "braille_dots_123\0"
+  "braille_dots_4\0" "braille_dots_14\0" "braille_dots_24\0" "braille_dots_124\0"
+  "braille_dots_34\0" "braille_dots_134\0" "braille_dots_234\0" "braille_dots_1234\0"
+  "braille_dots_5\0" "braille_dots_15\0" "braille_dots_25\0" "braille_dots_125\0"
+  "braille_dots_35\0" "braille_dots_135\0" "braille_dots_235\0" "braille_dots_1235\0"
+  "braille_dots_45\0" "braille_dots_145\0" "braille_dots_245\0" "braille_dots_1245\0"
+  "braille_dots_345\0" "braille_dots_1345\0" "braille_dots_2345\0" "braille_dots_12345\0"
+  "braille_dots_6\0" "braille_dots_16\0" "braille_dots_26\0" "braille_dots_126\0"
+  "braille_dots_36\0" "braille_dots_136\0" "braille_dots_236\0" "braille_dots_1236\0"
+  "braille_dots_46\0" "braille_dots_146\0" "braille_dots_246\0" "braille_dots_1246\0"
+  "braille_dots_346\0" "braille_dots_1346\0" "braille_dots_2346\0" "braille_dots_12346\0"
+  "braille_dots_56\0" "braille_dots_156\0" "braille_dots_256\0" "braille_dots_1256\0"
+  "braille_dots_356\0" "braille_dots_1356\0" "braille_dots_2356\0" "braille_dots_12356\0"
+  "braille_dots_456\0" "braille_dots_1456\0" "braille_dots_2456\0" "braille_dots_12456\0"
+  "braille_dots_3456\0" "braille_dots_13456\0" "braille_dots_23456\0" "braille_dots_123456\0"
+  "braille_dots_7\0" "braille_dots_17\0" "braille_dots_27\0" "braille_dots_127\0"
+  "braille_dots_37\0" "braille_dots_137\0" "braille_dots_237\0" "braille_dots_1237\0"
+  "braille_dots_47\0" "braille_dots_147\0" "braille_dots_247\0" "braille_dots_1247\0"
+  "braille_dots_347\0" "braille_dots_1347\0" "braille_dots_2347\0" "braille_dots_12347\0"
+  "braille_dots_57\0" "braille_dots_157\0" "braille_dots_257\0" "braille_dots_1257\0"
+  "braille_dots_357\0" "braille_dots_1357\0" "braille_dots_2357\0" "braille_dots_12357\0"
+  "braille_dots_457\0" "braille_dots_1457\0" "braille_dots_2457\0" "braille_dots_12457\0"
+  "braille_dots_3457\0" "braille_dots_13457\0" "braille_dots_23457\0" "braille_dots_123457\0"
+  "braille_dots_67\0" "braille_dots_167\0" "braille_dots_267\0" "braille_dots_1267\0"
+  "braille_dots_367\0" "braille_dots_1367\0" "braille_dots_2367\0" "braille_dots_12367\0"
+  "braille_dots_467\0" "braille_dots_1467\0" "braille_dots_2467\0" "braille_dots_12467\0"
+  "braille_dots_3467\0" "braille_dots_13467\0" "braille_dots_23467\0" "braille_dots_123467\0"
+  "braille_dots_567\0" "braille_dots_1567\0" "braille_dots_2567\0" "braille_dots_12567\0"
+  "braille_dots_3567\0" "braille_dots_13567\0" "braille_dots_23567\0" "braille_dots_123567\0"
+  "braille_dots_4567\0" "braille_dots_14567\0" "braille_dots_24567\0" "braille_dots_124567\0"
+  "braille_dots_34567\0" "braille_dots_134567\0" "braille_dots_234567\0" "braille_dots_1234567\0"
+  "braille_dots_8\0" "braille_dots_18\0" "braille_dots_28\0" "braille_dots_128\0"
+  "braille_dots_38\0" "braille_dots_138\0" "braille_dots_238\0" "braille_dots_1238\0"
+  "braille_dots_48\0" "braille_dots_148\0" "braille_dots_248\0" "braille_dots_1248\0"
+  "braille_dots_348\0" "braille_dots_1348\0" "braille_dots_2348\0" "braille_dots_12348\0"
+  "braille_dots_58\0" "braille_dots_158\0" "braille_dots_258\0" "braille_dots_1258\0"
+  "braille_dots_358\0" "braille_dots_1358\0" "braille_dots_2358\0" "braille_dots_12358\0"
+  "braille_dots_458\0" "braille_dots_1458\0" "braille_dots_2458\0" "braille_dots_12458\0"
+  "braille_dots_3458\0" "braille_dots_13458\0" "braille_dots_23458\0" "braille_dots_123458\0"
+  "braille_dots_68\0" "braille_dots_168\0" "braille_dots_268\0" "braille_dots_1268\0"
+  "braille_dots_368\0" "braille_dots_1368\0" "braille_dots_2368\0" "braille_dots_12368\0"
+  "braille_dots_468\0" "braille_dots_1468\0" "braille_dots_2468\0" "braille_dots_12468\0"
+  "braille_dots_3468\0" "braille_dots_13468\0" "braille_dots_23468\0" "braille_dots_123468\0"
+  "braille_dots_568\0" "braille_dots_1568\0" "braille_dots_2568\0" "braille_dots_12568\0"
+  "braille_dots_3568\0" "braille_dots_13568\0" "braille_dots_23568\0" "braille_dots_123568\0"
+  "braille_dots_4568\0" "braille_dots_14568\0" "braille_dots_24568\0" "braille_dots_124568\0"
+  "braille_dots_34568\0" "braille_dots_134568\0" "braille_dots_234568\0" "braille_dots_1234568\0"
+  "braille_dots_78\0" "braille_dots_178\0" "braille_dots_278\0" "braille_dots_1278\0"
+  "braille_dots_378\0" "braille_dots_1378\0" "braille_dots_2378\0" "braille_dots_12378\0"
+  "braille_dots_478\0" "braille_dots_1478\0" "braille_dots_2478\0" "braille_dots_12478\0"
+  "braille_dots_3478\0" "braille_dots_13478\0" "braille_dots_23478\0" "braille_dots_123478\0"
+  "braille_dots_578\0" "braille_dots_1578\0" "braille_dots_2578\0" "braille_dots_12578\0"
+  "braille_dots_3578\0" "braille_dots_13578\0" "braille_dots_23578\0" "braille_dots_123578\0"
+  "braille_dots_4578\0" "braille_dots_14578\0" "braille_dots_24578\0" "braille_dots_124578\0"
+  "braille_dots_34578\0" "braille_dots_134578\0" "braille_dots_234578\0" "braille_dots_1234578\0"
+  "braille_dots_678\0" "braille_dots_1678\0" "braille_dots_2678\0" "braille_dots_12678\0"
+  "braille_dots_3678\0" "braille_dots_13678\0" "braille_dots_23678\0" "braille_dots_123678\0"
+  "braille_dots_4678\0" "braille_dots_14678\0" "braille_dots_24678\0" "braille_dots_124678\0"
+  "braille_dots_34678\0" "braille_dots_134678\0" "braille_dots_234678\0" "braille_dots_1234678\0"
+  "braille_dots_5678\0" "braille_dots_15678\0" "braille_dots_25678\0" "braille_dots_125678\0"
+  "braille_dots_35678\0" "braille_dots_135678\0" "braille_dots_235678\0" "braille_dots_1235678\0"
+  "braille_dots_45678\0" "braille_dots_145678\0" "braille_dots_245678\0" "braille_dots_1245678\0"
+  "braille_dots_345678\0" "braille_dots_1345678\0" "braille_dots_2345678\0" "braille_dots_12345678\0"
+  "Sinh_ng\0" "Sinh_h2\0" "Sinh_a\0" "Sinh_aa\0"
+  "Sinh_ae\0" "Sinh_aee\0" "Sinh_i\0" "Sinh_ii\0"
+  "Sinh_u\0" "Sinh_uu\0" "Sinh_ri\0" "Sinh_rii\0"
+  "Sinh_lu\0" "Sinh_luu\0" "Sinh_e\0" "Sinh_ee\0"
+  "Sinh_ai\0" "Sinh_o\0" "Sinh_oo\0" "Sinh_au\0"
+  "Sinh_ka\0" "Sinh_kha\0" "Sinh_ga\0" "Sinh_gha\0"
+  "Sinh_ng2\0" "Sinh_nga\0" "Sinh_ca\0" "Sinh_cha\0"
+  "Sinh_ja\0" "Sinh_jha\0" "Sinh_nya\0" "Sinh_jnya\0"
+  "Sinh_nja\0" "Sinh_tta\0" "Sinh_ttha\0" "Sinh_dda\0"
+  "Sinh_ddha\0" "Sinh_nna\0" "Sinh_ndda\0" "Sinh_tha\0"
+  "Sinh_thha\0" "Sinh_dha\0" "Sinh_dhha\0" "Sinh_na\0"
+  "Sinh_ndha\0" "Sinh_pa\0" "Sinh_pha\0" "Sinh_ba\0"
+  "Sinh_bha\0" "Sinh_ma\0" "Sinh_mba\0" "Sinh_ya\0"
+  "Sinh_ra\0" "Sinh_la\0" "Sinh_va\0" "Sinh_sha\0"
+  "Sinh_ssha\0" "Sinh_sa\0" "Sinh_ha\0" "Sinh_lla\0"
+  "Sinh_fa\0" "Sinh_al\0" "Sinh_aa2\0" "Sinh_ae2\0"
+  "Sinh_aee2\0" "Sinh_i2\0" "Sinh_ii2\0" "Sinh_u2\0"
+  "Sinh_uu2\0" "Sinh_ru2\0" "Sinh_e2\0" "Sinh_ee2\0"
+  "Sinh_ai2\0" "Sinh_o2\0" "Sinh_oo2\0" "Sinh_au2\0"
+  "Sinh_lu2\0" "Sinh_ruu2\0" "Sinh_luu2\0" "Sinh_kunddaliya\0"
+  "XF86ModeLock\0" "XF86MonBrightnessUp\0" "XF86MonBrightnessDown\0" "XF86KbdLightOnOff\0"
+  "XF86KbdBrightnessUp\0" "XF86KbdBrightnessDown\0" "XF86MonBrightnessCycle\0" "XF86Standby\0"
+  "XF86AudioLowerVolume\0" "XF86AudioMute\0" "XF86AudioRaiseVolume\0" "XF86AudioPlay\0"
+  "XF86AudioStop\0" "XF86AudioPrev\0" "XF86AudioNext\0" "XF86HomePage\0"
+  "XF86Mail\0" "XF86Start\0" "XF86Search\0" "XF86AudioRecord\0"
+  "XF86Calculator\0" "XF86Memo\0" "XF86ToDoList\0" "XF86Calendar\0"
+  "XF86PowerDown\0" "XF86ContrastAdjust\0" "XF86RockerUp\0" "XF86RockerDown\0"
+  "XF86RockerEnter\0" "XF86Back\0" "XF86Forward\0" "XF86Stop\0"
+  "XF86Refresh\0" "XF86PowerOff\0" "XF86WakeUp\0" "XF86Eject\0"
+  "XF86ScreenSaver\0" "XF86WWW\0" "XF86Sleep\0" "XF86Favorites\0"
+  "XF86AudioPause\0" "XF86AudioMedia\0" "XF86MyComputer\0" "XF86VendorHome\0"
+  "XF86LightBulb\0" "XF86Shop\0" "XF86History\0" "XF86OpenURL\0"
+  "XF86AddFavorite\0" "XF86HotLinks\0" "XF86BrightnessAdjust\0" "XF86Finance\0"
+  "XF86Community\0" "XF86AudioRewind\0" "XF86BackForward\0" "XF86Launch0\0"
+  "XF86Launch1\0" "XF86Launch2\0" "XF86Launch3\0" "XF86Launch4\0"
+  "XF86Launch5\0" "XF86Launch6\0" "XF86Launch7\0" "XF86Launch8\0"
+  "XF86Launch9\0" "XF86LaunchA\0" "XF86LaunchB\0" "XF86LaunchC\0"
+  "XF86LaunchD\0" "XF86LaunchE\0" "XF86LaunchF\0" "XF86ApplicationLeft\0"
+  "XF86ApplicationRight\0" "XF86Book\0" "XF86CD\0" "XF86Calculater\0"
+  "XF86Clear\0" "XF86Close\0" "XF86Copy\0" "XF86Cut\0"
+  "XF86Display\0" "XF86DOS\0" "XF86Documents\0" "XF86Excel\0"
+  "XF86Explorer\0" "XF86Game\0" "XF86Go\0" "XF86iTouch\0"
+  "XF86LogOff\0" "XF86Market\0" "XF86Meeting\0" "XF86MenuKB\0"
+  "XF86MenuPB\0" "XF86MySites\0" "XF86New\0" "XF86News\0"
+  "XF86OfficeHome\0" "XF86Open\0" "XF86Option\0" "XF86Paste\0"
+  "XF86Phone\0" "XF86Q\0" "XF86Reply\0" "XF86Reload\0"
+  "XF86RotateWindows\0" "XF86RotationPB\0" "XF86RotationKB\0" "XF86Save\0"
+  "XF86ScrollUp\0" "XF86ScrollDown\0" "XF86ScrollClick\0" "XF86Send\0"
+  "XF86Spell\0" "XF86SplitScreen\0" "XF86Support\0" "XF86TaskPane\0"
+  "XF86Terminal\0" "XF86Tools\0" "XF86Travel\0" "XF86UserPB\0"
+  "XF86User1KB\0" "XF86User2KB\0" "XF86Video\0" "XF86WheelButton\0"
+  "XF86Word\0" "XF86Xfer\0" "XF86ZoomIn\0" "XF86ZoomOut\0"
+  "XF86Away\0" "XF86Messenger\0" "XF86WebCam\0" "XF86MailForward\0"
+  "XF86Pictures\0" "XF86Music\0" "XF86Battery\0" "XF86Bluetooth\0"
+  "XF86WLAN\0" "XF86UWB\0" "XF86AudioForward\0" "XF86AudioRepeat\0"
+  "XF86AudioRandomPlay\0" "XF86Subtitle\0" "XF86AudioCycleTrack\0" "XF86CycleAngle\0"
+  "XF86FrameBack\0" "XF86FrameForward\0" "XF86Time\0" "XF86Select\0"
+  "XF86View\0" "XF86TopMenu\0" "XF86Red\0" "XF86Green\0"
+  "XF86Yellow\0" "XF86Blue\0" "XF86Suspend\0" "XF86Hibernate\0"
+  "XF86TouchpadToggle\0" "XF86TouchpadOn\0" "XF86TouchpadOff\0" "XF86AudioMicMute\0"
+  "XF86Keyboard\0" "XF86WWAN\0" "XF86RFKill\0" "XF86AudioPreset\0"
+  "XF86RotationLockToggle\0" "XF86FullScreen\0" "XF86Switch_VT_1\0" "XF86Switch_VT_2\0"
+  "XF86Switch_VT_3\0" "XF86Switch_VT_4\0" "XF86Switch_VT_5\0" "XF86Switch_VT_6\0"
+  "XF86Switch_VT_7\0" "XF86Switch_VT_8\0" "XF86Switch_VT_9\0" "XF86Switch_VT_10\0"
+  "XF86Switch_VT_11\0" "XF86Switch_VT_12\0" "XF86Ungrab\0" "XF86ClearGrab\0"
+  "XF86Next_VMode\0" "XF86Prev_VMode\0" "XF86LogWindowTree\0" "XF86LogGrabInfo\0"
+  "XF86BrightnessAuto\0" "XF86DisplayOff\0" "XF86Info\0" "XF86AspectRatio\0"
+  "XF86DVD\0" "XF86Audio\0" "XF86ChannelUp\0" "XF86ChannelDown\0"
+  "XF86Break\0" "XF86VideoPhone\0" "XF86ZoomReset\0" "XF86Editor\0"
+  "XF86GraphicsEditor\0" "XF86Presentation\0" "XF86Database\0" "XF86Voicemail\0"
+  "XF86Addressbook\0" "XF86DisplayToggle\0" "XF86SpellCheck\0" "XF86ContextMenu\0"
+  "XF86MediaRepeat\0" "XF8610ChannelsUp\0" "XF8610ChannelsDown\0" "XF86Images\0"
+  "XF86NotificationCenter\0" "XF86PickupPhone\0" "XF86HangupPhone\0" "XF86Fn\0"
+  "XF86Fn_Esc\0" "XF86FnRightShift\0" "XF86Numeric0\0" "XF86Numeric1\0"
+  "XF86Numeric2\0" "XF86Numeric3\0" "XF86Numeric4\0" "XF86Numeric5\0"
+  "XF86Numeric6\0" "XF86Numeric7\0" "XF86Numeric8\0" "XF86Numeric9\0"
+  "XF86NumericStar\0" "XF86NumericPound\0" "XF86NumericA\0" "XF86NumericB\0"
+  "XF86NumericC\0" "XF86NumericD\0" "XF86CameraFocus\0" "XF86WPSButton\0"
+  "XF86CameraZoomIn\0" "XF86CameraZoomOut\0" "XF86CameraUp\0" "XF86CameraDown\0"
+  "XF86CameraLeft\0" "XF86CameraRight\0" "XF86AttendantOn\0" "XF86AttendantOff\0"
+  "XF86AttendantToggle\0" "XF86LightsToggle\0" "XF86ALSToggle\0" "XF86Buttonconfig\0"
+  "XF86Taskmanager\0" "XF86Journal\0" "XF86ControlPanel\0" "XF86AppSelect\0"
+  "XF86Screensaver\0" "XF86VoiceCommand\0" "XF86Assistant\0" "XF86EmojiPicker\0"
+  "XF86Dictate\0" "XF86BrightnessMin\0" "XF86BrightnessMax\0" "XF86KbdInputAssistPrev\0"
+  "XF86KbdInputAssistNext\0" "XF86KbdInputAssistPrevgroup\0" "XF86KbdInputAssistNextgroup\0" "XF86KbdInputAssistAccept\0"
+  "XF86KbdInputAssistCancel\0" "XF86RightUp\0" "XF86RightDown\0" "XF86LeftUp\0"
+  "XF86LeftDown\0" "XF86RootMenu\0" "XF86MediaTopMenu\0" "XF86Numeric11\0"
+  "XF86Numeric12\0" "XF86AudioDesc\0" "XF863DMode\0" "XF86NextFavorite\0"
+  "XF86StopRecord\0" "XF86PauseRecord\0" "XF86VOD\0" "XF86Unmute\0"
+  "XF86FastReverse\0" "XF86SlowReverse\0" "XF86Data\0" "XF86OnScreenKeyboard\0"
+  "XF86PrivacyScreenToggle\0" "XF86SelectiveScreenshot\0" "XF86Macro1\0" "XF86Macro2\0"
+  "XF86Macro3\0" "XF86Macro4\0" "XF86Macro5\0" "XF86Macro6\0"
+  "XF86Macro7\0" "XF86Macro8\0" "XF86Macro9\0" "XF86Macro10\0"
+  "XF86Macro11\0" "XF86Macro12\0" "XF86Macro13\0" "XF86Macro14\0"
+  "XF86Macro15\0" "XF86Macro16\0" "XF86Macro17\0" "XF86Macro18\0"
+  "XF86Macro19\0" "XF86Macro20\0" "XF86Macro21\0" "XF86Macro22\0"
+  "XF86Macro23\0" "XF86Macro24\0" "XF86Macro25\0" "XF86Macro26\0"
+  "XF86Macro27\0" "XF86Macro28\0" "XF86Macro29\0" "XF86Macro30\0"
+  "XF86MacroRecordStart\0" "XF86MacroRecordStop\0" "XF86MacroPresetCycle\0" "XF86MacroPreset1\0"
+  "XF86MacroPreset2\0" "XF86MacroPreset3\0" "XF86KbdLcdMenu1\0" "XF86KbdLcdMenu2\0"
+  "XF86KbdLcdMenu3\0" "XF86KbdLcdMenu4\0" "XF86KbdLcdMenu5\0"
+;
+
+#define CIM_KEYSYM_NO_NAME 0xffff
+
+/* names of 0x00 - 0xff by keysym */
+static const uint16_t cim_keysym_latin1_names[256] = {
+  0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
+  0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
+  0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
+  0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
+    3792,  3798,  3805,  3814,  3825,  3832,  3840,  3850,
+    3872,  3882,  3893,  3902,  3907,  3913,  3919,  3926,
+    3932,  3934,  3936,  3938,  3940,  3942,  3944,  3946,
+    3948,  3950,  3952,  3958,  3968,  3973,  3979,  3987,
+    3996,  3999,  4001,  4003,  4005,  4007,  4009,  4011,
+    4013,  4015,  4017,  4019,  4021,  4023,  4025,  4027,
+    4029,  4031,  4033,  4035,  4037,  4039,  4041,  4043,
+    4045,  4047,  4049,  4051,  4063,  4073,  4086,  4098,
+    4109,  4125,  4127,  4129,  4131,  4133,  4135,  4137,
+    4139,  4141,  4143,  4145,  4147,  4149,  4151,  4153,
+    4155,  4157,  4159,  4161,  4163,  4165,  4167,  4169,
+    4171,  4173,  4175,  4177,  4187,  4191,  4202,0xffff,
+  0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
+  0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
+  0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
+  0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,0xffff,
+    4213,  4226,  4237,  4242,  4251,  4260,  4264,  4274,
+    4282,  4292,  4302,  4314,  4328,  4336,  4343,  4354,
+    4361,  4368,  4378,  4390,  4404,  4410,  4413,  4423,
+    4438,  4446,  4458,  4468,  4483,  4494,  4502,  4516,
+    4529,  4536,  4543,  4555,  4562,  4573,  4579,  4582,
+    4591,  4598,  4605,  4617,  4628,  4635,  4642,  4654,
+    4665,  4673,  4680,  4687,  4694,  4706,  4713,  4724,
+    4733,  4749,  4756,  4763,  4775,  4786,  4793,  4805,
+    4812,  4819,  4826,  4838,  4845,  4856,  4862,  4865,
+    4874,  4881,  4888,  4900,  4911,  4918,  4925,  4937,
+    4948,  4952,  4959,  4966,  4973,  4985,  4992,  5003,
+    5012,  5028,  5035,  5042,  5054,  5065,  5072,  5078,
+};
+
+#define CIM_KEYSYM_TO_NAME_N_BUCKETS 536
+#define CIM_KEYSYM_TO_NAME_N_SLOTS   2409
+
+static const uint16_t cim_keysym_to_name_disps[536] = {
+     10,    1,    8,   57,    6,    1,    1,    4,  225,   29,   12,   41,
+     50,    1,    3,    2,    1,    2,   17,   10,    3,   19,    0,    3,
+      2,    3,    0,   30,    1,    1,   26,   41,   16,    2,   12,    1,
+     50,    3,   14,   20,    5,   10,   10,   12,    1,   76,    2,    8,
+      4,    4,   48,    1,   14,    5,   11,   89,   23,    1,    4,    1,
+     23,    4,   19,    0,    6,    4,   19,    4,    2,    1,    7,    3,
+     40,   23,   79,   19,    2,   23,    9,    0,    2,   31,   22,    2,
+     32,    1,    3,    6,   61,   27,   81,   42,    3,   39,    1,   59,
+      8,    5,  120,    7,    9,    1,    2,    7,   19,    9,   31,    3,
+      1,    2,    1,   34,    2,   94,   15,    1,    2,    0,   27,    4,
+      4,    9,   35,   11,   57,   13,    3,   15,    8,    1,    8,   78,
+      2,   11,   20,    1,    6,    1,    2,   38,    2,    1,   73,    0,
+     14,   13,   13,    1,    3,   57,   49,   38,   10,    1,    3,    4,
+     32,    3,    2,    1,    7,   11,   27,   15,    9,   13,    5,    3,
+      2,   17,  266,   40,    1,    3,   15,   76,   82,    1,   17,   21,
+     11,   58,   36,   14,    1,   29,   51,    0,   66,  151,   26,    7,
+      8,   28,    5,    2,    5,   29,   12,   22,    4,   12,   43,    8,
+     84,    2,   24,    7,    8,   18,    0,    2,   50,   19,    2,   21,
+     70,    4,    4,  120,   94,   65,    3,   23,   88,   25,    1,    8,
+      3,    2,    1,    2,    8,    0,    7,   36,   38,    1,   15,   44,
+     17,   65,  126,    2,   23,   14,    4,    9,   29,    6,   14,    8,
+      7,    5,   23,   27,   23,  159,    1,    7,   69,    3,   50,   22,
+     15,    4,    4,   29,   19,    3,    4,   10,  102,    7,    1,    8,
+    356,    9,  168,   10,    8,    7,   15,    2,   26,    7,   22,    7,
+     14,  119,    1,   14,    1,   49,    1,   43,   25,    1,   85,    2,
+      1,   50,    1,    2,   20,   41,   78,    1,    0,   11,    6,   12,
+     16,   30,   51,   16,   27,    1,    4,    1,   16,    4,    3,    3,
+     67,   30,    0,   28,   61,   61,   85,   46,   46,  155,    6,    2,
+     85,    2,   37,   43,  126,    1,  294,   50,    1,    1,   13,    5,
+    198,   17,    2,   14,    5,   23,   13,    9,   88,   25,  108,    1,
+     39,   29,    2,   41,    1,   13,    1,  280,   41,    2,   73,   21,
+     91,   86,   50,   14,  185,   93,  323,    1,   12,   29,   86,    5,
+     24,   23,    3,    2,    0,    7,    2,    9,    0,   96,   58,    6,
+     66,   87,  349,    2,   10,    7,   18,   10,    7,    1,   37,  126,
+     32,    9,   71,    7,   80,    4,  111,   27,   17,   17,    9,   11,
+    220,    1,    7,   22,    5,   38,   23,  212,   64,    1,    1,    5,
+     42,   73,  124,  121,    4,    4,   32,  388,    3,    2,   27,   38,
+      2,  186,   38,   25,   75,    7,  209,   29,   83,    4,   17,  104,
+      0,   17,    7,   42,   12,   39,    5,    3,   41,    9,   99,   10,
+    128,    4,   47,    9,    1,   20,    9,  183,   26,  377,   97,   21,
+     19,  161,    8,  116,  387,  135,    0,   48,   44,    7,    0,  115,
+    119,   10,   26,   57,   14,  349,  226,    4,    1,   88,   23,    2,
+      3,  124,    2,    1,   18,    1,   12,  117,   11,   78,   95,  204,
+     47,   65,   55,  179,    1,    1,    4,   11,   25,   59,   15,   53,
+     22,   80,   51,   85,  204,   17,   14,  503,
+};
+
+static const CimKeysymName cim_keysym_to_name_slots[2409] = {
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000ce2, 13336 },
+  { 0x000006fe, 10081 },
+  { 0x0000ffe7,  1081 },
+  { 0x0000ff3f, 15095 },
+  { 0x000003a2,  5760 },
+  { 0x10081211, 28661 },
+  { 0x00000eec, 16234 },
+  { 0x0000ffd0,   898 },
+  { 0x0000fe08,  1312 },
+  { 0x0100284c, 21549 },
+  { 0x01002851, 21637 },
+  { 0x00000dad, 13952 },
+  { 0x00000aa1, 12046 },
+  { 0x00000dc5, 14253 },
+  { 0x10081299, 29601 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x010028b8, 23497 },
+  { 0x000001c8,  5302 },
+  { 0x0100049a,  8177 },
+  { 0x0000fe09,  1327 },
+  { 0x000007f0, 11024 },
+  { 0x100812a4, 29733 },
+  { 0x0000fe76,  2807 },
+  { 0x00000da9, 13901 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x010001e7, 18333 },
+  { 0x000005c5,  7342 },
+  { 0x000004ae,  6476 },
+  { 0x00000ac6, 12359 },
+  { 0x00000dba, 14124 },
+  { 0x0000fe23,  1503 },
+  { 0x010028a4, 23129 },
+  { 0x01000567, 16935 },
+  { 0x10081292, 29524 },
+  { 0x00000aea, 12872 },
+  { 0x01000555, 17688 },
+  { 0x01000daf, 25217 },
+  { 0x0000fe0d,  1398 },
+  { 0x01001ec4, 18871 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000005d7,  7573 },
+  { 0x0000ff55,   382 },
+  { 0x000004a3,  6354 },
+  { 0x0000fe07,  1297 },
+  { 0x0000ff2b,   268 },
+  { 0x00000ede, 15991 },
+  { 0x0000fe80,  2483 },
+  { 0x10081209, 28547 },
+  { 0x1008ff18, 25827 },
+  { 0x100810f4, 27992 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000de7, 14655 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0100049d,  8244 },
+  { 0x01000d83, 24877 },
+  { 0x0000ffd6,   941 },
+  { 0x01001edb, 19194 },
+  { 0x010028ed, 24488 },
+  { 0x000005c1,  7273 },
+  { 0x00000ab5, 12223 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000ba6, 13129 },
+  { 0x00000ed9, 15899 },
+  { 0x0000ff35, 14919 },
+  { 0x00000db1, 14003 },
+  { 0x0000fef2,  3191 },
+  { 0x000006d7,  9581 },
+  { 0x00000dc7, 14273 },
+  { 0x0000fef5,  3245 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x010006cc,  8023 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000ffdb,   976 },
+  { 0x010004ae,  8311 },
+  { 0x010028e6, 24354 },
+  { 0x01000ddb, 25485 },
+  { 0x00ffffff,     0 },
+  { 0x0000ff34, 14906 },
+  { 0x0100280e, 20482 },
+  { 0x000001c0,  5274 },
+  { 0x01002844, 21413 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000bc0, 13158 },
+  { 0x1008ff23, 25969 },
+  { 0x01001e57,  6180 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000dc1, 14213 },
+  { 0x01000d86, 24892 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01002080, 19818 },
+  { 0x00000ba8, 13140 },
+  { 0x000006b7,  9105 },
+  { 0x00000da1, 13795 },
+  { 0x1008ff9f, 27449 },
+  { 0x1008ff72, 26883 },
+  { 0x000008a7, 11236 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01001ef8, 19475 },
+  { 0x00000ade, 12676 },
+  { 0x0100057a, 17420 },
+  { 0x000009e4, 11858 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0100281a, 20682 },
+  { 0x0000fe71,  2713 },
+  { 0x01001ee2, 19269 },
+  { 0x0000fe66,  2229 },
+  { 0x10081247, 28962 },
+  { 0x10081276, 29408 },
+  { 0x0000fefb,  3353 },
+  { 0x00000df4, 14803 },
+  { 0x0100288d, 22718 },
+  { 0x01000d82, 24869 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x010028a7, 23182 },
+  { 0x000006e4,  9755 },
+  { 0x0000ff22,   165 },
+  { 0x01001e82,  6244 },
+  { 0x000007c7, 10633 },
+  { 0x10081278, 29433 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000ee2, 16071 },
+  { 0x01002085, 19887 },
+  { 0x000003de,  5951 },
+  { 0x0000ff3e,   141 },
+  { 0x00000eaf, 15360 },
+  { 0x000008fc, 11791 },
+  { 0x0000fef1,  3173 },
+  { 0x1008ff39, 26244 },
+  { 0x01002805, 20336 },
+  { 0x000009e8, 11864 },
+  { 0x010020a6, 19655 },
+  { 0x00000ab8, 12254 },
+  { 0x1008ff4d, 26508 },
+  { 0x01001ea6, 18461 },
+  { 0x0100057d, 17492 },
+  { 0x10081296, 29568 },
+  { 0x0000ff69,   469 },
+  { 0x00000aed, 12902 },
+  { 0x000007b8, 10473 },
+  { 0x01001ea0, 18395 },
+  { 0x010001af, 19501 },
+  { 0x1008ff3a, 26260 },
+  { 0x0100283b, 21254 },
+  { 0x01000663,  7172 },
+  { 0x010010ed, 18132 },
+  { 0x010006be,  8000 },
+  { 0x000009f0, 11955 },
+  { 0x01001ed8, 19143 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0100054b, 17432 },
+  { 0x1008ff43, 26388 },
+  { 0x01002898, 22913 },
+  { 0x00000eef, 16280 },
+  { 0x000001b2,  5180 },
+  { 0x0000ffec,  1115 },
+  { 0x000007b7, 10453 },
+  { 0x0000fe59,  2018 },
+  { 0x0000ffd2,   913 },
+  { 0x100812a1, 29697 },
+  { 0x01002821, 20804 },
+  { 0x1008ff66, 26782 },
+  { 0x100811b6, 28261 },
+  { 0x000007a3, 10150 },
+  { 0x00000eb8, 15500 },
+  { 0x000005c8,  7394 },
+  { 0x10081205, 28495 },
+  { 0x000004da,  6866 },
+  { 0x0100287e, 22460 },
+  { 0x0000ffe1,  1024 },
+  { 0x1008ff55, 26616 },
+  { 0x000005e6,  7690 },
+  { 0x0000fd12,  3624 },
+  { 0x01000549, 17382 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000da5, 13847 },
+  { 0x0000ff52,   368 },
+  { 0x00000dce, 14354 },
+  { 0x000008c8, 11634 },
+  { 0x00000ea5, 15188 },
+  { 0x000008da, 11694 },
+  { 0x01000d91, 24981 },
+  { 0x010028d8, 24089 },
+  { 0x01002848, 21481 },
+  { 0x1008ff49, 26460 },
+  { 0x10081269, 29229 },
+  { 0x01002841, 21364 },
+  { 0x0000fe02,  1148 },
+  { 0x0000fe21,  1467 },
+  { 0x000001d9,  5373 },
+  { 0x000002dd,  5678 },
+  { 0x10081192, 28069 },
+  { 0x00000ef5, 16420 },
+  { 0x000008b6, 11511 },
+  { 0x000008dc, 11714 },
+  { 0x01001e1e,  6130 },
+  { 0x000005e0,  7619 },
+  { 0x00000afe, 13093 },
+  { 0x10081294, 29546 },
+  { 0x000003b5,  5828 },
+  { 0x1008ff1f, 25910 },
+  { 0x01000531, 16770 },
+  { 0x0000ff51,   363 },
+  { 0x00000acd, 12431 },
+  { 0x0000fe2d,  1728 },
+  { 0x01002854, 21689 },
+  { 0x01001ec5, 18888 },
+  { 0x000004c0,  6632 },
+  { 0x01001eda, 19183 },
+  { 0x000006fb, 10042 },
+  { 0x01000dca, 25389 },
+  { 0x0000ff13,    47 },
+  { 0x00000ce6, 13411 },
+  { 0x01001ec3, 18855 },
+  { 0x00000bc4, 13182 },
+  { 0x100811be, 28379 },
+  { 0x1008ff84, 27099 },
+  { 0x000005ea,  7753 },
+  { 0x000007ea, 10946 },
+  { 0x1008ff74, 26904 },
+  { 0x00000db5, 14060 },
+  { 0x10081200, 28430 },
+  { 0x000003fe,  6034 },
+  { 0x000006a8,  8822 },
+  { 0x000002d5,  5656 },
+  { 0x000006cf,  9486 },
+  { 0x0000fe56,  1974 },
+  { 0x01002262, 20098 },
+  { 0x1008ff45, 26412 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000ec3, 15638 },
+  { 0x0000ff6a,   476 },
+  { 0x1008fe25, 27976 },
+  { 0x000004d1,  6794 },
+  { 0x0000fe55,  1963 },
+  { 0x00000aa2, 12054 },
+  { 0x1008ff63, 26759 },
+  { 0x000004ac,  6460 },
+  { 0x000007ed, 10992 },
+  { 0x0000fe81,  2490 },
+  { 0x010028e2, 24280 },
+  { 0x1008126b, 29255 },
+  { 0x010028aa, 23236 },
+  { 0x01000576, 17320 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000ad0, 12478 },
+  { 0x01001eba, 18745 },
+  { 0x010028ce, 23902 },
+  { 0x1008ff2c, 26079 },
+  { 0x1008120a, 28560 },
+  { 0x000008bd, 11564 },
+  { 0x0000fd0d,  3558 },
+  { 0x000005c7,  7382 },
+  { 0x00000aa7, 12102 },
+  { 0x010028d1, 23958 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01001e85,  6269 },
+  { 0x01002832, 21094 },
+  { 0x010028e3, 24298 },
+  { 0x1008fe08, 27820 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01000497,  8154 },
+  { 0x01000581, 17595 },
+  { 0x01002812, 20548 },
+  { 0x000009e1, 11839 },
+  { 0x100812b4, 29932 },
+  { 0x0000ffb2,   771 },
+  { 0x0100284d, 21566 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000ff67,   459 },
+  { 0x000009f3, 12000 },
+  { 0x01002082, 19845 },
+  { 0x010004ee,  8661 },
+  { 0x000001e8,  5429 },
+  { 0x01002881, 22516 },
+  { 0x1008ffa5, 27508 },
+  { 0x100812a2, 29709 },
+  { 0x000002e5,  5697 },
+  { 0x100812b0, 29853 },
+  { 0x000004b3,  6530 },
+  { 0x1008ff95, 27300 },
+  { 0x01001eb3, 18660 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x1008121d, 28802 },
+  { 0x00000eb5, 15458 },
+  { 0x00000ee4, 16106 },
+  { 0x1008ff6d, 26857 },
+  { 0x1008ff7c, 27014 },
+  { 0x1008ff6e, 26867 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000008be, 11573 },
+  { 0x000002b6,  5594 },
+  { 0x00000ee7, 16154 },
+  { 0x01001ea1, 18405 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000006ec,  9855 },
+  { 0x01002235, 20069 },
+  { 0x01000575, 17296 },
+  { 0x000008ac, 11320 },
+  { 0x000002de,  5685 },
+  { 0x0100058a, 16638 },
+  { 0x1008ff80, 27065 },
+  { 0x0100056f, 17139 },
+  { 0x00000daa, 13915 },
+  { 0x01000da3, 25104 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x010006f2,  6953 },
+  { 0x00000ae3, 12755 },
+  { 0x0100282c, 20989 },
+  { 0x01001ef4, 19443 },
+  { 0x000007f1, 11033 },
+  { 0x10081208, 28534 },
+  { 0x0000ff97,   587 },
+  { 0x01000571, 17189 },
+  { 0x000004ba,  6583 },
+  { 0x01000546, 17308 },
+  { 0x10081204, 28482 },
+  { 0x0000fe2e,  1750 },
+  { 0x00000af7, 12996 },
+  { 0x0100289a, 22948 },
+  { 0x10081243, 28898 },
+  { 0x00000dde, 14518 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000006c7,  9386 },
+  { 0x010028e5, 24335 },
+  { 0x00000ac5, 12347 },
+  { 0x0000fe5c,  2059 },
+  { 0x00000cf7, 13712 },
+  { 0x00000eb0, 15379 },
+  { 0x010028a0, 23061 },
+  { 0x010010f5, 18236 },
+  { 0x0000fe60,  2121 },
+  { 0x1008ff54, 26601 },
+  { 0x00000aa6, 12091 },
+  { 0x00000ed4, 15807 },
+  { 0x10081295, 29557 },
+  { 0x01001ea8, 18495 },
+  { 0x000007a4, 10166 },
+  { 0x0000fe91,  2413 },
+  { 0x1008ff37, 26220 },
+  { 0x010028c9, 23810 },
+  { 0x000001d5,  5353 },
+  { 0x0000fe75,  2789 },
+  { 0x000006d2,  9521 },
+  { 0x010010e7, 18052 },
+  { 0x1008ff07, 25680 },
+  { 0x000003ec,  5975 },
+  { 0x0100053c, 17046 },
+  { 0x01000556, 17710 },
+  { 0x1008ff01, 25565 },
+  { 0x0000fd09,  3521 },
+  { 0x01002248, 20077 },
+  { 0x000005d4,  7538 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01000553, 17636 },
+  { 0x10081249, 28976 },
+  { 0x00000eca, 15708 },
+  { 0x000005e7,  7702 },
+  { 0x01002849, 21497 },
+  { 0x00000ee8, 16173 },
+  { 0x01001ec0, 18805 },
+  { 0x00000ac3, 12324 },
+  { 0x000007eb, 10958 },
+  { 0x0000feea,  3051 },
+  { 0x000003f1,  5993 },
+  { 0x010028d7, 24069 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000fe82,  2497 },
+  { 0x00000ad6, 12582 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000004cf,  6778 },
+  { 0x0000fe89,  2546 },
+  { 0x01001e02,  6090 },
+  { 0x0000ffb0,   761 },
+  { 0x000005cd,  7458 },
+  { 0x000001bd,  5245 },
+  { 0x0100284f, 21602 },
+  { 0x010028ae, 23310 },
+  { 0x100811a6, 28138 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x1008129f, 29673 },
+  { 0x000005e9,  7734 },
+  { 0x000002e6,  5707 },
+  { 0x01002815, 20597 },
+  { 0x01001ef3,  6287 },
+  { 0x1008ffa4, 27498 },
+  { 0x000004a1,  6320 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x010028b1, 23366 },
+  { 0x00000efa, 16510 },
+  { 0x01002823, 20836 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000006df,  9689 },
+  { 0x100811bd, 28363 },
+  { 0x000001fb,  5506 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000fd14,  3645 },
+  { 0x000003d9,  5936 },
+  { 0x10081264, 29142 },
+  { 0x000001cf,  5324 },
+  { 0x0000fd05,  3467 },
+  { 0x000001bc,  5238 },
+  { 0x010006af,  7970 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000ff63,   442 },
+  { 0x01001e36, 18375 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0100049b,  8199 },
+  { 0x01000586, 17722 },
+  { 0x010010e6, 18038 },
+  { 0x0000fea2,  3399 },
+  { 0x1008ff5f, 26719 },
+  { 0x0000fd18,  3686 },
+  { 0x0000fef9,  3315 },
+  { 0x000003f3,  6010 },
+  { 0x01002875, 22287 },
+  { 0x0100012c, 18271 },
+  { 0x100812a6, 29757 },
+  { 0x01000580, 17570 },
+  { 0x00000dc2, 14223 },
+  { 0x01001ef6, 19463 },
+  { 0x01000da4, 25113 },
+  { 0x0100056d, 17087 },
+  { 0x000008ef, 11754 },
+  { 0x0000ff31, 14875 },
+  { 0x00000bd3, 13224 },
+  { 0x00000dd6, 14457 },
+  { 0x01000dc6, 25381 },
+  { 0x10081268, 29218 },
+  { 0x0000fe51,  1896 },
+  { 0x1008fe07, 27804 },
+  { 0x000001ea,  5436 },
+  { 0x000007e8, 10923 },
+  { 0x01000174,  6042 },
+  { 0x0000fd0b,  3540 },
+  { 0x000004be,  6616 },
+  { 0x01002878, 22345 },
+  { 0x0000ffcf,   891 },
+  { 0x01000d8c, 24939 },
+  { 0x00000df9, 14863 },
+  { 0x010006c1,  8067 },
+  { 0x0000fe62,  2145 },
+  { 0x0100287c, 22421 },
+  { 0x01001ea4, 18427 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000de0, 14551 },
+  { 0x0000feec,  3083 },
+  { 0x1008ff88, 27144 },
+  { 0x01001eea, 19351 },
+  { 0x0100283f, 21329 },
+  { 0x010001b0, 19507 },
+  { 0x1008ffb0, 27573 },
+  { 0x00000ce3, 13363 },
+  { 0x010001e6, 18286 },
+  { 0x100812ab, 29817 },
+  { 0x0000ffe9,  1095 },
+  { 0x00000aae, 12148 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x1008ffa9, 27554 },
+  { 0x010028a6, 23164 },
+  { 0x000001f1,  5466 },
+  { 0x1008ff14, 25771 },
+  { 0x010028dd, 24184 },
+  { 0x000006c3,  9337 },
+  { 0x00000ec4, 15648 },
+  { 0x000006c5,  9362 },
+  { 0x010004b9,  8513 },
+  { 0x00000ce1, 13313 },
+  { 0x01000dda, 25476 },
+  { 0x000008a4, 11198 },
+  { 0x000001e0,  5401 },
+  { 0x01002863, 21959 },
+  { 0x00000db0, 13990 },
+  { 0x000004d6,  6834 },
+  { 0x000002fe,  5748 },
+  { 0x010001b6, 18325 },
+  { 0x01001eb9, 18735 },
+  { 0x00000aa8, 12112 },
+  { 0x00000cea, 13493 },
+  { 0x01001ed5, 19093 },
+  { 0x0000ff20,    87 },
+  { 0x01002865, 21994 },
+  { 0x00000ecb, 15718 },
+  { 0x00000ad7, 12590 },
+  { 0x000005e3,  7656 },
+  { 0x1008ff38, 26232 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01002807, 20368 },
+  { 0x10081177, 28035 },
+  { 0x000008b4, 11467 },
+  { 0x01000583, 17650 },
+  { 0x01001ead, 18581 },
+  { 0x00000ebc, 15558 },
+  { 0x000001c3,  5281 },
+  { 0x00000ee9, 16188 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x1008ff59, 26653 },
+  { 0x00000af0, 12916 },
+  { 0x000007ef, 11010 },
+  { 0x00000db4, 14049 },
+  { 0x01002076, 19765 },
+  { 0x0000ffd3,   920 },
+  { 0x0000ffc4,   829 },
+  { 0x00000cfa, 13759 },
+  { 0x01000d88, 24908 },
+  { 0x0100056e, 17113 },
+  { 0x0100289c, 22985 },
+  { 0x000006f9, 10016 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01000542, 17202 },
+  { 0x0000fe53,  1923 },
+  { 0x0000fe33,  1857 },
+  { 0x0000ffe3,  1040 },
+  { 0x01002889, 22649 },
+  { 0x00000ced, 13535 },
+  { 0x01002825, 20869 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000afd, 13074 },
+  { 0x1008fe21, 27914 },
+  { 0x0000ff57,   411 },
+  { 0x010001a1, 19495 },
+  { 0x000006a5,  8760 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01002800, 20261 },
+  { 0x10081266, 29192 },
+  { 0x010004b6,  8443 },
+  { 0x10081293, 29535 },
+  { 0x01000dcf, 25397 },
+  { 0x01000dc4, 25364 },
+  { 0x01000db9, 25296 },
+  { 0x010010d6, 17830 },
+  { 0x0000ff25,   200 },
+  { 0x010028f0, 24549 },
+  { 0x0000ffc1,   820 },
+  { 0x01000da5, 25122 },
+  { 0x00000bda, 13251 },
+  { 0x1008ff28, 26034 },
+  { 0x1008ff8b, 27178 },
+  { 0x010028f7, 24684 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000eaa, 15270 },
+  { 0x000003bb,  5852 },
+  { 0x01001ecc, 18977 },
+  { 0x1008ff53, 26594 },
+  { 0x0000ffab,   708 },
+  { 0x000008b5, 11493 },
+  { 0x01001ebb, 18751 },
+  { 0x1008ff4e, 26520 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x010028e0, 24245 },
+  { 0x0100055c, 16672 },
+  { 0x1008ff68, 26805 },
+  { 0x01001ed9, 19163 },
+  { 0x000007cf, 10730 },
+  { 0x000006be,  9256 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000ec1, 15617 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01001eef, 19404 },
+  { 0x01000db1, 25236 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01002831, 21077 },
+  { 0x0100220b, 20007 },
+  { 0x010006f7,  6993 },
+  { 0x0000fd0e,  3568 },
+  { 0x0000ff29,   244 },
+  { 0x0000fe6a,  2299 },
+  { 0x000006d1,  9509 },
+  { 0x10081218, 28723 },
+  { 0x0000ffc0,   817 },
+  { 0x00000ece, 15748 },
+  { 0x01000d8a, 24924 },
+  { 0x000001aa,  5132 },
+  { 0x010028b3, 23402 },
+  { 0x000001a3,  5103 },
+  { 0x00000edb, 15935 },
+  { 0x01002808, 20385 },
+  { 0x010028f2, 24586 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x010010db, 17894 },
+  { 0x000006af,  8968 },
+  { 0x000008cf, 11676 },
+  { 0x00000dcb, 14320 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000cf6, 13688 },
+  { 0x000007f8, 11121 },
+  { 0x01001ec6, 18905 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x1008fe06, 27788 },
+  { 0x0000ff33, 14895 },
+  { 0x000005c2,  7286 },
+  { 0x010028cf, 23921 },
+  { 0x000003f2,  6002 },
+  { 0x000004d8,  6850 },
+  { 0x1008ffb7, 27670 },
+  { 0x01001e0b,  6120 },
+  { 0x0000fd1d,  3764 },
+  { 0x01001ebf, 18788 },
+  { 0x00000ec2, 15627 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000de9, 14681 },
+  { 0x00000eee, 16265 },
+  { 0x0000ffb5,   786 },
+  { 0x0000ff2f,   304 },
+  { 0x01002801, 20275 },
+  { 0x0100286e, 22158 },
+  { 0x01001ea3, 18421 },
+  { 0x01002074, 19739 },
+  { 0x000004b6,  6551 },
+  { 0x010028f1, 24567 },
+  { 0x1008ffa8, 27540 },
+  { 0x0000ffdc,   984 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000006dd,  9661 },
+  { 0x01002830, 21061 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000007e3, 10864 },
+  { 0x00000ab1, 12182 },
+  { 0x00000adf, 12691 },
+  { 0x010028b6, 23458 },
+  { 0x010020a1, 19603 },
+  { 0x010010d8, 17856 },
+  { 0x0100281b, 20699 },
+  { 0x0100286f, 22177 },
+  { 0x000006bc,  9216 },
+  { 0x010010e9, 18079 },
+  { 0x1008121e, 28822 },
+  { 0x1008ff4f, 26532 },
+  { 0x010028db, 24145 },
+  { 0x0100287b, 22401 },
+  { 0x1008ff1e, 25901 },
+  { 0x00000ef0, 16304 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000006b5,  9068 },
+  { 0x000006da,  9625 },
+  { 0x01000d95, 25011 },
+  { 0x010028de, 24204 },
+  { 0x000007d4, 10775 },
+  { 0x00000ae7, 12817 },
+  { 0x00000ea6, 15206 },
+  { 0x000006c6,  9374 },
+  { 0x00000dcd, 14344 },
+  { 0x00000acf, 12462 },
+  { 0x010010d7, 17843 },
+  { 0x010020a9, 19686 },
+  { 0x000001e3,  5408 },
+  { 0x01000662,  7163 },
+  { 0x01000dd8, 25459 },
+  { 0x0000ff98,   593 },
+  { 0x01000db0, 25226 },
+  { 0x000004bf,  6624 },
+  { 0x000009e5, 11861 },
+  { 0x00000af8, 13007 },
+  { 0x100812ac, 29829 },
+  { 0x00000bca, 13201 },
+  { 0x1008ff34, 26182 },
+  { 0x00000ecf, 15758 },
+  { 0x0100221c, 20038 },
+  { 0x000004ce,  6770 },
+  { 0x0100053b, 17020 },
+  { 0x0000ff92,   553 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x1008120d, 28606 },
+  { 0x0000fef6,  3259 },
+  { 0x000004b1,  6516 },
+  { 0x000003a3,  5770 },
+  { 0x000007e7, 10913 },
+  { 0x000006a3,  8723 },
+  { 0x00000abc, 12269 },
+  { 0x010004e3,  8613 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000fd10,  3595 },
+  { 0x0000fe77,  2824 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000ae4, 12771 },
+  { 0x01001ece, 18997 },
+  { 0x1008126f, 29314 },
+  { 0x0000ff58,   415 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x100811ac, 28198 },
+  { 0x0100285e, 21870 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01000303, 19513 },
+  { 0x01001eed, 19383 },
+  { 0x000001a9,  5125 },
+  { 0x01002846, 21446 },
+  { 0x10081240, 28853 },
+  { 0x000006f3,  9938 },
+  { 0x0000fe12,  1232 },
+  { 0x01000537, 16924 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000acc, 12414 },
+  { 0x1008ff44, 26400 },
+  { 0x010004b2,  8399 },
+  { 0x00000ae5, 12789 },
+  { 0x000004d0,  6786 },
+  { 0x100811a0, 28109 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x1008ff1a, 25849 },
+  { 0x0100281f, 20770 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000002a1,  5537 },
+  { 0x000004d9,  6858 },
+  { 0x0000fe0f,  1434 },
+  { 0x0000fef4,  3227 },
+  { 0x0100054c, 17456 },
+  { 0x01000582, 17622 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000008c2, 11619 },
+  { 0x01001ed7, 19126 },
+  { 0x000008af, 11364 },
+  { 0x10081272, 29357 },
+  { 0x1008ff8f, 27224 },
+  { 0x000005cc,  7446 },
+  { 0x01002843, 21396 },
+  { 0x10081206, 28508 },
+  { 0x0000fef0,  3155 },
+  { 0x000001d1,  5339 },
+  { 0x01000d8e, 24955 },
+  { 0x000009ea, 11870 },
+  { 0x0000ff0a,    25 },
+  { 0x010001b5, 18278 },
+  { 0x000006b1,  9005 },
+  { 0x0000ffdf,  1008 },
+  { 0x01001ea5, 18444 },
+  { 0x01001ed3, 19060 },
+  { 0x0100285a, 21796 },
+  { 0x000006e5,  9767 },
+  { 0x010028ac, 23273 },
+  { 0x000007a5, 10183 },
+  { 0x0000ff65,   449 },
+  { 0x00000ded, 14739 },
+  { 0x0000ffeb,  1107 },
+  { 0x010028e1, 24262 },
+  { 0x00000dcf, 14368 },
+  { 0x01000dbd, 25321 },
+  { 0x000008b7, 11529 },
+  { 0x000006ab,  8895 },
+  { 0x010010f0, 18173 },
+  { 0x0100281e, 20752 },
+  { 0x01001ef0, 19415 },
+  { 0x0000ff53,   371 },
+  { 0x00000dae, 13964 },
+  { 0x00000eb9, 15513 },
+  { 0x000001b1,  5172 },
+  { 0x0000ffcd,   877 },
+  { 0x01002089, 19944 },
+  { 0x1008ff9a, 27370 },
+  { 0x00000dc9, 14297 },
+  { 0x01000552, 17608 },
+  { 0x000004a6,  6417 },
+  { 0x000009e2, 11852 },
+  { 0x0000fee6,  2980 },
+  { 0x01001ee5, 19307 },
+  { 0x01000dab, 25179 },
+  { 0x1008ff60, 26726 },
+  { 0x000004b9,  6575 },
+  { 0x0100057b, 17444 },
+  { 0x00000db7, 14085 },
+  { 0x00000ad3, 12539 },
+  { 0x010028f9, 24724 },
+  { 0x0000fe92,  2436 },
+  { 0x1008ff22, 25950 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000ef2, 16354 },
+  { 0x01002803, 20305 },
+  { 0x000007cb, 10678 },
+  { 0x00000eed, 16249 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0100286b, 22102 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000007c9, 10655 },
+  { 0x01001e1f,  6140 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01001e37, 18385 },
+  { 0x01000493,  8114 },
+  { 0x00000ef8, 16466 },
+  { 0x010028bf, 23632 },
+  { 0x01000578, 17370 },
+  { 0x00000bfc, 13269 },
+  { 0x00000af5, 12971 },
+  { 0x0000ff61,   428 },
+  { 0x000003cf,  5902 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0100055d, 16600 },
+  { 0x000008f6, 11772 },
+  { 0x000004d4,  6818 },
+  { 0x1008ff35, 26197 },
+  { 0x00000ada, 12609 },
+  { 0x01001ed2, 19043 },
+  { 0x00000af4, 12959 },
+  { 0x0000fed2,  2641 },
+  { 0x000007b2, 10356 },
+  { 0x000001a2,  5097 },
+  { 0x0100284b, 21531 },
+  { 0x0000fe52,  1907 },
+  { 0x01001eb0, 18625 },
+  { 0x01002847, 21463 },
+  { 0x0000ff2a,   252 },
+  { 0x00000ee6, 16140 },
+  { 0x01000688,  7092 },
+  { 0x010028f3, 24605 },
+  { 0x000004a9,  6439 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000bc3, 13175 },
+  { 0x000005f1,  7851 },
+  { 0x01000564, 16860 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000ffed,  1123 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000007ee, 11001 },
+  { 0x1008ff5b, 26673 },
+  { 0x010028e9, 24411 },
+  { 0x0000fe85,  2518 },
+  { 0x01000da9, 25160 },
+  { 0x000006ce,  9474 },
+  { 0x0000fd07,  3494 },
+  { 0x1008fe04, 27756 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x1008ff7e, 27040 },
+  { 0x01001ea2, 18415 },
+  { 0x01002806, 20352 },
+  { 0x01002888, 22633 },
+  { 0x00000cec, 13522 },
+  { 0x10081230, 28839 },
+  { 0x01002852, 21654 },
+  { 0x100811b8, 28293 },
+  { 0x0000ff9b,   630 },
+  { 0x000007b3, 10376 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000ff56,   396 },
+  { 0x0000fd19,  3698 },
+  { 0x000001b7,  5209 },
+  { 0x1008ff93, 27274 },
+  { 0x000006a6,  8774 },
+  { 0x0100054a, 17408 },
+  { 0x010028c4, 23721 },
+  { 0x0100283a, 21236 },
+  { 0x0000ffe5,  1060 },
+  { 0x000006db,  9637 },
+  { 0x0100222d, 20059 },
+  { 0x01002895, 22858 },
+  { 0x1008fe22, 27928 },
+  { 0x0000ffcc,   870 },
+  { 0x00000afc, 13068 },
+  { 0x0100055a, 17734 },
+  { 0x1008fe02, 27724 },
+  { 0x00000ecc, 15728 },
+  { 0x0000fffa, 20246 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01000dd6, 25450 },
+  { 0x0000ff23,   174 },
+  { 0x10081267, 29204 },
+  { 0x000004a8,  6432 },
+  { 0x000006cd,  9462 },
+  { 0x000004c5,  6690 },
+  { 0x010028c2, 23686 },
+  { 0x0000ff89,   531 },
+  { 0x000006b2,  9017 },
+  { 0x0000fff6, 20190 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x1008ff31, 26137 },
+  { 0x01000668,  7217 },
+  { 0x0000fe90,  2400 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x010028d2, 23976 },
+  { 0x000007e2, 10853 },
+  { 0x01000dd9, 25468 },
+  { 0x0000fff3, 20148 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01002845, 21429 },
+  { 0x0000fd03,  3444 },
+  { 0x0000fe83,  2504 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01001e0a,  6110 },
+  { 0x00000bc2, 13166 },
+  { 0x000007cd, 10712 },
+  { 0x0000feeb,  3067 },
+  { 0x000006d3,  9533 },
+  { 0x01002086, 19901 },
+  { 0x1008ff4c, 26496 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000004b0,  6501 },
+  { 0x1008119b, 28099 },
+  { 0x01000686,  7079 },
+  { 0x000007ce, 10721 },
+  { 0x0000fd1c,  3746 },
+  { 0x00000aac, 12136 },
+  { 0x010028c8, 23793 },
+  { 0x0000fe73,  2755 },
+  { 0x0000ffff,    80 },
+  { 0x000006d4,  9545 },
+  { 0x00000aa9, 12122 },
+  { 0x000008a2, 11168 },
+  { 0x1008ff98, 27334 },
+  { 0x00000eda, 15919 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01000259, 18361 },
+  { 0x01002892, 22806 },
+  { 0x010028c0, 23653 },
+  { 0x00000ce9, 13482 },
+  { 0x100812b8, 29966 },
+  { 0x01000655,  7916 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000aaf, 12157 },
+  { 0x01002885, 22581 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01000301, 19545 },
+  { 0x0000fe31,  1815 },
+  { 0x01000550, 17558 },
+  { 0x00000deb, 14705 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000ad2, 12519 },
+  { 0x000006ff, 10094 },
+  { 0x0000ffe0,  1016 },
+  { 0x00000ec0, 15607 },
+  { 0x100811a8, 28149 },
+  { 0x0000ffdd,   992 },
+  { 0x000008bf, 11590 },
+  { 0x01000d8b, 24932 },
+  { 0x0100282d, 21006 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0100049c,  8221 },
+  { 0x010010e3, 17998 },
+  { 0x100812bb, 30014 },
+  { 0x00000ebf, 15598 },
+  { 0x01000539, 16970 },
+  { 0x00000ed8, 15879 },
+  { 0x010028c7, 23774 },
+  { 0x01000d9f, 25070 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x010004e9,  8646 },
+  { 0x1008ffb2, 27604 },
+  { 0x00000daf, 13977 },
+  { 0x00000dea, 14693 },
+  { 0x010010d3, 17792 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0100282e, 21024 },
+  { 0x1008fe23, 27943 },
+  { 0x0000ff99,   602 },
+  { 0x01000587, 16542 },
+  { 0x000009f7, 12033 },
+  { 0x01001ee6, 19317 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000005ec,  7780 },
+  { 0x1008ff17, 25813 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01000d85, 24885 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x100811a4, 28124 },
+  { 0x000008a6, 11222 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x1008ff5e, 26710 },
+  { 0x000008bc, 11550 },
+  { 0x000005e1,  7634 },
+  { 0x0000ffc9,   849 },
+  { 0x0000ffd4,   927 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01001ef9, 19482 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01000561, 16783 },
+  { 0x0100054f, 17530 },
+  { 0x0000fee0,  2898 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x010004d8,  8565 },
+  { 0x000007c6, 10622 },
+  { 0x000006ca,  9422 },
+  { 0x010020ab, 19708 },
+  { 0x0000fee5,  2964 },
+  { 0x000004c4,  6682 },
+  { 0x000020ac, 19717 },
+  { 0x01000dc0, 25329 },
+  { 0x00000da7, 13876 },
+  { 0x0000ff7f,   513 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000002ab,  5567 },
+  { 0x0000fff4, 20162 },
+  { 0x00000df6, 14825 },
+  { 0x0100286d, 22139 },
+  { 0x000008a1, 11156 },
+  { 0x1008ffb4, 27634 },
+  { 0x0000feee,  3115 },
+  { 0x00000de2, 14574 },
+  { 0x010004af,  8331 },
+  { 0x00000dbe, 14173 },
+  { 0x01001ec9, 18951 },
+  { 0x01000666,  7199 },
+  { 0x0000fee2,  2925 },
+  { 0x00000ebe, 15585 },
+  { 0x000005cf,  7481 },
+  { 0x000003a5,  5779 },
+  { 0x01002813, 20564 },
+  { 0x100812ba, 29998 },
+  { 0x010010ee, 18146 },
+  { 0x01001eb8, 18725 },
+  { 0x0000fef8,  3287 },
+  { 0x0000ff9f,   677 },
+  { 0x000013bc,  6294 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01002837, 21182 },
+  { 0x0100019f, 18300 },
+  { 0x0100012d, 18318 },
+  { 0x00000dd8, 14482 },
+  { 0x0100288b, 22683 },
+  { 0x00000acb, 12396 },
+  { 0x1008129e, 29661 },
+  { 0x01001eb6, 18695 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01000669,  7226 },
+  { 0x00000edd, 15971 },
+  { 0x00000ec9, 15697 },
+  { 0x1008ff20, 25923 },
+  { 0x00000ab0, 12173 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000006fd, 10066 },
+  { 0x010006f8,  7001 },
+  { 0x00000eb7, 15487 },
+  { 0x1008ff58, 26645 },
+  { 0x1008ffa0, 27458 },
+  { 0x1008ff36, 26211 },
+  { 0x0000fe22,  1484 },
+  { 0x0000ff9c,   651 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000ea7, 15224 },
+  { 0x010028ab, 23254 },
+  { 0x010028ea, 24430 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000004dc,  6882 },
+  { 0x010028fb, 24764 },
+  { 0x000004ca,  6730 },
+  { 0x010004ef,  8679 },
+  { 0x1008ff57, 26636 },
+  { 0x0100221a, 20018 },
+  { 0x1008120f, 28632 },
+  { 0x000004b2,  6523 },
+  { 0x1008ff2f, 26113 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0100056c, 17060 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000dd0, 14383 },
+  { 0x01002838, 21201 },
+  { 0x00000ad5, 12573 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000ff60,   421 },
+  { 0x0100282a, 20954 },
+  { 0x100811e5, 28413 },
+  { 0x10081251, 29022 },
+  { 0x000008a8, 11253 },
+  { 0x000001ae,  5155 },
+  { 0x00000ea3, 15157 },
+  { 0x000009f4, 12015 },
+  { 0x01000db8, 25288 },
+  { 0x100812a3, 29721 },
+  { 0x01000554, 17664 },
+  { 0x00000da3, 13819 },
+  { 0x010028f6, 24664 },
+  { 0x0000fd06,  3480 },
+  { 0x00000ce5, 13400 },
+  { 0x01002861, 21925 },
+  { 0x000003b6,  5835 },
+  { 0x000007e5, 10888 },
+  { 0x00000dab, 13929 },
+  { 0x01000dde, 25511 },
+  { 0x1008ff94, 27286 },
+  { 0x010028da, 24126 },
+  { 0x0000ff66,   454 },
+  { 0x01000698,  7935 },
+  { 0x010028b4, 23421 },
+  { 0x1008ff10, 25703 },
+  { 0x1008ffa1, 27469 },
+  { 0x000003dd,  5944 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01001e83,  6251 },
+  { 0x0000ffcb,   863 },
+  { 0x00000cf5, 13654 },
+  { 0x01001eb5, 18683 },
+  { 0x1008ff92, 27264 },
+  { 0x1008ff3d, 26306 },
+  { 0x0000fff1, 20120 },
+  { 0x00000aca, 12382 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000006e7,  9791 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000006b4,  9043 },
+  { 0x00000adb, 12618 },
+  { 0x00000ea9, 15257 },
+  { 0x10081274, 29381 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000004bd,  6608 },
+  { 0x1008ff9c, 27403 },
+  { 0x1008fe0c, 27886 },
+  { 0x01002079, 19805 },
+  { 0x01002818, 20649 },
+  { 0x01000dc3, 25356 },
+  { 0x000004a2,  6334 },
+  { 0x000001f0,  5458 },
+  { 0x10081270, 29325 },
+  { 0x0000ffb1,   766 },
+  { 0x00000af1, 12929 },
+  { 0x000007d8, 10819 },
+  { 0x1008ff52, 26585 },
+  { 0x00000abe, 12299 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01000d89, 24917 },
+  { 0x000007d0, 10744 },
+  { 0x000007ec, 10983 },
+  { 0x01002859, 21778 },
+  { 0x01000670,  7032 },
+  { 0x01002880, 22501 },
+  { 0x01000570, 17164 },
+  { 0x00000eea, 16203 },
+  { 0x0000fe8b,  2570 },
+  { 0x01001ef2,  6280 },
+  { 0x0000ffae,   740 },
+  { 0x00000cdf, 13279 },
+  { 0x1008ff65, 26771 },
+  { 0x000009f8, 12038 },
+  { 0x0000fe01,  1139 },
+  { 0x00000ab2, 12192 },
+  { 0x01002864, 21977 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000de4, 14604 },
+  { 0x010004b7,  8466 },
+  { 0x01001e8a, 18261 },
+  { 0x0000fe50,  1885 },
+  { 0x0000fe57,  1988 },
+  { 0x000006ee,  9879 },
+  { 0x01002871, 22214 },
+  { 0x0000fe63,  2155 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000008db, 11705 },
+  { 0x01001ed6, 19109 },
+  { 0x000006f8,  9998 },
+  { 0x010028c1, 23669 },
+  { 0x01000db6, 25271 },
+  { 0x0100054d, 17480 },
+  { 0x1008ff05, 25638 },
+  { 0x000008ae, 11349 },
+  { 0x01000535, 16872 },
+  { 0x01002816, 20614 },
+  { 0x1008ff12, 25736 },
+  { 0x000009ed, 11912 },
+  { 0x000001ec,  5444 },
+  { 0x010028b0, 23349 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000009ec, 11899 },
+  { 0x0100280f, 20499 },
+  { 0x000002a6,  5545 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000006ef,  9891 },
+  { 0x1008fe0a, 27852 },
+  { 0x00000dd5, 14445 },
+  { 0x010028cc, 23865 },
+  { 0x010028d5, 24031 },
+  { 0x000008de, 11733 },
+  { 0x000003bf,  5872 },
+  { 0x00000eb6, 15470 },
+  { 0x01001ecb, 18967 },
+  { 0x01000492,  8097 },
+  { 0x00000eb3, 15423 },
+  { 0x000006a7,  8797 },
+  { 0x010001b7, 18367 },
+  { 0x010028f4, 24625 },
+  { 0x01000da1, 25087 },
+  { 0x000005d6,  7562 },
+  { 0x00000ad4, 12560 },
+  { 0x01000d96, 25019 },
+  { 0x010020a2, 19613 },
+  { 0x01001ee4, 19297 },
+  { 0x00000dca, 14309 },
+  { 0x01001eb2, 18649 },
+  { 0x01002820, 20789 },
+  { 0x00000eff, 16531 },
+  { 0x00000ebd, 15571 },
+  { 0x01002810, 20517 },
+  { 0x000004a5,  6385 },
+  { 0x000003d2,  5919 },
+  { 0x00000cf2, 13617 },
+  { 0x01000df4, 25549 },
+  { 0x000006c1,  9314 },
+  { 0x100811b7, 28277 },
+  { 0x000005f0,  7838 },
+  { 0x000006c0,  9302 },
+  { 0x01002819, 20665 },
+  { 0x000007e1, 10841 },
+  { 0x0100288c, 22701 },
+  { 0x00000ab3, 12201 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000fed1,  2621 },
+  { 0x10081298, 29590 },
+  { 0x00000bc6, 13192 },
+  { 0x01000533, 16822 },
+  { 0x01000db4, 25254 },
+  { 0x01001e6a,  6210 },
+  { 0x1008ff5d, 26697 },
+  { 0x1008ff2b, 26068 },
+  { 0x01001ebe, 18771 },
+  { 0x00000cf1, 13589 },
+  { 0x01001ee9, 19340 },
+  { 0x00000eb4, 15441 },
+  { 0x10081273, 29373 },
+  { 0x0000ffd7,   948 },
+  { 0x010010d5, 17817 },
+  { 0x0000ffea,  1101 },
+  { 0x010010d2, 17779 },
+  { 0x000008aa, 11288 },
+  { 0x01000dd1, 25415 },
+  { 0x100812b5, 29949 },
+  { 0x010028fc, 24785 },
+  { 0x00000ddf, 14541 },
+  { 0x01000538, 16946 },
+  { 0x01000dae, 25207 },
+  { 0x01000db3, 25244 },
+  { 0x000001b5,  5195 },
+  { 0x01000300, 19529 },
+  { 0x0000fff5, 20176 },
+  { 0x010028eb, 24449 },
+  { 0x00000bdc, 13260 },
+  { 0x1008ff7b, 27005 },
+  { 0x000005d5,  7551 },
+  { 0x000006a2,  8709 },
+  { 0x010028d9, 24107 },
+  { 0x0000fee8,  3015 },
+  { 0x01001eb4, 18671 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01000dc1, 25337 },
+  { 0x000006d8,  9593 },
+  { 0x010010d0, 17754 },
+  { 0x01002866, 22012 },
+  { 0x000004aa,  6446 },
+  { 0x000002d8,  5666 },
+  { 0x01000569, 16982 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000fefc,  3373 },
+  { 0x00000dd1, 14394 },
+  { 0x010006a9,  7957 },
+  { 0x010028b2, 23384 },
+  { 0x010010f1, 18186 },
+  { 0x01002834, 21129 },
+  { 0x1008ff86, 27122 },
+  { 0x010006f6,  6985 },
+  { 0x000006c8,  9399 },
+  { 0x0000ffe8,  1088 },
+  { 0x0000fee7,  2997 },
+  { 0x010028ad, 23291 },
+  { 0x000003ef,  5985 },
+  { 0x0000ffbf,   814 },
+  { 0x01001ef7, 19469 },
+  { 0x1008ff26, 26013 },
+  { 0x000007d7, 10809 },
+  { 0x01002839, 21218 },
+  { 0x1008ff77, 26952 },
+  { 0x1008126c, 29272 },
+  { 0x01001eca, 18957 },
+  { 0x0000fea0,  3393 },
+  { 0x010006d4,  7129 },
+  { 0x1008ff30, 26123 },
+  { 0x0000fe2f,  1769 },
+  { 0x01001e84,  6258 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01001eaf, 18613 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01001eee, 19393 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000002f5,  5719 },
+  { 0x000005e5,  7678 },
+  { 0x00000ec5, 15657 },
+  { 0x000007c4, 10596 },
+  { 0x1008ff1c, 25870 },
+  { 0x0000ffaf,   751 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x010020a7, 19665 },
+  { 0x000005eb,  7764 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000eac, 15307 },
+  { 0x000007d6, 10799 },
+  { 0x10081262, 29086 },
+  { 0x00000ac4, 12334 },
+  { 0x010004a3,  8289 },
+  { 0x010028d3, 23994 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x010028e8, 24393 },
+  { 0x01001e6b,  6220 },
+  { 0x000007f5, 11087 },
+  { 0x0100289f, 23041 },
+  { 0x00000ce7, 13436 },
+  { 0x1008ff73, 26893 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x1008ff33, 26167 },
+  { 0x010028be, 23612 },
+  { 0x0000ffd8,   955 },
+  { 0x0000fe8c,  2589 },
+  { 0x00000ed2, 15788 },
+  { 0x0000fee3,  2936 },
+  { 0x000006f0,  9902 },
+  { 0x000008ab, 11306 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000009ee, 11926 },
+  { 0x0000fee9,  3035 },
+  { 0x000004cb,  6738 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000ffb8,   801 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000ff1b,    73 },
+  { 0x00000af6, 12984 },
+  { 0x0000ff14,    53 },
+  { 0x01000323, 19576 },
+  { 0x010010e1, 17972 },
+  { 0x0100284e, 21584 },
+  { 0x010028e7, 24373 },
+  { 0x00000bcc, 13205 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x100811bc, 28340 },
+  { 0x1008ff47, 26436 },
+  { 0x000001a1,  5089 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000fe24,  1523 },
+  { 0x000004c8,  6714 },
+  { 0x000004ab,  6453 },
+  { 0x000007f9, 11131 },
+  { 0x000009e0, 11826 },
+  { 0x10081202, 28456 },
+  { 0x1008ff70, 26877 },
+  { 0x00000aaa, 12129 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01002081, 19832 },
+  { 0x0000ff3c,   107 },
+  { 0x01000df2, 25529 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x100811d0, 28395 },
+  { 0x0100280a, 20416 },
+  { 0x1008ff2d, 26089 },
+  { 0x010010e2, 17985 },
+  { 0x00000dc4, 14245 },
+  { 0x01001ebc, 18757 },
+  { 0x010028ba, 23534 },
+  { 0x0000047e,  6311 },
+  { 0x010028d0, 23941 },
+  { 0x01002811, 20532 },
+  { 0x000001a5,  5111 },
+  { 0x00000eb2, 15410 },
+  { 0x010006a4,  7946 },
+  { 0x00000ce0, 13300 },
+  { 0x000006aa,  8870 },
+  { 0x0000ff38, 14962 },
+  { 0x000004cc,  6746 },
+  { 0x0000fe93,  2459 },
+  { 0x0000fe54,  1951 },
+  { 0x010010ec, 18119 },
+  { 0x1008ff51, 26564 },
+  { 0x000002a9,  5557 },
+  { 0x1008ffa2, 27478 },
+  { 0x1008ffa6, 27519 },
+  { 0x0100285f, 21889 },
+  { 0x0000fd13,  3634 },
+  { 0x01001ee0, 19247 },
+  { 0x0000fe27,  1592 },
+  { 0x01000dd0, 25406 },
+  { 0x1008ffa3, 27490 },
+  { 0x01000da2, 25096 },
+  { 0x00000ce4, 13390 },
+  { 0x000004d7,  6842 },
+  { 0x100812a7, 29769 },
+  { 0x00000aa3, 12062 },
+  { 0x00000dec, 14722 },
+  { 0x0100288f, 22754 },
+  { 0x0000ff9a,   610 },
+  { 0x010010dc, 17907 },
+  { 0x010010d1, 17766 },
+  { 0x000003d1,  5910 },
+  { 0x0000ff68,   464 },
+  { 0x0000fff9, 20232 },
+  { 0x01000d87, 24900 },
+  { 0x0000ff95,   571 },
+  { 0x01002205, 19975 },
+  { 0x0000fe5e,  2081 },
+  { 0x01001edc, 19205 },
+  { 0x0000fe03,  1165 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000ea8, 15238 },
+  { 0x1008fe01, 27708 },
+  { 0x000006b0,  8994 },
+  { 0x01001eec, 19373 },
+  { 0x000007f2, 11043 },
+  { 0x01002829, 20937 },
+  { 0x010010e0, 17959 },
+  { 0x00000ef6, 16439 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01001e80,  6230 },
+  { 0x00000ae2, 12740 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000008b2, 11424 },
+  { 0x000001ff,  5528 },
+  { 0x01002209, 19994 },
+  { 0x00000dc3, 14234 },
+  { 0x10081217, 28710 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000007f3, 11055 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000007cc, 10703 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x1008ff56, 26626 },
+  { 0x0000fe79,  2863 },
+  { 0x010028a8, 23201 },
+  { 0x00000de6, 14641 },
+  { 0x000001af,  5162 },
+  { 0x00000de5, 14624 },
+  { 0x0000fe5a,  2035 },
+  { 0x0100287d, 22440 },
+  { 0x01000309, 19561 },
+  { 0x0000ff15,    65 },
+  { 0x1008ff85, 27110 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x100812b1, 29874 },
+  { 0x01001eab, 18544 },
+  { 0x0000ff8d,   538 },
+  { 0x000006ba,  9178 },
+  { 0x000003ac,  5812 },
+  { 0x010028a9, 23218 },
+  { 0x000004b4,  6537 },
+  { 0x01002876, 22306 },
+  { 0x0100053d, 17074 },
+  { 0x0000fe04,  1182 },
+  { 0x000005ee,  7812 },
+  { 0x0100055e, 16736 },
+  { 0x0000fd15,  3655 },
+  { 0x01002897, 22894 },
+  { 0x10081271, 29342 },
+  { 0x1008ff21, 25936 },
+  { 0x00000ef7, 16452 },
+  { 0x010010f6, 18249 },
+  { 0x0000ff6b,   481 },
+  { 0x01001e60,  6190 },
+  { 0x000005ef,  7825 },
+  { 0x10081210, 28645 },
+  { 0x00000ed7, 15864 },
+  { 0x0000ff91,   547 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01002087, 19914 },
+  { 0x010006f0,  6937 },
+  { 0x0000fff8, 20218 },
+  { 0x0000ff21,   159 },
+  { 0x0000feef,  3137 },
+  { 0x1008ff78, 26961 },
+  { 0x0000fe11,  1215 },
+  { 0x000007b1, 10338 },
+  { 0x010004d9,  8580 },
+  { 0x000006f1,  9914 },
+  { 0x1008fe09, 27836 },
+  { 0x1008126d, 29286 },
+  { 0x01002860, 21909 },
+  { 0x000006e2,  9730 },
+  { 0x000007ae, 10302 },
+  { 0x01001ec1, 18822 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01001ebd, 18764 },
+  { 0x00000ea1, 15124 },
+  { 0x00000ead, 15325 },
+  { 0x0000fe5f,  2099 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000ff2e,   293 },
+  { 0x0000ff93,   559 },
+  { 0x00000ace, 12449 },
+  { 0x000005d8,  7584 },
+  { 0x0000ffd5,   934 },
+  { 0x1008ff7a, 26989 },
+  { 0x100811a9, 28168 },
+  { 0x010006d2,  8050 },
+  { 0x0000ffad,   728 },
+  { 0x01000574, 17271 },
+  { 0x1008ff62, 26748 },
+  { 0x0000fd11,  3610 },
+  { 0x0000fefa,  3334 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x100812a0, 29685 },
+  { 0x1008ff61, 26737 },
+  { 0x000004d3,  6810 },
+  { 0x0000ffe2,  1032 },
+  { 0x000001b3,  5187 },
+  { 0x1008ff46, 26424 },
+  { 0x000004c9,  6722 },
+  { 0x010004b1,  8375 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x1008ff15, 25785 },
+  { 0x00000dbf, 14186 },
+  { 0x000005c6,  7364 },
+  { 0x00000ecd, 15737 },
+  { 0x0100057e, 17517 },
+  { 0x01002842, 21380 },
+  { 0x000006bd,  9230 },
+  { 0x010028dc, 24165 },
+  { 0x000007a2, 10130 },
+  { 0x1008ff03, 25598 },
+  { 0x1008ff87, 27134 },
+  { 0x01000551, 17582 },
+  { 0x000007e9, 10935 },
+  { 0x00000db6, 14071 },
+  { 0x1008ffb8, 27693 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000007a1, 10112 },
+  { 0x0000fe32,  1843 },
+  { 0x000002b9,  5606 },
+  { 0x01001ef1, 19429 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000ff96,   579 },
+  { 0x0000ffe6,  1070 },
+  { 0x0000ff7e,   487 },
+  { 0x1008fe05, 27772 },
+  { 0x000006ad,  8922 },
+  { 0x01001eb1, 18637 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000007d2, 10763 },
+  { 0x0100057c, 17468 },
+  { 0x0000ffb3,   776 },
+  { 0x000004de,  6897 },
+  { 0x10081166, 28026 },
+  { 0x01000dac, 25188 },
+  { 0x010028ff, 24847 },
+  { 0x000006a1,  8697 },
+  { 0x1008ff16, 25799 },
+  { 0x1008ff2e, 26105 },
+  { 0x0000ffbd,   687 },
+  { 0x0100282b, 20971 },
+  { 0x0000fe25,  1545 },
+  { 0x010028e4, 24317 },
+  { 0x01000dbb, 25313 },
+  { 0x01002817, 20631 },
+  { 0x01002814, 20581 },
+  { 0x000005cb,  7434 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000dcc, 14331 },
+  { 0x01000d9b, 25035 },
+  { 0x01002078, 19791 },
+  { 0x01000664,  7181 },
+  { 0x00000dac, 13939 },
+  { 0x0100057f, 17544 },
+  { 0x0000fd1a,  3716 },
+  { 0x01002858, 21761 },
+  { 0x01000db7, 25279 },
+  { 0x000008a5, 11210 },
+  { 0x00000aee, 12910 },
+  { 0x0000ff3d,   123 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000007a8, 10242 },
+  { 0x00000edf, 16011 },
+  { 0x00000bd6, 13232 },
+  { 0x000002b1,  5586 },
+  { 0x01002853, 21671 },
+  { 0x0100285b, 21814 },
+  { 0x000009e9, 11867 },
+  { 0x01000565, 16886 },
+  { 0x0000ffc2,   823 },
+  { 0x00000ac9, 12372 },
+  { 0x010010df, 17945 },
+  { 0x000004a7,  6425 },
+  { 0x100811b0, 28246 },
+  { 0x00000af3, 12949 },
+  { 0x01000532, 16796 },
+  { 0x01001ef5, 19453 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000005c4,  7324 },
+  { 0x000001db,  5379 },
+  { 0x0100286c, 22121 },
+  { 0x0000ffe4,  1050 },
+  { 0x1008ff42, 26376 },
+  { 0x010028ec, 24469 },
+  { 0x010004b8,  8489 },
+  { 0x010028fa, 24744 },
+  { 0x000007e4, 10876 },
+  { 0x1008ff32, 26152 },
+  { 0x1008ff40, 26352 },
+  { 0x000007b6, 10428 },
+  { 0x010028bb, 23553 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000ec7, 15678 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000fd0a,  3531 },
+  { 0x010010e5, 18024 },
+  { 0x01002088, 19929 },
+  { 0x000007b9, 10493 },
+  { 0x010028c6, 23756 },
+  { 0x0100287a, 22382 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x1008fe24, 27958 },
+  { 0x000006f6,  9973 },
+  { 0x10081203, 28469 },
+  { 0x000008cd, 11659 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01000dd3, 25433 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000fe86,  2525 },
+  { 0x01000548, 17358 },
+  { 0x00000eb1, 15397 },
+  { 0x010006ba,  7981 },
+  { 0x1008ff13, 25750 },
+  { 0x00000de1, 14562 },
+  { 0x000004bb,  6591 },
+  { 0x000006f2,  9926 },
+  { 0x000009f2, 11985 },
+  { 0x000009ef, 11940 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000002bc,  5622 },
+  { 0x100812a9, 29793 },
+  { 0x01002896, 22876 },
+  { 0x1008ff7f, 27052 },
+  { 0x01000175,  6054 },
+  { 0x1008ff67, 26793 },
+  { 0x0000fe2b,  1682 },
+  { 0x10081265, 29167 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000008fb, 11781 },
+  { 0x00000ed0, 15768 },
+  { 0x01002868, 22049 },
+  { 0x0000fe05,  1199 },
+  { 0x00000ef9, 16483 },
+  { 0x00000abf, 12317 },
+  { 0x000001f2,  5473 },
+  { 0x01002879, 22363 },
+  { 0x1008ff4a, 26472 },
+  { 0x0000fe6e,  2370 },
+  { 0x1008ff89, 27160 },
+  { 0x01000572, 17216 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000ce8, 13459 },
+  { 0x10081245, 28929 },
+  { 0x010028ef, 24528 },
+  { 0x01002874, 22269 },
+  { 0x01001ecf, 19003 },
+  { 0x000009f5, 12021 },
+  { 0x010010f2, 18198 },
+  { 0x000006b9,  9153 },
+  { 0x1008127a, 29478 },
+  { 0x000001de,  5392 },
+  { 0x1008ff5c, 26687 },
+  { 0x1008ff8c, 27189 },
+  { 0x0000fd02,  3429 },
+  { 0x000006de,  9676 },
+  { 0x01002836, 21164 },
+  { 0x0000fee1,  2911 },
+  { 0x1008ff90, 27235 },
+  { 0x1008120e, 28619 },
+  { 0x010020aa, 19694 },
+  { 0x0000fd17,  3675 },
+  { 0x0000fe0c,  1382 },
+  { 0x010028cb, 23846 },
+  { 0x01002835, 21146 },
+  { 0x0000fe30,  1790 },
+  { 0x01000d9d, 25052 },
+  { 0x0000fe6f,  2386 },
+  { 0x010028ee, 24508 },
+  { 0x0100054e, 17504 },
+  { 0x1008126a, 29242 },
+  { 0x1008fe20, 27903 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x100811af, 28228 },
+  { 0x00000ba9, 13150 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000ff30,   315 },
+  { 0x1008121c, 28785 },
+  { 0x000006e3,  9742 },
+  { 0x010010de, 17932 },
+  { 0x000006f4,  9950 },
+  { 0x00000ae9, 12852 },
+  { 0x000008b3, 11441 },
+  { 0x000007e6, 10902 },
+  { 0x10081215, 28675 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000007a9, 10262 },
+  { 0x00000dd4, 14434 },
+  { 0x10081185, 28051 },
+  { 0x0000fee4,  2949 },
+  { 0x1008ff96, 27309 },
+  { 0x1008ff75, 26922 },
+  { 0x0100280c, 20449 },
+  { 0x01002887, 22615 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01002899, 22930 },
+  { 0x000005ca,  7423 },
+  { 0x010004bb,  8551 },
+  { 0x10081242, 28886 },
+  { 0x00000ea4, 15175 },
+  { 0x000005c9,  7405 },
+  { 0x0000fe28,  1612 },
+  { 0x0100281c, 20717 },
+  { 0x0100053e, 17100 },
+  { 0x010001d1, 18293 },
+  { 0x01000177,  6078 },
+  { 0x01000691,  7104 },
+  { 0x0000fe6c,  2331 },
+  { 0x0000ffee,  1131 },
+  { 0x0000fff7, 20204 },
+  { 0x00000bce, 13210 },
+  { 0x000009df, 11820 },
+  { 0x010028c5, 23738 },
+  { 0x01001eaa, 18527 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x10081216, 28692 },
+  { 0x000005d9,  7595 },
+  { 0x000001ef,  5451 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x010020a5, 19646 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x010028b5, 23439 },
+  { 0x100811ad, 28212 },
+  { 0x01001eeb, 19362 },
+  { 0x000008df, 11744 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01000dc2, 25346 },
+  { 0x01002075, 19752 },
+  { 0x0000fe13,  1249 },
+  { 0x00000aeb, 12884 },
+  { 0x0100284a, 21514 },
+  { 0x0000ffc8,   842 },
+  { 0x010004b0,  8351 },
+  { 0x1008ff97, 27317 },
+  { 0x000001d2,  5346 },
+  { 0x000004b5,  6544 },
+  { 0x00000ae8, 12834 },
+  { 0x0100053f, 17126 },
+  { 0x00000ec6, 15668 },
+  { 0x000005ed,  7796 },
+  { 0x000004af,  6484 },
+  { 0x1008ff1b, 25859 },
+  { 0x100812b3, 29915 },
+  { 0x01001ede, 19227 },
+  { 0x000006eb,  9843 },
+  { 0x01000545, 17284 },
+  { 0x000001be,  5257 },
+  { 0x000006ae,  8948 },
+  { 0x00000ed3, 15798 },
+  { 0x000006e9,  9816 },
+  { 0x01002809, 20400 },
+  { 0x01001edf, 19237 },
+  { 0x01002840, 21349 },
+  { 0x0000ff54,   377 },
+  { 0x00000ab4, 12211 },
+  { 0x0000fe87,  2532 },
+  { 0x10081250, 29004 },
+  { 0x000007c3, 10584 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x010010dd, 17920 },
+  { 0x010010d9, 17868 },
+  { 0x0100018f, 18355 },
+  { 0x000005e2,  7645 },
+  { 0x000007b5, 10409 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000ffc6,   835 },
+  { 0x0000ffc7,   838 },
+  { 0x000007c1, 10561 },
+  { 0x0000fe34,  1875 },
+  { 0x01001ee7, 19323 },
+  { 0x000006ac,  8908 },
+  { 0x10081277, 29424 },
+  { 0x1008ff04, 25620 },
+  { 0x0000fd01,  3414 },
+  { 0x010028bd, 23592 },
+  { 0x000007c2, 10573 },
+  { 0x1008ff8d, 27201 },
+  { 0x0000ff09,    21 },
+  { 0x00000ef1, 16329 },
+  { 0x1008129d, 29649 },
+  { 0x01000563, 16835 },
+  { 0x000008c5, 11628 },
+  { 0x0000fe88,  2539 },
+  { 0x00000ab6, 12234 },
+  { 0x01001e03,  6100 },
+  { 0x00000dd7, 14469 },
+  { 0x00000df8, 14850 },
+  { 0x00000edc, 15950 },
+  { 0x00000df5, 14814 },
+  { 0x00000cf9, 13747 },
+  { 0x00000db9, 14114 },
+  { 0x000008b1, 11407 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x100812aa, 29805 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000003a6,  5786 },
+  { 0x01002867, 22030 },
+  { 0x000004c6,  6698 },
+  { 0x1008ff48, 26448 },
+  { 0x000007b4, 10392 },
+  { 0x000002fd,  5741 },
+  { 0x010010eb, 18106 },
+  { 0x000001bf,  5264 },
+  { 0x01000667,  7208 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000001a6,  5118 },
+  { 0x0000ff26,   209 },
+  { 0x01000da0, 25079 },
+  { 0x00000dda, 14505 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x1008ff27, 26022 },
+  { 0x01000d8d, 24947 },
+  { 0x000005d0,  7492 },
+  { 0x010001a0, 19489 },
+  { 0x01002822, 20820 },
+  { 0x000004cd,  6762 },
+  { 0x00000dd2, 14410 },
+  { 0x00000da4, 13833 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000006b3,  9031 },
+  { 0x01000db5, 25262 },
+  { 0x00000eeb, 16218 },
+  { 0x01002804, 20321 },
+  { 0x01001ee3, 19283 },
+  { 0x0100053a, 16994 },
+  { 0x00000db3, 14038 },
+  { 0x1008ff6a, 26822 },
+  { 0x0000ff2c,   276 },
+  { 0x0000fe58,  2003 },
+  { 0x010028a3, 23111 },
+  { 0x000003c0,  5876 },
+  { 0x000004dd,  6890 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01000547, 17332 },
+  { 0x010010f4, 18223 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000006bb,  9203 },
+  { 0x0000ff94,   565 },
+  { 0x0100222c, 20049 },
+  { 0x0100280b, 20432 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000009e3, 11855 },
+  { 0x0000fe70,  2698 },
+  { 0x00000ebb, 15544 },
+  { 0x00000ab7, 12243 },
+  { 0x000007d5, 10785 },
+  { 0x0000fef7,  3273 },
+  { 0x000007ca, 10666 },
+  { 0x01002870, 22197 },
+  { 0x000004a4,  6374 },
+  { 0x01000d9a, 25027 },
+  { 0x010028c3, 23703 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000006e6,  9779 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000fe69,  2278 },
+  { 0x0100282f, 21042 },
+  { 0x01002827, 20903 },
+  { 0x00000ee5, 16121 },
+  { 0x0000fe26,  1568 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000013be,  6300 },
+  { 0x0000ff32, 14882 },
+  { 0x010006f3,  6961 },
+  { 0x00000dd9, 14493 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000003f9,  6019 },
+  { 0x000008c9, 11646 },
+  { 0x010028d4, 24013 },
+  { 0x00000aec, 12897 },
+  { 0x000008ad, 11334 },
+  { 0x000005ac,  7116 },
+  { 0x00000add, 12655 },
+  { 0x00000af2, 12936 },
+  { 0x000007af, 10323 },
+  { 0x0000fe29,  1633 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x010010e4, 18010 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x010028cd, 23883 },
+  { 0x01000df3, 25539 },
+  { 0x01000573, 17244 },
+  { 0x010001d2, 18340 },
+  { 0x0000ffac,   715 },
+  { 0x0000ff50,   358 },
+  { 0x000004b8,  6567 },
+  { 0x000006d5,  9557 },
+  { 0x000003bd,  5868 },
+  { 0x0000ff3a, 14989 },
+  { 0x00000df2, 14778 },
+  { 0x010010e8, 18065 },
+  { 0x01001eac, 18561 },
+  { 0x0100056b, 17033 },
+  { 0x010004ba,  8537 },
+  { 0x00000abd, 12286 },
+  { 0x1008ff79, 26974 },
+  { 0x000008dd, 11727 },
+  { 0x00000da8, 13888 },
+  { 0x000007f6, 11101 },
+  { 0x1008ff6c, 26846 },
+  { 0x10081263, 29114 },
+  { 0x01001ec7, 18925 },
+  { 0x01002877, 22325 },
+  { 0x1008ff11, 25715 },
+  { 0x0000fe06,  1281 },
+  { 0x0000ff28,   236 },
+  { 0x01000d94, 25004 },
+  { 0x000003fd,  6027 },
+  { 0x1008121b, 28769 },
+  { 0x00000bcf, 13217 },
+  { 0x0100056a, 17007 },
+  { 0x000004d2,  6802 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000fef3,  3209 },
+  { 0x000006fc, 10055 },
+  { 0x0000ffb7,   796 },
+  { 0x0000fe65,  2194 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000af9, 13020 },
+  { 0x01002263, 20111 },
+  { 0x01000da6, 25132 },
+  { 0x01002893, 22823 },
+  { 0x0000ff3b, 15005 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000adc, 12635 },
+  { 0x0000ffc3,   826 },
+  { 0x1008ff8e, 27210 },
+  { 0x000002c5,  5634 },
+  { 0x00000da2, 13806 },
+  { 0x010028b9, 23515 },
+  { 0x0000fe5d,  2071 },
+  { 0x0000ffce,   884 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01000543, 17230 },
+  { 0x000003cc,  5892 },
+  { 0x0000ffb9,   806 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x010028a1, 23077 },
+  { 0x00000eae, 15342 },
+  { 0x000006ed,  9867 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000007c8, 10643 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01001ec2, 18839 },
+  { 0x000007f7, 11111 },
+  { 0x1008ffb5, 27643 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000fea3,  3402 },
+  { 0x10081297, 29579 },
+  { 0x100812b2, 29894 },
+  { 0x01002802, 20290 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01000dba, 25305 },
+  { 0x0100221b, 20029 },
+  { 0x01001edd, 19216 },
+  { 0x01000577, 17345 },
+  { 0x010028a2, 23094 },
+  { 0x00000cf4, 13644 },
+  { 0x01002083, 19858 },
+  { 0x0000ffb4,   781 },
+  { 0x00000ad1, 12498 },
+  { 0x1008ff76, 26937 },
+  { 0x000005ce,  7469 },
+  { 0x000006f7,  9986 },
+  { 0x1008ff8a, 27169 },
+  { 0x1008120c, 28593 },
+  { 0x000005e8,  7723 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000cee, 13551 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000006bf,  9276 },
+  { 0x010010ea, 18093 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x100811b9, 28310 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000fd0c,  3549 },
+  { 0x01002084, 19873 },
+  { 0x01001ed0, 19009 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000005da,  7606 },
+  { 0x000003e7,  5967 },
+  { 0x010028bc, 23573 },
+  { 0x0000fd04,  3456 },
+  { 0x01000536, 16900 },
+  { 0x01001ed4, 19077 },
+  { 0x01000653,  7878 },
+  { 0x010010f3, 18211 },
+  { 0x000001ab,  5141 },
+  { 0x1008ffa7, 27528 },
+  { 0x1008ffb3, 27621 },
+  { 0x010020a4, 19637 },
+  { 0x0000fe61,  2135 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01000665,  7190 },
+  { 0x01002882, 22532 },
+  { 0x01000589, 16563 },
+  { 0x0100288e, 22736 },
+  { 0x0100283d, 21291 },
+  { 0x00000dc0, 14197 },
+  { 0x0000fed4,  2661 },
+  { 0x0100055b, 16704 },
+  { 0x00000ba3, 13119 },
+  { 0x000004bc,  6599 },
+  { 0x0000ff39, 14976 },
+  { 0x1008129b, 29625 },
+  { 0x10081290, 29502 },
+  { 0x000003d3,  5927 },
+  { 0x000001f8,  5493 },
+  { 0x0000fed5,  2681 },
+  { 0x1008ffb6, 27654 },
+  { 0x01002833, 21111 },
+  { 0x000006b8,  9130 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01000660,  7145 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000cf3, 13629 },
+  { 0x000003ba,  5844 },
+  { 0x1008ff41, 26364 },
+  { 0x01001e81,  6237 },
+  { 0x000006e8,  9804 },
+  { 0x01000da8, 25150 },
+  { 0x0000ffda,   969 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000ed5, 15823 },
+  { 0x00000eab, 15289 },
+  { 0x00000da6, 13860 },
+  { 0x010006f4,  6969 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000008d6, 11686 },
+  { 0x000001e5,  5415 },
+  { 0x0000ff9d,   658 },
+  { 0x0000fe68,  2261 },
+  { 0x1008ff19, 25840 },
+  { 0x100812a5, 29745 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01000585, 17699 },
+  { 0x000003aa,  5795 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x010010d4, 17805 },
+  { 0x0000fe20,  1454 },
+  { 0x010028df, 24224 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01001eb7, 18710 },
+  { 0x000007a7, 10222 },
+  { 0x10081241, 28870 },
+  { 0x000002bb,  5615 },
+  { 0x000001e6,  5422 },
+  { 0x00000dd3, 14422 },
+  { 0x000001d8,  5366 },
+  { 0x00000ae6, 12798 },
+  { 0x000006c9,  9411 },
+  { 0x00000ea2, 15138 },
+  { 0x01000d8f, 24964 },
+  { 0x1008ff9d, 27418 },
+  { 0x01002855, 21706 },
+  { 0x01002872, 22232 },
+  { 0x00000df0, 14753 },
+  { 0x01002886, 22598 },
+  { 0x01001ea9, 18511 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01002208, 19984 },
+  { 0x0000ff36, 14931 },
+  { 0x01000dc5, 25372 },
+  { 0x01000d93, 24996 },
+  { 0x0000fe78,  2847 },
+  { 0x01000d9c, 25044 },
+  { 0x010004a2,  8267 },
+  { 0x000006b6,  9082 },
+  { 0x000004b7,  6559 },
+  { 0x000008fd, 11799 },
+  { 0x000003c7,  5884 },
+  { 0x00000bd8, 13241 },
+  { 0x01002890, 22773 },
+  { 0x0000fea5,  3410 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000fe84,  2511 },
+  { 0x01000d92, 24988 },
+  { 0x0000ffd9,   962 },
+  { 0x10081246, 28945 },
+  { 0x1008ff24, 25982 },
+  { 0x000003ab,  5803 },
+  { 0x01001e61,  6200 },
+  { 0x0100280d, 20465 },
+  { 0x1008ff02, 25578 },
+  { 0x010028af, 23329 },
+  { 0x1008ff3e, 26320 },
+  { 0x000008ce, 11668 },
+  { 0x01002077, 19777 },
+  { 0x000005d1,  7504 },
+  { 0x010028d6, 24050 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01000292, 18371 },
+  { 0x1008120b, 28576 },
+  { 0x000007c5, 10608 },
+  { 0x000005e4,  7667 },
+  { 0x01001ecd, 18987 },
+  { 0x01000496,  8131 },
+  { 0x00000ceb, 13510 },
+  { 0x1008124a, 28992 },
+  { 0x0000fefd,  3301 },
+  { 0x000006ea,  9827 },
+  { 0x01000544, 17258 },
+  { 0x01000275, 18347 },
+  { 0x01001ea7, 18478 },
+  { 0x000002f8,  5729 },
+  { 0x000001d0,  5331 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000aff, 13112 },
+  { 0x1008fe0b, 27869 },
+  { 0x1008ff3f, 26336 },
+  { 0x01000ddd, 25502 },
+  { 0x00000ee1, 16050 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x100812a8, 29781 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000001c5,  5288 },
+  { 0x100811d1, 28402 },
+  { 0x000006c4,  9350 },
+  { 0x000008a9, 11270 },
+  { 0x01002857, 21742 },
+  { 0x01001e40,  6150 },
+  { 0x0100289b, 22966 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000de8, 14670 },
+  { 0x10081261, 29063 },
+  { 0x01000654,  7897 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000007f4, 11077 },
+  { 0x010004e2,  8595 },
+  { 0x0000ff0b,    34 },
+  { 0x1008ff9e, 27432 },
+  { 0x100812ad, 29841 },
+  { 0x00000df3, 14791 },
+  { 0x000006cb,  9438 },
+  { 0x0000fe2a,  1657 },
+  { 0x0000fe8a,  2553 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01002883, 22548 },
+  { 0x000009f1, 11970 },
+  { 0x01000679,  7056 },
+  { 0x1008ff06, 25658 },
+  { 0x1008129c, 29637 },
+  { 0x000001ac,  5148 },
+  { 0x0000fea4,  3406 },
+  { 0x01000d90, 24972 },
+  { 0x0000ffaa,   696 },
+  { 0x1008121a, 28753 },
+  { 0x100810f5, 28011 },
+  { 0x01001ee1, 19258 },
+  { 0x000004db,  6874 },
+  { 0x0100285c, 21833 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000ec8, 15687 },
+  { 0x00000dc8, 14285 },
+  { 0x000006e1,  9719 },
+  { 0x01000ddc, 25494 },
+  { 0x00000afa, 13030 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000fe67,  2246 },
+  { 0x01001ed1, 19026 },
+  { 0x000008fe, 11810 },
+  { 0x000007ba, 10515 },
+  { 0x0100286a, 22084 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x1008ff25, 25997 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000ffca,   856 },
+  { 0x0000fd1e,  3781 },
+  { 0x010028b7, 23477 },
+  { 0x000003e0,  5959 },
+  { 0x0000ffde,  1000 },
+  { 0x000003bc,  5861 },
+  { 0x00000ef3, 16369 },
+  { 0x01002894, 22841 },
+  { 0x1008ff5a, 26665 },
+  { 0x01001eae, 18601 },
+  { 0x000008c0, 11599 },
+  { 0x000006e0,  9707 },
+  { 0x000001cc,  5317 },
+  { 0x000008a3, 11183 },
+  { 0x000006c2,  9325 },
+  { 0x00000df7, 14837 },
+  { 0x010020a3, 19626 },
+  { 0x0000fe64,  2167 },
+  { 0x00000ed6, 15844 },
+  { 0x000006cc,  9450 },
+  { 0x100812b9, 29982 },
+  { 0x0000ffc5,   832 },
+  { 0x000001b6,  5202 },
+  { 0x01001e41,  6160 },
+  { 0x100812bc, 30030 },
+  { 0x010006f1,  6945 },
+  { 0x0100289e, 23022 },
+  { 0x000001fe,  5519 },
+  { 0x000005f2,  7865 },
+  { 0x1008ff3c, 26294 },
+  { 0x01002873, 22250 },
+  { 0x01000daa, 25169 },
+  { 0x00000ad9, 12598 },
+  { 0x000001f5,  5480 },
+  { 0x0000ff2d,   283 },
+  { 0x01002862, 21942 },
+  { 0x0000fe7a,  2879 },
+  { 0x000001c6,  5295 },
+  { 0x01000534, 16848 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01000562, 16809 },
+  { 0x000007d9, 10829 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0100281d, 20734 },
+  { 0x0000ffb6,   791 },
+  { 0x00000dbd, 14163 },
+  { 0x000001bb,  5231 },
+  { 0x0000ff24,   193 },
+  { 0x01002828, 20921 },
+  { 0x00000ed1, 15778 },
+  { 0x0100283c, 21273 },
+  { 0x000006a9,  8845 },
+  { 0x00000ee0, 16030 },
+  { 0x000005d2,  7514 },
+  { 0x01000566, 16912 },
+  { 0x01000568, 16958 },
+  { 0x010028f5, 24644 },
+  { 0x01000d9e, 25061 },
+  { 0x0000ff27,   218 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x010020a0, 19595 },
+  { 0x1008129a, 29613 },
+  { 0x000001ba,  5222 },
+  { 0x000004df,  6909 },
+  { 0x000002ac,  5574 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000fea1,  3396 },
+  { 0x01000579, 17395 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0100283e, 21310 },
+  { 0x00000ee3, 16091 },
+  { 0x0100289d, 23003 },
+  { 0x010004b3,  8421 },
+  { 0x0100287f, 22480 },
+  { 0x1008126e, 29300 },
+  { 0x01001ee8, 19329 },
+  { 0x00000de3, 14585 },
+  { 0x1008fe03, 27740 },
+  { 0x10081275, 29392 },
+  { 0x10081219, 28738 },
+  { 0x000009f6, 12028 },
+  { 0x01001e8b, 18308 },
+  { 0x000008b0, 11385 },
+  { 0x000006d9,  9611 },
+  { 0x1008ff81, 27078 },
+  { 0x1008ffb1, 27588 },
+  { 0x1008ff1d, 25886 },
+  { 0x000006f5,  9962 },
+  { 0x1008ff3b, 26273 },
+  { 0x010004e8,  8631 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000003b3,  5819 },
+  { 0x010006f5,  6977 },
+  { 0x010028f8, 24705 },
+  { 0x1008ff29, 26043 },
+  { 0x00000aa5, 12080 },
+  { 0x00000db2, 14022 },
+  { 0x01000dad, 25198 },
+  { 0x000005d3,  7526 },
+  { 0x000007bb, 10543 },
+  { 0x0000fe0a,  1347 },
+  { 0x01000dd4, 25442 },
+  { 0x00000ae0, 12704 },
+  { 0x0000fe2c,  1707 },
+  { 0x000013bd,  6297 },
+  { 0x0000fd0f,  3578 },
+  { 0x0000fe0e,  1419 },
+  { 0x01002891, 22789 },
+  { 0x01002850, 21621 },
+  { 0x000006d6,  9568 },
+  { 0x00000dbb, 14138 },
+  { 0x000009eb, 11885 },
+  { 0x10081193, 28083 },
+  { 0x1008ff4b, 26484 },
+  { 0x000001ca,  5309 },
+  { 0x01000584, 17676 },
+  { 0x01000661,  7154 },
+  { 0x00000abb, 12261 },
+  { 0x00000dc6, 14265 },
+  { 0x000004c2,  6657 },
+  { 0x01002070, 19726 },
+  { 0x1008ff99, 27350 },
+  { 0x1008ff2a, 26055 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01000540, 17152 },
+  { 0x00000eba, 15531 },
+  { 0x0000ff80,   522 },
+  { 0x01002884, 22565 },
+  { 0x00000cf0, 13578 },
+  { 0x01001ec8, 18945 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x010028a5, 23146 },
+  { 0x000007d1, 10753 },
+  { 0x10081188, 28059 },
+  { 0x100811ba, 28329 },
+  { 0x10081260, 29040 },
+  { 0x0100067e,  7068 },
+  { 0x00000ae1, 12721 },
+  { 0x1008ff82, 27088 },
+  { 0x000008c1, 11609 },
+  { 0x0000fed0,  2600 },
+  { 0x0000fe6d,  2351 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000004c7,  6706 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x010028fd, 24805 },
+  { 0x1008ff6b, 26837 },
+  { 0x01000541, 17176 },
+  { 0x0000fff2, 20134 },
+  { 0x000006a4,  8735 },
+  { 0x01000dd2, 25425 },
+  { 0x000004c3,  6674 },
+  { 0x00000dbc, 14149 },
+  { 0x01002202, 19958 },
+  { 0x0000fd08,  3510 },
+  { 0x1008ff7d, 27024 },
+  { 0x1008ff9b, 27383 },
+  { 0x0000ffbe,   811 },
+  { 0x0100285d, 21851 },
+  { 0x010010ef, 18159 },
+  { 0x0000ffd1,   905 },
+  { 0x0000ff37,    97 },
+  { 0x10081279, 29454 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000fd16,  3665 },
+  { 0x000001b9,  5215 },
+  { 0x01002826, 20886 },
+  { 0x010010da, 17881 },
+  { 0x1008ff91, 27251 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000006d0,  9497 },
+  { 0x0000fe74,  2771 },
+  { 0x01000da7, 25141 },
+  { 0x01002856, 21724 },
+  { 0x010028fe, 24826 },
+  { 0x000005bb,  7235 },
+  { 0x00000afb, 13048 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x010028ca, 23828 },
+  { 0x10081291, 29513 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01002824, 20853 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x100811aa, 28185 },
+  { 0x010006f9,  7009 },
+  { 0x000005bf,  7252 },
+  { 0x010020a8, 19676 },
+  { 0x0000fe5b,  2046 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000ff9e,   667 },
+  { 0x000002c6,  5644 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000fe6b,  2315 },
+  { 0x0000ff08,    11 },
+  { 0x000006fa, 10030 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000feed,  3099 },
+  { 0x0000ff62,   434 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000004c1,  6640 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01001e56,  6170 },
+  { 0x01000176,  6066 },
+  { 0x0100066a,  7017 },
+  { 0x0100288a, 22666 },
+  { 0x000004ad,  6468 },
+  { 0x000004d5,  6826 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000aa4, 12071 },
+  { 0x10081207, 28521 },
+  { 0x000006dc,  9650 },
+  { 0x000007ab, 10284 },
+  { 0x01000ddf, 25520 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000ef4, 16394 },
+  { 0x0000fe72,  2737 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000db8, 14100 },
+  { 0x00000df1, 14765 },
+  { 0x0000fd1b,  3732 },
+  { 0x00000cef, 13562 },
+  { 0x1008ff69, 26813 },
+  { 0x0000ff0d,    40 },
+  { 0x01002869, 22066 },
+  { 0x000001f9,  5500 },
+  { 0x1008ff50, 26544 },
+  { 0x0000fe0b,  1362 },
+  { 0x00000cf8, 13735 },
+  { 0x10081201, 28443 },
+  { 0x10081244, 28915 },
+  { 0x000005c3,  7305 },
+  { 0x01002247, 20086 },
+};
+
+#define CIM_KEYSYM_FROM_NAME_N_BUCKETS 607
+#define CIM_KEYSYM_FROM_NAME_N_SLOTS   2731
+
+static const uint16_t cim_keysym_from_name_disps[607] = {
+     13,   35,   13,    8,    2,    3,   58,    5,    9,    2,   17,    1,
+      3,    8,    2,    0,    6,    1,   13,   10,    9,    3,    3,    5,
+      1,    1,   16,   14,   44,   43,   10,    2,    2,    4,   14,   10,
+     24,    1,   39,    1,    1,    1,   13,   11,   12,    4,   28,   17,
+      1,    7,    4,    6,    9,    1,    5,    2,    2,    5,    7,   57,
+      4,    2,    8,    8,   10,    1,   12,   16,    1,    2,    5,    4,
+     16,    4,    2,   21,    6,    1,   66,   10,    3,    1,   22,    4,
+     50,    1,   27,   10,   24,   81,   26,   14,   27,    1,   36,   52,
+      3,    3,    3,   41,    3,    1,    6,   24,    1,    8,    3,    9,
+     41,    1,    9,    5,    5,    3,    1,    2,   12,    1,    9,    1,
+     11,   18,   21,   36,    7,   43,   25,    9,    3,   63,   39,    9,
+     41,   27,   11,    7,   45,    3,    4,   46,    2,   22,   40,   23,
+      6,   54,    7,    2,   12,    9,   31,   82,    1,   14,    1,    2,
+      9,    9,    3,    3,  101,    2,   22,    1,    5,    4,    2,    3,
+      2,    6,    9,   13,   53,   90,    3,    2,    7,   15,    8,    9,
+      8,    7,   63,    1,    2,    7,    2,   12,    1,   10,    5,    5,
+     37,   26,    2,    6,   48,    1,   21,    3,    7,    3,    1,   53,
+      4,    8,   23,   46,   37,    6,    2,   75,    1,   25,    3,    6,
+      2,   24,   17,    1,   39,    2,    3,    1,   18,   56,    2,   18,
+     41,    6,   29,    2,   63,   53,    6,    1,   45,   26,   25,   13,
+     58,    9,   15,   30,   23,    6,   17,    4,   10,   21,    6,    8,
+     37,  104,    4,   32,    6,   20,    2,   12,   24,    2,   16,    9,
+    105,    1,    3,    3,   41,    8,   14,   52,   11,   21,   19,   22,
+     23,   55,   48,   38,    6,   22,   14,   42,   30,    2,   21,   13,
+      9,    1,   74,    3,    6,    8,   78,  173,   21,   14,   76,    4,
+     16,   10,   28,    3,   44,   11,    3,   16,   28,    4,    2,   35,
+     44,    8,   33,   70,    5,    5,   15,    0,    2,   51,    4,    4,
+     11,    6,    0,    9,   12,    3,    1,    7,  117,   27,   77,   50,
+     54,    8,    8,    5,   54,   54,    8,   13,    1,    7,    6,  130,
+      8,   22,   21,   29,   32,   49,   33,   76,    4,   16,   12,    1,
+      8,   12,    3,    4,    8,   68,   16,    1,   97,    2,    7,   26,
+     17,   78,  141,    2,    2,    3,   24,    2,   19,    3,  145,    1,
+      4,   11,   27,    3,  108,   11,    3,    3,    1,    2,    2,   10,
+     61,  107,    5,   62,  115,    1,    7,    4,    1,   27,    2,   72,
+     48,   38,   12,   56,   46,  153,   31,   26,   25,   21,   30,    5,
+    105,   54,    2,   13,    1,   11,    8,   32,   11,   27,   16,   33,
+     42,    2,    1,    1,   48,   19,   29,    2,    3,   80,   30,   12,
+      3,    9,    5,    3,    2,   19,  106,   13,  209,   22,   15,    4,
+      5,   24,   30,    4,  143,   32,  135,   10,   82,    1,   27,   78,
+     41,    1,    5,    1,    4,   18,    1,    6,   11,    5,   33,    3,
+      2,    6,   13,    1,    2,    8,   18,   22,    1,    4,    1,   32,
+     12,   45,  140,   26,  101,   67,   24,   13,   12,   15,    7,   10,
+     20,   22,    8,    0,   23,   11,    1,    5,    2,   57,    3,  128,
+    136,   30,   32,   15,   49,   18,    1,    9,  122,    8,   21,   23,
+    240,   68,  133,  142,   14,  227,    6,   27,   43,    1,   11,    2,
+      3,    4,   21,  291,   11,   16,    7,    2,   58,   59,   34,  254,
+     76,   19,  129,   40,    2,   90,   64,   63,    1,   17,   13,    3,
+     96,   36,   18,    7,    6,  299,  235,    4,  105,  194,    3,   38,
+      2,   12,    3,   27,   91,  171,   19,   34,  418,   39,  135,   62,
+     13,   40,  265,   57,    5,    4,   35,   10,   85,   58,  264,   23,
+    102,    0,    1,    4,    3,   19,   18,
+};
+
+static const CimKeysymName cim_keysym_from_name_slots[2731] = {
+  { 0x01002897, 22894 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000006e3,  9742 },
+  { 0x0000ffd0,   898 },
+  { 0x01000691,  7104 },
+  { 0x01001ee3, 19283 },
+  { 0x0100056e, 17113 },
+  { 0x000006d0,  9497 },
+  { 0x00000ab0, 12173 },
+  { 0x010028f1, 24567 },
+  { 0x00000ae1, 12721 },
+  { 0x0000003b,  3958 },
+  { 0x0100053b, 17020 },
+  { 0x01002820, 20789 },
+  { 0x000007f3, 11055 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01000688,  7092 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000aca, 12382 },
+  { 0x0000006d,  4149 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x1008126b, 29255 },
+  { 0x00000de0, 14551 },
+  { 0x00000ae9, 12852 },
+  { 0x01000db7, 25279 },
+  { 0x01001e8b, 18308 },
+  { 0x000006dc,  9650 },
+  { 0x000007e9, 10935 },
+  { 0x010006d2,  8050 },
+  { 0x000005e4,  7667 },
+  { 0x00000de4, 14604 },
+  { 0x100811a9, 28168 },
+  { 0x0000ffe0,  1016 },
+  { 0x000006ba,  9178 },
+  { 0x01002801, 20275 },
+  { 0x000008c9, 11646 },
+  { 0x10081264, 29142 },
+  { 0x010020ab, 19708 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000ede, 15991 },
+  { 0x01000dd0, 25406 },
+  { 0x000004c5,  6690 },
+  { 0x1008ff30, 26123 },
+  { 0x010028b3, 23402 },
+  { 0x00000ec7, 15678 },
+  { 0x00000eb1, 15397 },
+  { 0x010028cf, 23921 },
+  { 0x01002856, 21724 },
+  { 0x000000fc,  5054 },
+  { 0x0100056a, 17007 },
+  { 0x01000da3, 25104 },
+  { 0x00000bc6, 13192 },
+  { 0x000005cd,  7458 },
+  { 0x01000580, 17570 },
+  { 0x01002247, 20086 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000ff55,   382 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01000d88, 24908 },
+  { 0x0000ff1b,    73 },
+  { 0x000009f7, 12033 },
+  { 0x000001aa,  5132 },
+  { 0x000009e4, 11858 },
+  { 0x000000df,  4805 },
+  { 0x00000ef2, 16354 },
+  { 0x000006c5,  9362 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x010010de, 17932 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000fe62,  2145 },
+  { 0x01001e57,  6180 },
+  { 0x01000d92, 24988 },
+  { 0x000005d8,  7584 },
+  { 0x01000259, 18361 },
+  { 0x000008b1, 11407 },
+  { 0x01002854, 21689 },
+  { 0x000004cb,  6738 },
+  { 0x010004bb,  8551 },
+  { 0x0000ffe1,  1024 },
+  { 0x1008ff7f, 27052 },
+  { 0x00000db7, 14085 },
+  { 0x000006ff, 10094 },
+  { 0x00000af8, 13007 },
+  { 0x0000002f,  3926 },
+  { 0x0000fe11,  1215 },
+  { 0x01002869, 22066 },
+  { 0x0100283c, 21273 },
+  { 0x0100049b,  8199 },
+  { 0x010010e3, 17998 },
+  { 0x000004d3,  6810 },
+  { 0x0000fe52,  1907 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000ff6b,   481 },
+  { 0x000003c0,  5876 },
+  { 0x01001eda, 19183 },
+  { 0x00000eb9, 15513 },
+  { 0x0000ffce,   888 },
+  { 0x00000023,  3814 },
+  { 0x010028b7, 23477 },
+  { 0x01002881, 22516 },
+  { 0x000000d9,  4749 },
+  { 0x00000041,  3999 },
+  { 0x000006c1,  9314 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x010010d6, 17830 },
+  { 0x0100056d, 17087 },
+  { 0x01000dc4, 25364 },
+  { 0x0000ff60,   421 },
+  { 0x0000fea5,  3410 },
+  { 0x01000dde, 25511 },
+  { 0x0000fd12,  3624 },
+  { 0x000002a6,  5545 },
+  { 0x01001ede, 19227 },
+  { 0x01001e8a, 18261 },
+  { 0x01002083, 19858 },
+  { 0x010028ce, 23902 },
+  { 0x000001c6,  5295 },
+  { 0x1008ff35, 26197 },
+  { 0x00000db9, 14114 },
+  { 0x00000ea2, 15138 },
+  { 0x000007d6, 10799 },
+  { 0x01000571, 17189 },
+  { 0x01000dca, 25389 },
+  { 0x010010ec, 18119 },
+  { 0x00000eff, 16531 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x10081279, 29454 },
+  { 0x010028f3, 24605 },
+  { 0x000005ed,  7796 },
+  { 0x01001ed8, 19143 },
+  { 0x00000dd5, 14445 },
+  { 0x000007b1, 10338 },
+  { 0x01002081, 19832 },
+  { 0x0000fe8b,  2570 },
+  { 0x000007c6, 10622 },
+  { 0x00000ecc, 15728 },
+  { 0x000001ae,  5155 },
+  { 0x01001ee6, 19317 },
+  { 0x00000eeb, 16218 },
+  { 0x000001af,  5162 },
+  { 0x00000ad3, 12539 },
+  { 0x00000cf3, 13629 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000006af,  8982 },
+  { 0x010006f9,  7009 },
+  { 0x00000db4, 14049 },
+  { 0x0000ff33, 14895 },
+  { 0x000007e3, 10864 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000ef7, 16452 },
+  { 0x00000dd0, 14383 },
+  { 0x000001de,  5392 },
+  { 0x0100049c,  8221 },
+  { 0x100811a4, 28124 },
+  { 0x01001eb1, 18637 },
+  { 0x0000feec,  3083 },
+  { 0x0000ffca,   856 },
+  { 0x1008126f, 29314 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000006fd, 10066 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0100285e, 21870 },
+  { 0x1008fe20, 27903 },
+  { 0x0000ff0a,    25 },
+  { 0x0000ffda,   973 },
+  { 0x0000fe51,  1896 },
+  { 0x000007d7, 10809 },
+  { 0x0000fe80,  2483 },
+  { 0x000000b4,  4404 },
+  { 0x000004b0,  6501 },
+  { 0x1008ff43, 26388 },
+  { 0x00000035,  3942 },
+  { 0x000002f8,  5729 },
+  { 0x01000da0, 25079 },
+  { 0x0000ff32, 14882 },
+  { 0x000005e0,  7619 },
+  { 0x01002849, 21497 },
+  { 0x01000d8a, 24924 },
+  { 0x0000ffd5,   938 },
+  { 0x000005f2,  7865 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x1008ff55, 26616 },
+  { 0x000002ab,  5567 },
+  { 0x00000db6, 14071 },
+  { 0x0100289d, 23003 },
+  { 0x01001ed1, 19026 },
+  { 0x0000ff3d, 15045 },
+  { 0x1008ff2d, 26089 },
+  { 0x01000577, 17345 },
+  { 0x01000d9d, 25052 },
+  { 0x000000b0,  4361 },
+  { 0x00000ae6, 12798 },
+  { 0x000006fb, 10042 },
+  { 0x00000da2, 13806 },
+  { 0x00000dc8, 14285 },
+  { 0x000006ce,  9474 },
+  { 0x000006d2,  9521 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000003dd,  5944 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01002087, 19914 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000dae, 13964 },
+  { 0x10081298, 29590 },
+  { 0x01001eb5, 18683 },
+  { 0x0100018f, 18355 },
+  { 0x010004e9,  8646 },
+  { 0x1008ff57, 26636 },
+  { 0x00000052,  4033 },
+  { 0x000006ea,  9827 },
+  { 0x00000af7, 12996 },
+  { 0x01001ec1, 18822 },
+  { 0x000006b8,  9130 },
+  { 0x1008ff16, 25799 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x010006af,  7970 },
+  { 0x01000669,  7226 },
+  { 0x0000ffcc,   874 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000006cc,  9450 },
+  { 0x000008a9, 11270 },
+  { 0x010004e8,  8631 },
+  { 0x0000ffd1,   905 },
+  { 0x01000535, 16872 },
+  { 0x00000ea4, 15175 },
+  { 0x000002bb,  5615 },
+  { 0x000005c3,  7305 },
+  { 0x0000fe31,  1815 },
+  { 0x01002891, 22789 },
+  { 0x00000ee9, 16188 },
+  { 0x010006d4,  7129 },
+  { 0x1008ff7a, 26989 },
+  { 0x0000002b,  3902 },
+  { 0x000004a5,  6385 },
+  { 0x0100054c, 17456 },
+  { 0x00000afd, 13074 },
+  { 0x01000dc6, 25381 },
+  { 0x0100054d, 17480 },
+  { 0x01000661,  7154 },
+  { 0x000006d5,  9557 },
+  { 0x100811ba, 28329 },
+  { 0x010004ef,  8679 },
+  { 0x01001e80,  6230 },
+  { 0x000001bf,  5264 },
+  { 0x00000ac4, 12334 },
+  { 0x000003e0,  5959 },
+  { 0x00000054,  4037 },
+  { 0x0000fee0,  2898 },
+  { 0x01001ee8, 19329 },
+  { 0x00000ab5, 12223 },
+  { 0x000006b9,  9153 },
+  { 0x000006e9,  9816 },
+  { 0x0100284d, 21566 },
+  { 0x1008fe0a, 27852 },
+  { 0x010010f6, 18249 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000006a7,  8797 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000001d9,  5373 },
+  { 0x000001bb,  5231 },
+  { 0x0000fd18,  3686 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0100288f, 22754 },
+  { 0x000007a7, 10222 },
+  { 0x00000aaa, 12129 },
+  { 0x0100286c, 22121 },
+  { 0x000001b3,  5187 },
+  { 0x01001eaa, 18527 },
+  { 0x010004ae,  8311 },
+  { 0x10081299, 29601 },
+  { 0x0000fee6,  2980 },
+  { 0x00000ea1, 15124 },
+  { 0x00000ed3, 15798 },
+  { 0x000005c9,  7405 },
+  { 0x000001b1,  5172 },
+  { 0x0000004d,  4023 },
+  { 0x010028d9, 24107 },
+  { 0x0000fe92,  2436 },
+  { 0x010028e8, 24393 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000fe71,  2713 },
+  { 0x1008ff06, 25658 },
+  { 0x0000ffc0,   817 },
+  { 0x01001ee1, 19258 },
+  { 0x000005ca,  7423 },
+  { 0x00000cf7, 13712 },
+  { 0x010010d9, 17868 },
+  { 0x000001d8,  5366 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x1008fe01, 27708 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01001eed, 19383 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000005ee,  7812 },
+  { 0x1008ff6c, 26846 },
+  { 0x1008fe05, 27772 },
+  { 0x0000fe23,  1503 },
+  { 0x00000af2, 12936 },
+  { 0x000009e9, 11867 },
+  { 0x00000eee, 16265 },
+  { 0x0100053d, 17074 },
+  { 0x0000fe6f,  2386 },
+  { 0x000002c6,  5644 },
+  { 0x1008ff58, 26645 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01000582, 17622 },
+  { 0x000006a9,  8858 },
+  { 0x10081260, 29040 },
+  { 0x000000f8,  5019 },
+  { 0x01002861, 21925 },
+  { 0x10081243, 28898 },
+  { 0x000004b6,  6551 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000069,  4141 },
+  { 0x01000dd8, 25459 },
+  { 0x00000ef5, 16420 },
+  { 0x0000ffc9,   853 },
+  { 0x000000ec,  4911 },
+  { 0x01002836, 21164 },
+  { 0x01001ef5, 19453 },
+  { 0x000007d2, 10763 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x100812a2, 29709 },
+  { 0x0000fef2,  3191 },
+  { 0x00000deb, 14705 },
+  { 0x0000fefb,  3353 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000007f4, 11077 },
+  { 0x10081193, 28083 },
+  { 0x01001ec9, 18951 },
+  { 0x0100287e, 22460 },
+  { 0x01000543, 17230 },
+  { 0x0000fe57,  1988 },
+  { 0x010028ed, 24488 },
+  { 0x00000dba, 14124 },
+  { 0x0000fe32,  1843 },
+  { 0x100811af, 28228 },
+  { 0x1008ff26, 26013 },
+  { 0x0000fea2,  3399 },
+  { 0x000000e5,  4856 },
+  { 0x000003e7,  5967 },
+  { 0x010010f3, 18211 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0100280b, 20432 },
+  { 0x000007d1, 10753 },
+  { 0x0100281c, 20717 },
+  { 0x000003bf,  5872 },
+  { 0x0100283d, 21291 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x010010d8, 17856 },
+  { 0x1008fe24, 27958 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01002202, 19958 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000fd15,  3655 },
+  { 0x0000ffc1,   820 },
+  { 0x100812bb, 30014 },
+  { 0x010028a5, 23146 },
+  { 0x0000047e,  6311 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000003c7,  5884 },
+  { 0x010010f5, 18236 },
+  { 0x000007ef, 11010 },
+  { 0x00000dc7, 14273 },
+  { 0x000007b4, 10392 },
+  { 0x1008ff75, 26922 },
+  { 0x0000fe2a,  1657 },
+  { 0x1008ff5d, 26697 },
+  { 0x01000dba, 25305 },
+  { 0x100812b0, 29853 },
+  { 0x01002841, 21364 },
+  { 0x000006ef,  9891 },
+  { 0x000004bc,  6599 },
+  { 0x0000fe6e,  2370 },
+  { 0x000007cb, 10690 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0100282c, 20989 },
+  { 0x000004a7,  6425 },
+  { 0x010028fa, 24744 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x010028c9, 23810 },
+  { 0x000000bd,  4494 },
+  { 0x0000ffd8,   959 },
+  { 0x0000fe88,  2539 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000008ab, 11306 },
+  { 0x000007b7, 10453 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000ff9d,   658 },
+  { 0x000003d2,  5919 },
+  { 0x000001c3,  5281 },
+  { 0x01002880, 22501 },
+  { 0x00000df7, 14837 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000fd03,  3444 },
+  { 0x000004a4,  6374 },
+  { 0x000007ed, 10992 },
+  { 0x000007a4, 10166 },
+  { 0x0000ffce,   884 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0100284b, 21531 },
+  { 0x000008fd, 11799 },
+  { 0x010020a1, 19603 },
+  { 0x0000ff0d,    40 },
+  { 0x100812b3, 29915 },
+  { 0x01000544, 17258 },
+  { 0x000007ea, 10946 },
+  { 0x000000d8,  4733 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000009f1, 11970 },
+  { 0x000006d8,  9593 },
+  { 0x00000ebb, 15544 },
+  { 0x000001b9,  5215 },
+  { 0x0000fe63,  2155 },
+  { 0x0000ff7e,   499 },
+  { 0x00000cdf, 13279 },
+  { 0x01000da8, 25150 },
+  { 0x010010d7, 17843 },
+  { 0x01002892, 22806 },
+  { 0x000008f6, 11772 },
+  { 0x010020a6, 19655 },
+  { 0x000000e3,  4838 },
+  { 0x00000021,  3798 },
+  { 0x01002079, 19805 },
+  { 0x000006d3,  9533 },
+  { 0x000005e7,  7712 },
+  { 0x000004cd,  6762 },
+  { 0x0000fff1, 20120 },
+  { 0x0000003f,  3987 },
+  { 0x010010df, 17945 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000002b9,  5606 },
+  { 0x01000dc2, 25346 },
+  { 0x0000fefd,  3301 },
+  { 0x000001a1,  5089 },
+  { 0x0100283f, 21329 },
+  { 0x00000bc2, 13166 },
+  { 0x000000c5,  4573 },
+  { 0x01001ebe, 18771 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000ea7, 15224 },
+  { 0x00ffffff,     0 },
+  { 0x01002894, 22841 },
+  { 0x000004b8,  6567 },
+  { 0x00000ed0, 15768 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000fe53,  1934 },
+  { 0x1008129f, 29673 },
+  { 0x00000cf6, 13700 },
+  { 0x00000aa8, 12112 },
+  { 0x01000db8, 25288 },
+  { 0x010028b2, 23384 },
+  { 0x00000ee2, 16071 },
+  { 0x01001eba, 18745 },
+  { 0x00000abd, 12286 },
+  { 0x1008ff04, 25620 },
+  { 0x00000df4, 14803 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000002a1,  5537 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0100280a, 20416 },
+  { 0x0000ffe3,  1040 },
+  { 0x000000a1,  4226 },
+  { 0x000004c1,  6640 },
+  { 0x000006a9,  8845 },
+  { 0x010004b1,  8375 },
+  { 0x0000fe89,  2546 },
+  { 0x0000ff9c,   651 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000fd17,  3675 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000004b4,  6537 },
+  { 0x00000abc, 12269 },
+  { 0x01000562, 16809 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000fe27,  1592 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x010004ee,  8661 },
+  { 0x000006f7,  9986 },
+  { 0x00000036,  3944 },
+  { 0x000007d0, 10744 },
+  { 0x01001ed2, 19043 },
+  { 0x000001cc,  5317 },
+  { 0x1008ff07, 25680 },
+  { 0x01002078, 19791 },
+  { 0x10081245, 28929 },
+  { 0x10081293, 29535 },
+  { 0x000009f6, 12028 },
+  { 0x0000fee3,  2936 },
+  { 0x010028f5, 24644 },
+  { 0x01001eb3, 18660 },
+  { 0x00000ad5, 12573 },
+  { 0x000006af,  8968 },
+  { 0x000006c9,  9411 },
+  { 0x01002802, 20290 },
+  { 0x00000062,  4127 },
+  { 0x1008ff50, 26544 },
+  { 0x000003fd,  6027 },
+  { 0x01001ea5, 18444 },
+  { 0x000004b7,  6559 },
+  { 0x0000fe79,  2863 },
+  { 0x0000ffdf,  1008 },
+  { 0x0100049a,  8177 },
+  { 0x00000dc0, 14197 },
+  { 0x000006db,  9637 },
+  { 0x01002840, 21349 },
+  { 0x01002845, 21429 },
+  { 0x0000ff96,   579 },
+  { 0x010010e7, 18052 },
+  { 0x00000dc5, 14253 },
+  { 0x0000ff38, 14962 },
+  { 0x0000003d,  3973 },
+  { 0x01002819, 20665 },
+  { 0x1008ff66, 26782 },
+  { 0x00000059,  4047 },
+  { 0x100812ab, 29817 },
+  { 0x0000fef6,  3259 },
+  { 0x0100284e, 21584 },
+  { 0x000006b2,  9017 },
+  { 0x0000fe30,  1790 },
+  { 0x000000fd,  5065 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000ff3e, 15070 },
+  { 0x00000bfc, 13269 },
+  { 0x0100019f, 18300 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01000575, 17296 },
+  { 0x00000073,  4161 },
+  { 0x000000f2,  4959 },
+  { 0x00000ce5, 13400 },
+  { 0x00000af1, 12929 },
+  { 0x0000fe5f,  2099 },
+  { 0x00000ce7, 13448 },
+  { 0x01000db9, 25296 },
+  { 0x0000ffde,  1000 },
+  { 0x000004c4,  6682 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x010028e5, 24335 },
+  { 0x1008ff9f, 27449 },
+  { 0x0000ff98,   593 },
+  { 0x000005ef,  7825 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000002b6,  5594 },
+  { 0x10081297, 29579 },
+  { 0x000001be,  5257 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000dc3, 14234 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000ce9, 13482 },
+  { 0x00000ed7, 15864 },
+  { 0x00000ea6, 15206 },
+  { 0x0000005c,  4063 },
+  { 0x1008ff12, 25736 },
+  { 0x1008ff88, 27144 },
+  { 0x010028d2, 23976 },
+  { 0x00000ab3, 12201 },
+  { 0x1008121b, 28769 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000ff58,   415 },
+  { 0x1008ff5a, 26665 },
+  { 0x0100056b, 17033 },
+  { 0x0100280d, 20465 },
+  { 0x01002873, 22250 },
+  { 0x01002086, 19901 },
+  { 0x1008124a, 28992 },
+  { 0x01002886, 22598 },
+  { 0x00000060,  4109 },
+  { 0x000001c0,  5274 },
+  { 0x00000de3, 14585 },
+  { 0x000005cc,  7446 },
+  { 0x01001ef2,  6280 },
+  { 0x0000ff68,   464 },
+  { 0x00000dac, 13939 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01000662,  7163 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000002e6,  5707 },
+  { 0x0000ff3f, 15095 },
+  { 0x000004a1,  6320 },
+  { 0x000000d4,  4694 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000005d,  4073 },
+  { 0x00000dd4, 14434 },
+  { 0x00000eaf, 15360 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000007a1, 10112 },
+  { 0x100811b8, 28293 },
+  { 0x010006f6,  6985 },
+  { 0x00000dcd, 14344 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01000da2, 25096 },
+  { 0x000006f2,  9926 },
+  { 0x00000dec, 14722 },
+  { 0x01002887, 22615 },
+  { 0x000001a5,  5111 },
+  { 0x000000f6,  4992 },
+  { 0x0000ff9a,   610 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x1008ff53, 26594 },
+  { 0x01000da1, 25087 },
+  { 0x10081219, 28738 },
+  { 0x1008ff4a, 26472 },
+  { 0x010028b8, 23497 },
+  { 0x0000ffe7,  1081 },
+  { 0x010028d4, 24013 },
+  { 0x0000ffcd,   881 },
+  { 0x00000078,  4171 },
+  { 0x0100281b, 20699 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000ab4, 12211 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000fee9,  3035 },
+  { 0x00000030,  3932 },
+  { 0x000004aa,  6446 },
+  { 0x01002853, 21671 },
+  { 0x1008ff47, 26436 },
+  { 0x010028de, 24204 },
+  { 0x010001e7, 18333 },
+  { 0x010028a6, 23164 },
+  { 0x1008ff22, 25950 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000007c5, 10608 },
+  { 0x000001a6,  5118 },
+  { 0x0000ff3d,   340 },
+  { 0x01000dbb, 25313 },
+  { 0x0000ffb7,   796 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x10081267, 29204 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000000c2,  4543 },
+  { 0x000002ac,  5574 },
+  { 0x00000ae4, 12771 },
+  { 0x00000abb, 12261 },
+  { 0x0000ffd1,   909 },
+  { 0x0000ff7e,  1265 },
+  { 0x0000feeb,  3067 },
+  { 0x01001ec4, 18871 },
+  { 0x0000ffde,  1004 },
+  { 0x0000fd11,  3610 },
+  { 0x01002850, 21621 },
+  { 0x1008ff85, 27110 },
+  { 0x000006f6,  9973 },
+  { 0x000003cc,  5892 },
+  { 0x1008ff77, 26952 },
+  { 0x1008ff20, 25923 },
+  { 0x00000ce7, 13436 },
+  { 0x010028fb, 24764 },
+  { 0x1008ffa2, 27478 },
+  { 0x1008ff9b, 27383 },
+  { 0x010028fd, 24805 },
+  { 0x00000dde, 14518 },
+  { 0x0000fea3,  3402 },
+  { 0x00000051,  4031 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000006f1,  9914 },
+  { 0x00000ab7, 12243 },
+  { 0x010028a0, 23061 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01000d83, 24877 },
+  { 0x01000dac, 25188 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01000d94, 25004 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x10081242, 28886 },
+  { 0x000000d5,  4706 },
+  { 0x1008ffa6, 27519 },
+  { 0x000006c7,  9386 },
+  { 0x0000ff89,   531 },
+  { 0x01002889, 22649 },
+  { 0x0000ff28,   236 },
+  { 0x010001d1, 18293 },
+  { 0x010006be,  8000 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000fe64,  2183 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000cf1, 13589 },
+  { 0x010028ec, 24469 },
+  { 0x0000002e,  3919 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01002852, 21654 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000004de,  6897 },
+  { 0x010028c2, 23686 },
+  { 0x0100283e, 21310 },
+  { 0x000006ac,  8908 },
+  { 0x01000dd3, 25433 },
+  { 0x0000ffdb,   980 },
+  { 0x0000ffd4,   931 },
+  { 0x0100054e, 17504 },
+  { 0x01001edb, 19194 },
+  { 0x010028c1, 23669 },
+  { 0x000000a6,  4264 },
+  { 0x0000ff31, 14875 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01001eea, 19351 },
+  { 0x1008ff96, 27309 },
+  { 0x00000ea8, 15238 },
+  { 0x1008ff2f, 26113 },
+  { 0x00000dcb, 14320 },
+  { 0x00000db0, 13990 },
+  { 0x000006cf,  9486 },
+  { 0x000006df,  9689 },
+  { 0x0000ffe4,  1050 },
+  { 0x0000ff21,   159 },
+  { 0x0000ff55,   388 },
+  { 0x01000dc0, 25329 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000003f2,  6002 },
+  { 0x1008ff8a, 27169 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01000da9, 25160 },
+  { 0x010028a4, 23129 },
+  { 0x0100066a,  7017 },
+  { 0x0000ffdd,   996 },
+  { 0x010004d9,  8580 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x1008ff8d, 27201 },
+  { 0x00000bcc, 13205 },
+  { 0x01002074, 19739 },
+  { 0x01002842, 21380 },
+  { 0x01000d95, 25011 },
+  { 0x010028bb, 23553 },
+  { 0x00000066,  4135 },
+  { 0x000000f9,  5028 },
+  { 0x01000583, 17650 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x1008ff76, 26937 },
+  { 0x000000c7,  4582 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000ffd0,   902 },
+  { 0x000007eb, 10970 },
+  { 0x000007e7, 10913 },
+  { 0x1008ff29, 26043 },
+  { 0x0100057e, 17517 },
+  { 0x000007f2, 11043 },
+  { 0x000000b9,  4446 },
+  { 0x010028f2, 24586 },
+  { 0x010028ff, 24847 },
+  { 0x00000aa9, 12122 },
+  { 0x000004cc,  6746 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000006e4,  9755 },
+  { 0x00000ec2, 15627 },
+  { 0x00000ac5, 12347 },
+  { 0x000000ad,  4336 },
+  { 0x0000ffad,   728 },
+  { 0x0000fe26,  1568 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000abe, 12299 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000007f5, 11087 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01001ebb, 18751 },
+  { 0x0000ffdc,   984 },
+  { 0x00000dd3, 14422 },
+  { 0x0000fd10,  3595 },
+  { 0x000007e1, 10841 },
+  { 0x000007e5, 10888 },
+  { 0x000007ba, 10515 },
+  { 0x01001ed5, 19093 },
+  { 0x10081296, 29568 },
+  { 0x01001ee0, 19247 },
+  { 0x000007c9, 10655 },
+  { 0x00000048,  4013 },
+  { 0x01000573, 17244 },
+  { 0x010028f4, 24625 },
+  { 0x010001a0, 19489 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000004a2,  6334 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x10081208, 28534 },
+  { 0x00000de7, 14655 },
+  { 0x000006f3,  9938 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000008c1, 11609 },
+  { 0x000001ca,  5309 },
+  { 0x000004a8,  6432 },
+  { 0x000004af,  6484 },
+  { 0x000004df,  6909 },
+  { 0x000004c8,  6714 },
+  { 0x00000dab, 13929 },
+  { 0x0000fd02,  3429 },
+  { 0x00000da1, 13795 },
+  { 0x0000005a,  4049 },
+  { 0x0000ffd7,   952 },
+  { 0x00000aa3, 12062 },
+  { 0x0000fd08,  3510 },
+  { 0x00000ce0, 13300 },
+  { 0x01000548, 17358 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x1008ff8b, 27178 },
+  { 0x01002844, 21413 },
+  { 0x1008ff63, 26759 },
+  { 0x01002208, 19984 },
+  { 0x010028aa, 23236 },
+  { 0x000000d2,  4680 },
+  { 0x010006f3,  6961 },
+  { 0x0000007a,  4175 },
+  { 0x0000fe2d,  1728 },
+  { 0x0000fd06,  3480 },
+  { 0x00000ebf, 15598 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01000309, 19561 },
+  { 0x00000dce, 14354 },
+  { 0x00000cf1, 13603 },
+  { 0x000006e8,  9804 },
+  { 0x00000ecd, 15737 },
+  { 0x01000585, 17699 },
+  { 0x000005f1,  7851 },
+  { 0x01000589, 16563 },
+  { 0x010028ac, 23273 },
+  { 0x0000ffcb,   867 },
+  { 0x010028cd, 23883 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000ff63,   442 },
+  { 0x0000fd0a,  3531 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000ffed,  1123 },
+  { 0x010028dd, 24184 },
+  { 0x1008ff48, 26448 },
+  { 0x0000ffb2,   771 },
+  { 0x1008ff31, 26137 },
+  { 0x0000fe55,  1963 },
+  { 0x100812aa, 29805 },
+  { 0x010010d1, 17766 },
+  { 0x1008ff33, 26167 },
+  { 0x00000aae, 12148 },
+  { 0x0000fea1,  3396 },
+  { 0x00000eba, 15531 },
+  { 0x0000002a,  3893 },
+  { 0x0000ffc9,   849 },
+  { 0x0000ff3c, 15022 },
+  { 0x010028e7, 24373 },
+  { 0x0000ff52,   368 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0100221a, 20018 },
+  { 0x0100222d, 20059 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000000d0,  4669 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000fea4,  3406 },
+  { 0x000008a3, 11183 },
+  { 0x00000ce6, 13411 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x010020a8, 19676 },
+  { 0x1008ff90, 27235 },
+  { 0x0000fee4,  2949 },
+  { 0x000006b6,  9094 },
+  { 0x00000da5, 13847 },
+  { 0x00000ef9, 16483 },
+  { 0x000006a4,  8735 },
+  { 0x0000fe69,  2278 },
+  { 0x1008fe08, 27820 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000ff95,   571 },
+  { 0x01000547, 17332 },
+  { 0x000008b2, 11424 },
+  { 0x01002808, 20385 },
+  { 0x0000ff26,   209 },
+  { 0x00000bcf, 13217 },
+  { 0x01000554, 17664 },
+  { 0x0000fd1a,  3716 },
+  { 0x01000663,  7172 },
+  { 0x100812b2, 29894 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01000569, 16982 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000daa, 13915 },
+  { 0x0000ffe8,  1088 },
+  { 0x000000ce,  4642 },
+  { 0x01001eb7, 18710 },
+  { 0x010010eb, 18106 },
+  { 0x00000027,  3850 },
+  { 0x0000fe70,  2698 },
+  { 0x01000664,  7181 },
+  { 0x000004be,  6616 },
+  { 0x10081202, 28456 },
+  { 0x00000de9, 14681 },
+  { 0x010028f8, 24705 },
+  { 0x00000aea, 12872 },
+  { 0x1008ff38, 26232 },
+  { 0x1008ff92, 27264 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x100812a5, 29745 },
+  { 0x00000abf, 12317 },
+  { 0x01000584, 17676 },
+  { 0x01000dda, 25476 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x010020a2, 19613 },
+  { 0x0000ff22,   165 },
+  { 0x0000ff27,   218 },
+  { 0x010001d2, 18340 },
+  { 0x0000fd13,  3634 },
+  { 0x0000ffb3,   776 },
+  { 0x000006e5,  9767 },
+  { 0x0000ff62,   434 },
+  { 0x000007cb, 10678 },
+  { 0x1008ff97, 27317 },
+  { 0x0100285f, 21889 },
+  { 0x0000ffcf,   891 },
+  { 0x1008ff34, 26182 },
+  { 0x1008ffa7, 27528 },
+  { 0x000003f3,  6010 },
+  { 0x10081263, 29114 },
+  { 0x000006f8,  9998 },
+  { 0x000008a8, 11253 },
+  { 0x000000dd,  4786 },
+  { 0x000001fb,  5506 },
+  { 0x10081268, 29218 },
+  { 0x1008ff6e, 26867 },
+  { 0x10081273, 29373 },
+  { 0x000004a5,  6402 },
+  { 0x000009f4, 12015 },
+  { 0x000002bc,  5622 },
+  { 0x010004ba,  8537 },
+  { 0x1008ff59, 26653 },
+  { 0x10081269, 29229 },
+  { 0x01000570, 17164 },
+  { 0x1008ffa5, 27508 },
+  { 0x00000bdc, 13260 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000fe65,  2218 },
+  { 0x000006a7,  8810 },
+  { 0x00000ce3, 13363 },
+  { 0x1008ff2b, 26068 },
+  { 0x0000feef,  3137 },
+  { 0x0000fe34,  1875 },
+  { 0x100812a4, 29733 },
+  { 0x000004b9,  6575 },
+  { 0x0000ffbd,   687 },
+  { 0x00000adb, 12618 },
+  { 0x01001eae, 18601 },
+  { 0x000006e6,  9779 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000bd3, 13224 },
+  { 0x0000fe8c,  2589 },
+  { 0x00000ef8, 16466 },
+  { 0x00000eb4, 15441 },
+  { 0x01001e6b,  6220 },
+  { 0x01002077, 19777 },
+  { 0x01001ef0, 19415 },
+  { 0x01000df3, 25539 },
+  { 0x0000002c,  3907 },
+  { 0x000001b6,  5202 },
+  { 0x0000ff37, 14945 },
+  { 0x0100055a, 17734 },
+  { 0x0000fe75,  2789 },
+  { 0x01000549, 17382 },
+  { 0x00000cee, 13551 },
+  { 0x100812ad, 29841 },
+  { 0x000000c8,  4591 },
+  { 0x00000ba3, 13119 },
+  { 0x000000e1,  4819 },
+  { 0x01002834, 21129 },
+  { 0x000007d5, 10785 },
+  { 0x01002821, 20804 },
+  { 0x01002882, 22532 },
+  { 0x0000006e,  4151 },
+  { 0x0100057a, 17420 },
+  { 0x000005c2,  7286 },
+  { 0x00000064,  4131 },
+  { 0x01001eb9, 18735 },
+  { 0x0000ffaa,   696 },
+  { 0x000001a2,  5097 },
+  { 0x0000fe84,  2511 },
+  { 0x1008ff18, 25827 },
+  { 0x010028a8, 23201 },
+  { 0x00000aeb, 12884 },
+  { 0x000004cf,  6778 },
+  { 0x00000db8, 14100 },
+  { 0x01000551, 17582 },
+  { 0x10081249, 28976 },
+  { 0x000008dd, 11727 },
+  { 0x000000a8,  4282 },
+  { 0x1008ff6d, 26857 },
+  { 0x01001e82,  6244 },
+  { 0x00000ce3, 13376 },
+  { 0x000000e2,  4826 },
+  { 0x0000ff9b,   630 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x1008ff10, 25703 },
+  { 0x0000ff51,   363 },
+  { 0x0100285b, 21814 },
+  { 0x01000db6, 25271 },
+  { 0x0100288b, 22683 },
+  { 0x00000af3, 12949 },
+  { 0x000001cf,  5324 },
+  { 0x010028cb, 23846 },
+  { 0x000007eb, 10958 },
+  { 0x010010f4, 18223 },
+  { 0x000000ab,  4314 },
+  { 0x010028d7, 24069 },
+  { 0x1008ff5e, 26710 },
+  { 0x01000175,  6054 },
+  { 0x000000de,  4793 },
+  { 0x1008ff39, 26244 },
+  { 0x01001ea7, 18478 },
+  { 0x01000581, 17595 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0100054b, 17432 },
+  { 0x000008b5, 11493 },
+  { 0x0000ffee,  1131 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x1008120b, 28576 },
+  { 0x00000db5, 14060 },
+  { 0x000001ef,  5451 },
+  { 0x000006f4,  9950 },
+  { 0x010028b4, 23421 },
+  { 0x0000fe05,  1199 },
+  { 0x01002848, 21481 },
+  { 0x0100282f, 21042 },
+  { 0x0000ffc7,   838 },
+  { 0x100812b1, 29874 },
+  { 0x01001ead, 18581 },
+  { 0x01001ef6, 19463 },
+  { 0x1008ff2a, 26055 },
+  { 0x00000053,  4035 },
+  { 0x00000ce1, 13313 },
+  { 0x010001b5, 18278 },
+  { 0x0000ff61,   428 },
+  { 0x000008be, 11573 },
+  { 0x0100056f, 17139 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01002088, 19929 },
+  { 0x000000eb,  4900 },
+  { 0x000003bc,  5861 },
+  { 0x01000589, 16582 },
+  { 0x00000dc2, 14223 },
+  { 0x01000579, 17395 },
+  { 0x00000ce8, 13470 },
+  { 0x010028ba, 23534 },
+  { 0x0100286b, 22102 },
+  { 0x000008da, 11694 },
+  { 0x01000564, 16860 },
+  { 0x01002899, 22930 },
+  { 0x0000ff20,    87 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000bda, 13251 },
+  { 0x00000eb6, 15470 },
+  { 0x1008ff45, 26412 },
+  { 0x1008121c, 28785 },
+  { 0x010004b0,  8351 },
+  { 0x000003a2,  5760 },
+  { 0x10081251, 29022 },
+  { 0x000003ef,  5985 },
+  { 0x0000fe28,  1612 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01000686,  7079 },
+  { 0x010010ef, 18159 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000ff7f,   513 },
+  { 0x01000d8b, 24932 },
+  { 0x000000c4,  4562 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x010010f2, 18198 },
+  { 0x10081206, 28508 },
+  { 0x01000db4, 25254 },
+  { 0x0000ff09,    21 },
+  { 0x00000aa6, 12091 },
+  { 0x0000fd14,  3645 },
+  { 0x000004a3,  6354 },
+  { 0x01000541, 17176 },
+  { 0x000006da,  9625 },
+  { 0x100810f5, 28011 },
+  { 0x010001af, 19501 },
+  { 0x000000b8,  4438 },
+  { 0x000003d3,  5927 },
+  { 0x1008ff41, 26364 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01000177,  6078 },
+  { 0x010004af,  8331 },
+  { 0x010028c0, 23653 },
+  { 0x100811d1, 28402 },
+  { 0x0000fee7,  2997 },
+  { 0x01001e83,  6251 },
+  { 0x000003ac,  5812 },
+  { 0x1008ff1a, 25849 },
+  { 0x00000da9, 13901 },
+  { 0x00000eb7, 15487 },
+  { 0x1008127a, 29478 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000fe78,  2847 },
+  { 0x0100282b, 20971 },
+  { 0x1008ff1e, 25901 },
+  { 0x01000d82, 24869 },
+  { 0x000006e7,  9791 },
+  { 0x000006d7,  9581 },
+  { 0x000005d7,  7573 },
+  { 0x01000666,  7199 },
+  { 0x01000da7, 25141 },
+  { 0x00000ef0, 16304 },
+  { 0x000003ec,  5975 },
+  { 0x000005f0,  7838 },
+  { 0x00000acc, 12414 },
+  { 0x01002804, 20321 },
+  { 0x10081215, 28675 },
+  { 0x00000022,  3805 },
+  { 0x00000aec, 12897 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01000d9c, 25044 },
+  { 0x00000ab2, 12192 },
+  { 0x0000ffd9,   966 },
+  { 0x1008126d, 29286 },
+  { 0x00000ce4, 13390 },
+  { 0x01001ecf, 19003 },
+  { 0x0000fe86,  2525 },
+  { 0x00000068,  4139 },
+  { 0x00000cea, 13493 },
+  { 0x00000ed2, 15788 },
+  { 0x000003ab,  5803 },
+  { 0x010028fe, 24826 },
+  { 0x000006e0,  9707 },
+  { 0x00000ce6, 13423 },
+  { 0x1008ff1f, 25910 },
+  { 0x01001ec8, 18945 },
+  { 0x01000dd6, 25450 },
+  { 0x1008ff32, 26152 },
+  { 0x01001ec3, 18855 },
+  { 0x0000ffd4,   927 },
+  { 0x0000ff3e,   141 },
+  { 0x1008ffa9, 27554 },
+  { 0x000000fe,  5072 },
+  { 0x0000fe08,  1312 },
+  { 0x00000034,  3940 },
+  { 0x000000f4,  4973 },
+  { 0x010004b7,  8466 },
+  { 0x01001ef8, 19475 },
+  { 0x0000ff9f,   677 },
+  { 0x000007a9, 10262 },
+  { 0x010010e4, 18010 },
+  { 0x0000004f,  4027 },
+  { 0x000003bd,  5868 },
+  { 0x1008120d, 28606 },
+  { 0x000000b1,  4368 },
+  { 0x00000ec9, 15697 },
+  { 0x000008a7, 11236 },
+  { 0x010006f7,  6993 },
+  { 0x00000cf7, 13724 },
+  { 0x000005e1,  7634 },
+  { 0x0000fef0,  3155 },
+  { 0x100811bd, 28363 },
+  { 0x000005e6,  7690 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000fef8,  3287 },
+  { 0x000008c8, 11634 },
+  { 0x000005d6,  7562 },
+  { 0x00000eb5, 15458 },
+  { 0x000009ec, 11899 },
+  { 0x010020a3, 19626 },
+  { 0x000004d9,  6858 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0100285d, 21851 },
+  { 0x1008129e, 29661 },
+  { 0x0000ff7e,   487 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x10081272, 29357 },
+  { 0x1008ffb8, 27693 },
+  { 0x01000daf, 25217 },
+  { 0x0000ffbe,   811 },
+  { 0x10081166, 28026 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000002d5,  5656 },
+  { 0x0000004e,  4025 },
+  { 0x00000cf9, 13747 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000ec3, 15638 },
+  { 0x1008ff3d, 26306 },
+  { 0x0000ffd7,   948 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x1008ffb3, 27621 },
+  { 0x000008ce, 11668 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000db1, 14003 },
+  { 0x00000042,  4001 },
+  { 0x00000af6, 12984 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000000a5,  4260 },
+  { 0x0000006a,  4143 },
+  { 0x1008ff7d, 27024 },
+  { 0x00000cf4, 13644 },
+  { 0x1008ff80, 27065 },
+  { 0x0000fe22,  1484 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000005d0,  7492 },
+  { 0x01001ef1, 19429 },
+  { 0x00000dd1, 14394 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01002847, 21463 },
+  { 0x01002803, 20305 },
+  { 0x01000534, 16848 },
+  { 0x1008ff95, 27300 },
+  { 0x1008ff7b, 27005 },
+  { 0x000000af,  4354 },
+  { 0x01002890, 22773 },
+  { 0x01002082, 19845 },
+  { 0x00000ee3, 16091 },
+  { 0x01000552, 17608 },
+  { 0x1008ff03, 25598 },
+  { 0x00000060,  4115 },
+  { 0x0000fe6b,  2315 },
+  { 0x0100054f, 17530 },
+  { 0x00000ef4, 16394 },
+  { 0x0000fe03,  1165 },
+  { 0x000008fc, 11791 },
+  { 0x000006b7,  9118 },
+  { 0x1008129b, 29625 },
+  { 0x01002824, 20853 },
+  { 0x000004b3,  6530 },
+  { 0x00000aa5, 12080 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000fff9, 20232 },
+  { 0x01002857, 21742 },
+  { 0x010028b6, 23458 },
+  { 0x000006ed,  9867 },
+  { 0x10081270, 29325 },
+  { 0x0000ffe6,  1070 },
+  { 0x0000ff9b,   638 },
+  { 0x0000fe61,  2135 },
+  { 0x0100288d, 22718 },
+  { 0x010028e4, 24317 },
+  { 0x00000edb, 15935 },
+  { 0x000003aa,  5795 },
+  { 0x00000037,  3946 },
+  { 0x00000ace, 12449 },
+  { 0x00000afb, 13048 },
+  { 0x010028e0, 24245 },
+  { 0x00000ec6, 15668 },
+  { 0x000001f2,  5473 },
+  { 0x10081203, 28469 },
+  { 0x1008120c, 28593 },
+  { 0x0000fd0c,  3549 },
+  { 0x0000ff66,   454 },
+  { 0x000007a3, 10150 },
+  { 0x0000fd1c,  3746 },
+  { 0x000004ba,  6583 },
+  { 0x010028c7, 23774 },
+  { 0x1008120f, 28632 },
+  { 0x10081271, 29342 },
+  { 0x000001bc,  5238 },
+  { 0x000008a1, 11156 },
+  { 0x01000497,  8154 },
+  { 0x1008ff25, 25997 },
+  { 0x00000dd9, 14493 },
+  { 0x000005e9,  7734 },
+  { 0x00000074,  4163 },
+  { 0x000005ac,  7116 },
+  { 0x1008ffa4, 27498 },
+  { 0x01000561, 16783 },
+  { 0x100812a1, 29697 },
+  { 0x00000dc4, 14245 },
+  { 0x10081210, 28645 },
+  { 0x0000ff7e,  6925 },
+  { 0x1008120a, 28560 },
+  { 0x0000ffdf,  1012 },
+  { 0x00000ed5, 15823 },
+  { 0x01000dbd, 25321 },
+  { 0x010028a7, 23182 },
+  { 0x000000de,  4799 },
+  { 0x000004d4,  6818 },
+  { 0x00000cf5, 13654 },
+  { 0x100811ac, 28198 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000ff2f,   304 },
+  { 0x000008a2, 11168 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x1008129d, 29649 },
+  { 0x000001e8,  5429 },
+  { 0x0000007c,  4187 },
+  { 0x0100284f, 21602 },
+  { 0x0000ff99,   602 },
+  { 0x000007ec, 10983 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000009ef, 11940 },
+  { 0x010006ba,  7981 },
+  { 0x000001a9,  5125 },
+  { 0x0000ff56,   401 },
+  { 0x100812a3, 29721 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000001e6,  5422 },
+  { 0x1008126a, 29242 },
+  { 0x01002846, 21446 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000005c4,  7324 },
+  { 0x0000ff3c,   107 },
+  { 0x0000fe87,  2532 },
+  { 0x0000ffd5,   934 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x010028ef, 24528 },
+  { 0x01000572, 17216 },
+  { 0x000006dd,  9661 },
+  { 0x00000ebe, 15585 },
+  { 0x000003d9,  5936 },
+  { 0x1008ff6b, 26837 },
+  { 0x0100282a, 20954 },
+  { 0x000005bb,  7235 },
+  { 0x0000fd0f,  3578 },
+  { 0x1008ff93, 27274 },
+  { 0x000007a8, 10242 },
+  { 0x0000fe65,  2194 },
+  { 0x01001ee4, 19297 },
+  { 0x0000fe83,  2504 },
+  { 0x000000f0,  4948 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000af0, 12916 },
+  { 0x00000057,  4043 },
+  { 0x0000fe5a,  2035 },
+  { 0x00000ee8, 16173 },
+  { 0x000006ca,  9422 },
+  { 0x0000fe66,  2229 },
+  { 0x100810f4, 27992 },
+  { 0x01000db5, 25262 },
+  { 0x000002f5,  5719 },
+  { 0x01002085, 19887 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000007ce, 10721 },
+  { 0x1008ff02, 25578 },
+  { 0x0000fe12,  1232 },
+  { 0x010010d5, 17817 },
+  { 0x00000cec, 13522 },
+  { 0x00000027,  3861 },
+  { 0x000009e0, 11826 },
+  { 0x000006a5,  8760 },
+  { 0x01001ea9, 18511 },
+  { 0x1008ff84, 27099 },
+  { 0x01001ed0, 19009 },
+  { 0x0000ff3b, 15005 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01000da5, 25122 },
+  { 0x10081188, 28059 },
+  { 0x01000d9a, 25027 },
+  { 0x000003bb,  5852 },
+  { 0x000001d2,  5346 },
+  { 0x000005e5,  7678 },
+  { 0x00000acf, 12462 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x10081278, 29433 },
+  { 0x000000a2,  4237 },
+  { 0x00000dad, 13952 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000ba6, 13129 },
+  { 0x1008129a, 29613 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x1008ff91, 27251 },
+  { 0x01001eb4, 18671 },
+  { 0x00000058,  4045 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000001e0,  5401 },
+  { 0x00000ef3, 16369 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01001ebf, 18788 },
+  { 0x0000ffaf,   751 },
+  { 0x000008a6, 11222 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000ffc8,   842 },
+  { 0x0000ff37,    97 },
+  { 0x10081291, 29513 },
+  { 0x01000dd4, 25442 },
+  { 0x010010ea, 18093 },
+  { 0x000009f5, 12021 },
+  { 0x0000fefa,  3334 },
+  { 0x0000fe82,  2497 },
+  { 0x00000df2, 14778 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000007bb, 10543 },
+  { 0x01002883, 22548 },
+  { 0x0100057d, 17492 },
+  { 0x00000dd6, 14457 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000001fe,  5519 },
+  { 0x0000ff54,   377 },
+  { 0x00000eb3, 15423 },
+  { 0x100811bc, 28340 },
+  { 0x0000fd1e,  3781 },
+  { 0x000000aa,  4302 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01000292, 18371 },
+  { 0x000008cd, 11659 },
+  { 0x00000ac3, 12324 },
+  { 0x000001ff,  5528 },
+  { 0x01000d8d, 24947 },
+  { 0x1008fe23, 27943 },
+  { 0x00000df1, 14765 },
+  { 0x00000aa4, 12071 },
+  { 0x01002080, 19818 },
+  { 0x000006c0,  9302 },
+  { 0x000009eb, 11885 },
+  { 0x0000ffae,   740 },
+  { 0x01000dc3, 25356 },
+  { 0x000001f5,  5480 },
+  { 0x000007f6, 11101 },
+  { 0x000008ae, 11349 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000006bf,  9276 },
+  { 0x1008ff8e, 27210 },
+  { 0x0000fe07,  1297 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x010028ca, 23828 },
+  { 0x010010dc, 17907 },
+  { 0x010028b1, 23366 },
+  { 0x1008ff81, 27078 },
+  { 0x000000fb,  5042 },
+  { 0x0000ffc5,   832 },
+  { 0x000004ce,  6770 },
+  { 0x01002877, 22325 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01001ec7, 18925 },
+  { 0x0100057f, 17544 },
+  { 0x00000061,  4125 },
+  { 0x00000ed9, 15899 },
+  { 0x000006a6,  8774 },
+  { 0x00000033,  3938 },
+  { 0x000005e2,  7645 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000ad1, 12498 },
+  { 0x000003ba,  5844 },
+  { 0x01001e03,  6100 },
+  { 0x000003a3,  5770 },
+  { 0x0100053e, 17100 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x010006cc,  8033 },
+  { 0x1008ffb2, 27604 },
+  { 0x010028b5, 23439 },
+  { 0x01001ea1, 18405 },
+  { 0x01002818, 20649 },
+  { 0x1008ff46, 26424 },
+  { 0x000001a3,  5103 },
+  { 0x01002863, 21959 },
+  { 0x1008ff19, 25840 },
+  { 0x00000032,  3936 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x10081246, 28945 },
+  { 0x0000ffd2,   913 },
+  { 0x000001c8,  5302 },
+  { 0x100811a6, 28138 },
+  { 0x00000bc0, 13158 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x010028e1, 24262 },
+  { 0x0100288e, 22736 },
+  { 0x01002811, 20532 },
+  { 0x0000003a,  3952 },
+  { 0x0000fe60,  2121 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000fee2,  2925 },
+  { 0x000007b2, 10356 },
+  { 0x000005e7,  7702 },
+  { 0x000008fe, 11810 },
+  { 0x1008ff3b, 26273 },
+  { 0x00000de6, 14641 },
+  { 0x0000ffb6,   791 },
+  { 0x00000ef1, 16329 },
+  { 0x00000df0, 14753 },
+  { 0x00000eea, 16203 },
+  { 0x00000bc3, 13175 },
+  { 0x00000043,  4003 },
+  { 0x000000c9,  4598 },
+  { 0x010010d3, 17792 },
+  { 0x000007a2, 10130 },
+  { 0x1008ff1b, 25859 },
+  { 0x010004b8,  8489 },
+  { 0x0100281a, 20682 },
+  { 0x1008ff74, 26904 },
+  { 0x000000db,  4763 },
+  { 0x0100280f, 20499 },
+  { 0x0000fef3,  3209 },
+  { 0x00000dc9, 14297 },
+  { 0x01000dc5, 25372 },
+  { 0x1008ff36, 26211 },
+  { 0x000005bf,  7252 },
+  { 0x0100012d, 18318 },
+  { 0x1008fe0b, 27869 },
+  { 0x01000655,  7916 },
+  { 0x1008ffa0, 27458 },
+  { 0x01000566, 16912 },
+  { 0x010028ad, 23291 },
+  { 0x0100287d, 22440 },
+  { 0x1008ff73, 26893 },
+  { 0x01000587, 16542 },
+  { 0x01000dcf, 25397 },
+  { 0x1008ff9d, 27418 },
+  { 0x0000fff2, 20134 },
+  { 0x0000ffe9,  1095 },
+  { 0x000006be,  9256 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01002810, 20517 },
+  { 0x0100222c, 20049 },
+  { 0x00000020,  3792 },
+  { 0x000001e5,  5415 },
+  { 0x000000ac,  4328 },
+  { 0x0000ff3d,   123 },
+  { 0x000000a4,  4251 },
+  { 0x00000070,  4155 },
+  { 0x000007cc, 10703 },
+  { 0x0000ff2e,   293 },
+  { 0x01000578, 17370 },
+  { 0x0000ff65,   449 },
+  { 0x00000049,  4015 },
+  { 0x000003fe,  6034 },
+  { 0x0100289b, 22966 },
+  { 0x0000007e,  4202 },
+  { 0x01000665,  7190 },
+  { 0x0000fe2b,  1682 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x010006a9,  7957 },
+  { 0x010006a4,  7946 },
+  { 0x00000ab8, 12254 },
+  { 0x1008ffb1, 27588 },
+  { 0x01001eb8, 18725 },
+  { 0x0000ffb5,   786 },
+  { 0x01002815, 20597 },
+  { 0x00000ad7, 12590 },
+  { 0x10081218, 28723 },
+  { 0x00000ac9, 12372 },
+  { 0x01000574, 17271 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000006b4,  9056 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000dbf, 14186 },
+  { 0x01001ef4, 19443 },
+  { 0x000002de,  5685 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x010028eb, 24449 },
+  { 0x01001eb6, 18695 },
+  { 0x1008ffa1, 27469 },
+  { 0x00000ec8, 15687 },
+  { 0x000013bd,  6297 },
+  { 0x0000fff4, 20162 },
+  { 0x01002823, 20836 },
+  { 0x0000ffb0,   761 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01002828, 20921 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000fe01,  1139 },
+  { 0x0000007d,  4191 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000007cf, 10730 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000fff3, 20148 },
+  { 0x00000dd7, 14469 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000fe73,  2755 },
+  { 0x0000fef5,  3245 },
+  { 0x1008ff89, 27160 },
+  { 0x10081247, 28962 },
+  { 0x1008ff05, 25638 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000ebd, 15571 },
+  { 0x000000d0,  4665 },
+  { 0x00000eb0, 15379 },
+  { 0x010028c8, 23793 },
+  { 0x00000ef6, 16439 },
+  { 0x1008129c, 29637 },
+  { 0x000009f2, 11985 },
+  { 0x000008de, 11733 },
+  { 0x00000ec1, 15617 },
+  { 0x10081250, 29004 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000daf, 13977 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000009ed, 11912 },
+  { 0x01001ea0, 18395 },
+  { 0x1008ff13, 25750 },
+  { 0x1008ff5f, 26719 },
+  { 0x01002089, 19944 },
+  { 0x0100057c, 17468 },
+  { 0x000007e4, 10876 },
+  { 0x00000afa, 13030 },
+  { 0x1008121a, 28753 },
+  { 0x000001ac,  5148 },
+  { 0x0000fe25,  1545 },
+  { 0x00000ea3, 15157 },
+  { 0x000007b9, 10493 },
+  { 0x0100283b, 21254 },
+  { 0x00000ee5, 16121 },
+  { 0x0000ff15,    65 },
+  { 0x00000aee, 12910 },
+  { 0x000004bf,  6624 },
+  { 0x010001b6, 18325 },
+  { 0x00000ecb, 15718 },
+  { 0x000008cf, 11676 },
+  { 0x0000ff93,   559 },
+  { 0x0100056c, 17060 },
+  { 0x000006fc, 10055 },
+  { 0x010028ee, 24508 },
+  { 0x01000654,  7897 },
+  { 0x01001edc, 19205 },
+  { 0x00000dc1, 14213 },
+  { 0x00000da3, 13819 },
+  { 0x0000fff5, 20176 },
+  { 0x000004c7,  6706 },
+  { 0x1008ff27, 26022 },
+  { 0x000006a8,  8834 },
+  { 0x1008ff70, 26877 },
+  { 0x00000ddf, 14541 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000fe0d,  1398 },
+  { 0x00000bd8, 13241 },
+  { 0x00000067,  4137 },
+  { 0x00000024,  3825 },
+  { 0x0000fe0e,  1419 },
+  { 0x0100282e, 21024 },
+  { 0x000007d9, 10829 },
+  { 0x010006f1,  6945 },
+  { 0x000000da,  4756 },
+  { 0x000020ac, 19717 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01001eca, 18957 },
+  { 0x0000ffe5,  1060 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000dbc, 14149 },
+  { 0x000007b6, 10428 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01001e56,  6170 },
+  { 0x0100289a, 22948 },
+  { 0x000001d5,  5353 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01002859, 21778 },
+  { 0x10081216, 28692 },
+  { 0x0000fea0,  3393 },
+  { 0x00000ea9, 15257 },
+  { 0x0000fe21,  1467 },
+  { 0x000001b7,  5209 },
+  { 0x000005d4,  7538 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01002805, 20336 },
+  { 0x010028d6, 24050 },
+  { 0x01002876, 22306 },
+  { 0x0000fe77,  2824 },
+  { 0x100811b6, 28261 },
+  { 0x100812b8, 29966 },
+  { 0x000007b5, 10409 },
+  { 0x010010e8, 18065 },
+  { 0x000006de,  9676 },
+  { 0x0000ff08,    11 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000008c5, 11628 },
+  { 0x00000da8, 13888 },
+  { 0x000006cd,  9462 },
+  { 0x000003d1,  5910 },
+  { 0x01001eb2, 18649 },
+  { 0x01002855, 21706 },
+  { 0x000009ea, 11870 },
+  { 0x0000ff0b,    34 },
+  { 0x01002830, 21061 },
+  { 0x00000ecf, 15758 },
+  { 0x0000ff8d,   538 },
+  { 0x1008fe04, 27756 },
+  { 0x01000576, 17320 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x1008ff82, 27088 },
+  { 0x000007d8, 10819 },
+  { 0x010001e6, 18286 },
+  { 0x1008ff4c, 26496 },
+  { 0x0100220b, 20007 },
+  { 0x000002fe,  5748 },
+  { 0x0000fff6, 20190 },
+  { 0x0000ffc8,   846 },
+  { 0x1008ff68, 26805 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x010010ed, 18132 },
+  { 0x000013be,  6300 },
+  { 0x0000fe50,  1885 },
+  { 0x00000df3, 14791 },
+  { 0x0000fe5b,  2046 },
+  { 0x000006a8,  8822 },
+  { 0x01002860, 21909 },
+  { 0x01000542, 17202 },
+  { 0x00000dbe, 14173 },
+  { 0x000006ec,  9855 },
+  { 0x1008fe0c, 27886 },
+  { 0x000005d1,  7504 },
+  { 0x000006c8,  9399 },
+  { 0x000003de,  5951 },
+  { 0x0000ffbf,   814 },
+  { 0x0000004a,  4017 },
+  { 0x010028c4, 23721 },
+  { 0x010001a1, 19495 },
+  { 0x00000af5, 12971 },
+  { 0x01002862, 21942 },
+  { 0x01000d96, 25019 },
+  { 0x100811b7, 28277 },
+  { 0x000009e8, 11864 },
+  { 0x0000fd0e,  3568 },
+  { 0x00000ab6, 12234 },
+  { 0x000009f8, 12038 },
+  { 0x0000fd1b,  3732 },
+  { 0x10081230, 28839 },
+  { 0x0100287c, 22421 },
+  { 0x0100286f, 22177 },
+  { 0x000006d9,  9611 },
+  { 0x01000daa, 25169 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000fe04,  1182 },
+  { 0x1008ffb7, 27670 },
+  { 0x0000fe06,  1281 },
+  { 0x000000ae,  4343 },
+  { 0x0000fe85,  2518 },
+  { 0x0000fe0c,  1382 },
+  { 0x0000fd16,  3665 },
+  { 0x01001ec5, 18888 },
+  { 0x0000ff24,   193 },
+  { 0x0100280c, 20449 },
+  { 0x01001e40,  6150 },
+  { 0x0000ff13,    47 },
+  { 0x00000ce1, 13324 },
+  { 0x000005e8,  7723 },
+  { 0x1008ff42, 26376 },
+  { 0x00000eec, 16234 },
+  { 0x010028be, 23612 },
+  { 0x01000db3, 25244 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000ffcb,   863 },
+  { 0x0100288a, 22666 },
+  { 0x000000d8,  4740 },
+  { 0x1008ff8c, 27189 },
+  { 0x0000ffdd,   992 },
+  { 0x01002829, 20937 },
+  { 0x000005e3,  7656 },
+  { 0x00000eae, 15342 },
+  { 0x00000cef, 13562 },
+  { 0x01000d93, 24996 },
+  { 0x000006f5,  9962 },
+  { 0x0000007b,  4177 },
+  { 0x01000670,  7032 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000ffd6,   941 },
+  { 0x000000ca,  4605 },
+  { 0x1008ff21, 25936 },
+  { 0x010020a5, 19646 },
+  { 0x00000040,  3996 },
+  { 0x1008ff86, 27122 },
+  { 0x1008126c, 29272 },
+  { 0x000007c4, 10596 },
+  { 0x01001eab, 18544 },
+  { 0x0000ffd3,   924 },
+  { 0x000005da,  7606 },
+  { 0x00000cf6, 13688 },
+  { 0x000006bc,  9216 },
+  { 0x0100221b, 20029 },
+  { 0x1008ff44, 26400 },
+  { 0x10081265, 29167 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0100055d, 16625 },
+  { 0x000006b0,  8994 },
+  { 0x000000c3,  4555 },
+  { 0x01002832, 21094 },
+  { 0x01002871, 22214 },
+  { 0x01002812, 20548 },
+  { 0x01002884, 22565 },
+  { 0x0100055c, 16688 },
+  { 0x00000de8, 14670 },
+  { 0x00000050,  4029 },
+  { 0x00000071,  4157 },
+  { 0x000000cf,  4654 },
+  { 0x00000eaa, 15270 },
+  { 0x0000fe0b,  1362 },
+  { 0x000008c0, 11599 },
+  { 0x01002878, 22345 },
+  { 0x100812a8, 29781 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000004d6,  6834 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000000c0,  4529 },
+  { 0x00000ad0, 12478 },
+  { 0x0000ffea,  1101 },
+  { 0x00000ee0, 16030 },
+  { 0x01000536, 16900 },
+  { 0x01000698,  7935 },
+  { 0x01000531, 16770 },
+  { 0x000006aa,  8883 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01001e37, 18385 },
+  { 0x0000ffe2,  1032 },
+  { 0x100811a0, 28109 },
+  { 0x0000ff57,   411 },
+  { 0x000006b7,  9105 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000007b8, 10473 },
+  { 0x01000668,  7217 },
+  { 0x01002800, 20261 },
+  { 0x00000ced, 13535 },
+  { 0x000005c8,  7394 },
+  { 0x1008ff9c, 27403 },
+  { 0x000000d6,  4713 },
+  { 0x10081209, 28547 },
+  { 0x0000ff3e,   349 },
+  { 0x00000eb8, 15500 },
+  { 0x000000bc,  4483 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x010028d8, 24089 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000ffb4,   781 },
+  { 0x000008df, 11744 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000006b8,  9142 },
+  { 0x10081274, 29381 },
+  { 0x01000301, 19545 },
+  { 0x01001e85,  6269 },
+  { 0x000006b5,  9068 },
+  { 0x0100285a, 21796 },
+  { 0x0100289e, 23022 },
+  { 0x01000da6, 25132 },
+  { 0x0000ff39, 14976 },
+  { 0x0000fe74,  2771 },
+  { 0x010010ee, 18146 },
+  { 0x000008dc, 11714 },
+  { 0x10081275, 29392 },
+  { 0x01001ea3, 18421 },
+  { 0x0000fe56,  1974 },
+  { 0x00000ab1, 12182 },
+  { 0x00000077,  4169 },
+  { 0x0000fef7,  3273 },
+  { 0x00000ec5, 15657 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000006aa,  8870 },
+  { 0x000000ef,  4937 },
+  { 0x00000ec0, 15607 },
+  { 0x01000ddf, 25520 },
+  { 0x000006fe, 10081 },
+  { 0x000000bb,  4468 },
+  { 0x01002898, 22913 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000ffcc,   870 },
+  { 0x01002851, 21637 },
+  { 0x01001ee2, 19269 },
+  { 0x1008ff54, 26601 },
+  { 0x0100286e, 22158 },
+  { 0x000001f1,  5466 },
+  { 0x000007e2, 10853 },
+  { 0x100812a0, 29685 },
+  { 0x100812b9, 29982 },
+  { 0x0000ffd8,   955 },
+  { 0x00000ce2, 13336 },
+  { 0x00000da6, 13860 },
+  { 0x000006cb,  9438 },
+  { 0x010028a2, 23094 },
+  { 0x000001b5,  5195 },
+  { 0x000007e8, 10923 },
+  { 0x01002807, 20368 },
+  { 0x10081211, 28661 },
+  { 0x010020a7, 19665 },
+  { 0x000006d6,  9568 },
+  { 0x000000e6,  4862 },
+  { 0x10081217, 28710 },
+  { 0x1008fe03, 27740 },
+  { 0x010028e6, 24354 },
+  { 0x01001e61,  6200 },
+  { 0x000004ca,  6730 },
+  { 0x01002813, 20564 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01000556, 17710 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000df9, 14863 },
+  { 0x000008c2, 11619 },
+  { 0x00000ee7, 16154 },
+  { 0x1008ff3c, 26294 },
+  { 0x01002822, 20820 },
+  { 0x010010e6, 18038 },
+  { 0x000006c4,  9350 },
+  { 0x000001ea,  5436 },
+  { 0x00000063,  4129 },
+  { 0x00000aed, 12902 },
+  { 0x01002874, 22269 },
+  { 0x000000d7,  4724 },
+  { 0x01000d8f, 24964 },
+  { 0x01001e1f,  6140 },
+  { 0x000001bd,  5245 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000004c,  4021 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000006ee,  9879 },
+  { 0x00000afc, 13068 },
+  { 0x010028da, 24126 },
+  { 0x1008ff79, 26974 },
+  { 0x00000ded, 14739 },
+  { 0x010028b9, 23515 },
+  { 0x000009ee, 11926 },
+  { 0x000000a0,  4213 },
+  { 0x01000ddd, 25502 },
+  { 0x0100282d, 21006 },
+  { 0x000007c3, 10584 },
+  { 0x00000dc6, 14265 },
+  { 0x1008126e, 29300 },
+  { 0x1008120e, 28619 },
+  { 0x000000a3,  4242 },
+  { 0x00000eda, 15919 },
+  { 0x000008af, 11364 },
+  { 0x0000fe0a,  1347 },
+  { 0x000001f0,  5458 },
+  { 0x01000d87, 24900 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000fe6c,  2331 },
+  { 0x0100287a, 22382 },
+  { 0x01000d9e, 25061 },
+  { 0x01000dae, 25207 },
+  { 0x01002885, 22581 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01002827, 20903 },
+  { 0x00000acb, 12396 },
+  { 0x010004d8,  8565 },
+  { 0x000000c1,  4536 },
+  { 0x00000eca, 15708 },
+  { 0x000006b3,  9031 },
+  { 0x1008ff17, 25813 },
+  { 0x1008ff3f, 26336 },
+  { 0x0000fed5,  2681 },
+  { 0x000001d1,  5339 },
+  { 0x01001ef7, 19469 },
+  { 0x1008ff78, 26961 },
+  { 0x01000550, 17558 },
+  { 0x00000eab, 15289 },
+  { 0x1008ff7c, 27014 },
+  { 0x01000565, 16886 },
+  { 0x000004d7,  6842 },
+  { 0x0000ffc4,   829 },
+  { 0x000004d1,  6794 },
+  { 0x1008fe06, 27788 },
+  { 0x0000fd0d,  3558 },
+  { 0x00000eb2, 15410 },
+  { 0x10081290, 29502 },
+  { 0x00000ea5, 15188 },
+  { 0x0000ff3a, 14989 },
+  { 0x00000cf0, 13578 },
+  { 0x00000aa2, 12054 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01000537, 16924 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x010004a3,  8289 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01001ec6, 18905 },
+  { 0x00000044,  4005 },
+  { 0x01001ecb, 18967 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000003b6,  5835 },
+  { 0x000008a4, 11198 },
+  { 0x00000ade, 12676 },
+  { 0x0100289c, 22985 },
+  { 0x0000ff37,   327 },
+  { 0x010010dd, 17920 },
+  { 0x00000dea, 14693 },
+  { 0x01002248, 20077 },
+  { 0x100811e5, 28413 },
+  { 0x01001e36, 18375 },
+  { 0x000000be,  4502 },
+  { 0x0000fe91,  2413 },
+  { 0x00000ec4, 15648 },
+  { 0x1008ffb5, 27643 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x1008ff4e, 26520 },
+  { 0x00000de2, 14574 },
+  { 0x1008fe25, 27976 },
+  { 0x1008ff6a, 26822 },
+  { 0x00000cf5, 13671 },
+  { 0x0000fe6a,  2299 },
+  { 0x00000ee4, 16106 },
+  { 0x000001c5,  5288 },
+  { 0x1008ff37, 26220 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000056,  4041 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0100284a, 21514 },
+  { 0x1008119b, 28099 },
+  { 0x0000ffd6,   945 },
+  { 0x000007c8, 10643 },
+  { 0x00000065,  4133 },
+  { 0x10081205, 28495 },
+  { 0x00000de5, 14624 },
+  { 0x0000ff7e, 13781 },
+  { 0x1008ff2e, 26105 },
+  { 0x0000ff67,   459 },
+  { 0x10081261, 29063 },
+  { 0x0100286d, 22139 },
+  { 0x01001ed7, 19126 },
+  { 0x000000cd,  4635 },
+  { 0x000006bf,  9290 },
+  { 0x0100067e,  7068 },
+  { 0x01000275, 18347 },
+  { 0x100812b4, 29932 },
+  { 0x0000fed1,  2621 },
+  { 0x0000fe59,  2018 },
+  { 0x000008b7, 11529 },
+  { 0x000001b2,  5180 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01002809, 20400 },
+  { 0x0100055b, 16704 },
+  { 0x00000edd, 15971 },
+  { 0x000000a7,  4274 },
+  { 0x010028e2, 24280 },
+  { 0x00000ba8, 13140 },
+  { 0x010004a2,  8267 },
+  { 0x00000dd2, 14410 },
+  { 0x000006ba,  9191 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0100055e, 16736 },
+  { 0x00000df8, 14850 },
+  { 0x0000fe81,  2490 },
+  { 0x1008ff51, 26564 },
+  { 0x000006a3,  8723 },
+  { 0x0000ffdb,   976 },
+  { 0x000003f9,  6019 },
+  { 0x1008ff01, 25565 },
+  { 0x000008a5, 11210 },
+  { 0x00000ed4, 15807 },
+  { 0x0000ff30,   315 },
+  { 0x00000025,  3832 },
+  { 0x000006f0,  9902 },
+  { 0x1008ff67, 26793 },
+  { 0x000007f8, 11121 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x1008fe07, 27804 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x010020a4, 19637 },
+  { 0x010020a0, 19595 },
+  { 0x000009e3, 11855 },
+  { 0x10081192, 28069 },
+  { 0x010006f8,  7001 },
+  { 0x0000ff2a,   252 },
+  { 0x0100283a, 21236 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x10081277, 29424 },
+  { 0x1008ff60, 26726 },
+  { 0x000000b6,  4413 },
+  { 0x00000ae3, 12755 },
+  { 0x010028fc, 24785 },
+  { 0x01000539, 16970 },
+  { 0x000001ab,  5141 },
+  { 0x1008ff65, 26771 },
+  { 0x010004b6,  8443 },
+  { 0x00000031,  3934 },
+  { 0x000002d8,  5666 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000fff8, 20218 },
+  { 0x0000006f,  4153 },
+  { 0x00000cfa, 13759 },
+  { 0x000000a9,  4292 },
+  { 0x000007c2, 10573 },
+  { 0x100812a7, 29769 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x010028f0, 24549 },
+  { 0x01000dd2, 25425 },
+  { 0x01000568, 16958 },
+  { 0x01000dc1, 25337 },
+  { 0x0000ffcf,   895 },
+  { 0x000006eb,  9843 },
+  { 0x01001e0a,  6110 },
+  { 0x01000303, 19513 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000004dd,  6890 },
+  { 0x000005d9,  7595 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01002833, 21111 },
+  { 0x01001ea4, 18427 },
+  { 0x01002858, 21761 },
+  { 0x1008ffb4, 27634 },
+  { 0x0000006c,  4147 },
+  { 0x01002806, 20352 },
+  { 0x000006ae,  8948 },
+  { 0x000005c6,  7364 },
+  { 0x010028a9, 23218 },
+  { 0x000007e6, 10902 },
+  { 0x0000fe20,  1454 },
+  { 0x000004c9,  6722 },
+  { 0x01000d86, 24892 },
+  { 0x0000feed,  3099 },
+  { 0x010028bd, 23592 },
+  { 0x1008ff5b, 26673 },
+  { 0x01000679,  7056 },
+  { 0x0000fe67,  2246 },
+  { 0x000005c7,  7382 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000ada, 12609 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000002d,  3913 },
+  { 0x000005d5,  7551 },
+  { 0x1008ff62, 26748 },
+  { 0x01001e84,  6258 },
+  { 0x0100284c, 21549 },
+  { 0x000006ab,  8895 },
+  { 0x01000493,  8114 },
+  { 0x01001ee9, 19340 },
+  { 0x000004dc,  6882 },
+  { 0x100812ac, 29829 },
+  { 0x000006fa, 10030 },
+  { 0x01000540, 17152 },
+  { 0x0000fd07,  3494 },
+  { 0x00000aac, 12136 },
+  { 0x000004a9,  6439 },
+  { 0x1008ff28, 26034 },
+  { 0x000006a2,  8709 },
+  { 0x000005eb,  7764 },
+  { 0x01002262, 20098 },
+  { 0x01000176,  6066 },
+  { 0x000009df, 11820 },
+  { 0x0100221c, 20038 },
+  { 0x0000ff23,   174 },
+  { 0x0000ffca,   860 },
+  { 0x0000ffac,   715 },
+  { 0x0000fe68,  2261 },
+  { 0x0000006b,  4145 },
+  { 0x000006e1,  9719 },
+  { 0x1008ff72, 26883 },
+  { 0x00000ad9, 12598 },
+  { 0x0000005e,  4086 },
+  { 0x0000fed0,  2600 },
+  { 0x100811a8, 28149 },
+  { 0x10081177, 28035 },
+  { 0x000004cc,  6754 },
+  { 0x0000ffb8,   801 },
+  { 0x01000d85, 24885 },
+  { 0x010004b3,  8421 },
+  { 0x01000dab, 25179 },
+  { 0x01000300, 19529 },
+  { 0x0000fe6d,  2351 },
+  { 0x000006a4,  8748 },
+  { 0x01001ee7, 19323 },
+  { 0x00000026,  3840 },
+  { 0x0000fe90,  2400 },
+  { 0x01001e81,  6237 },
+  { 0x01001ea6, 18461 },
+  { 0x0000ff80,   522 },
+  { 0x0000fd0b,  3540 },
+  { 0x0000ff92,   553 },
+  { 0x010006c1,  8067 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x010028f7, 24684 },
+  { 0x000008bf, 11590 },
+  { 0x0000ffeb,  1107 },
+  { 0x000000e0,  4812 },
+  { 0x0000fe5e,  2081 },
+  { 0x000008b0, 11385 },
+  { 0x1008ff24, 25982 },
+  { 0x01001ee5, 19307 },
+  { 0x00000df5, 14814 },
+  { 0x00000dbb, 14138 },
+  { 0x010028bc, 23573 },
+  { 0x00000047,  4011 },
+  { 0x00000029,  3882 },
+  { 0x00000efa, 16510 },
+  { 0x01002865, 21994 },
+  { 0x000000bf,  4516 },
+  { 0x100811b0, 28246 },
+  { 0x01002070, 19726 },
+  { 0x000006b9,  9166 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01002205, 19975 },
+  { 0x000000b3,  4390 },
+  { 0x000008b3, 11441 },
+  { 0x0000fd09,  3521 },
+  { 0x00000045,  4007 },
+  { 0x01000174,  6042 },
+  { 0x0000ffd2,   917 },
+  { 0x000004af,  6493 },
+  { 0x01001e02,  6090 },
+  { 0x0100287f, 22480 },
+  { 0x000007ae, 10302 },
+  { 0x00000afe, 13093 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000eac, 15307 },
+  { 0x000003b3,  5819 },
+  { 0x00000aaf, 12157 },
+  { 0x000006b4,  9043 },
+  { 0x01001edf, 19237 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x10081292, 29524 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01001ebc, 18757 },
+  { 0x0000ffd9,   962 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0100054a, 17408 },
+  { 0x00000ece, 15748 },
+  { 0x00000ee6, 16140 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000af4, 12959 },
+  { 0x00000039,  3950 },
+  { 0x01001e1e,  6130 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000ff36, 14931 },
+  { 0x01000496,  8131 },
+  { 0x000004a6,  6417 },
+  { 0x000004c6,  6698 },
+  { 0x010010da, 17881 },
+  { 0x000005d3,  7526 },
+  { 0x1008fe02, 27724 },
+  { 0x0000005f,  4098 },
+  { 0x0100281e, 20752 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01001eef, 19404 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000000d1,  4673 },
+  { 0x10081295, 29557 },
+  { 0x010028c6, 23756 },
+  { 0x000000cb,  4617 },
+  { 0x01001ecc, 18977 },
+  { 0x00000bca, 13201 },
+  { 0x0000fe29,  1633 },
+  { 0x0000fd04,  3456 },
+  { 0x10081185, 28051 },
+  { 0x010001b0, 19507 },
+  { 0x000008ad, 11334 },
+  { 0x01000db0, 25226 },
+  { 0x00000dda, 14505 },
+  { 0x01001ea8, 18495 },
+  { 0x1008ff49, 26460 },
+  { 0x000006b1,  9005 },
+  { 0x0000fe8a,  2553 },
+  { 0x000001f8,  5493 },
+  { 0x00000ce2, 13349 },
+  { 0x0000ff97,   587 },
+  { 0x01000dad, 25198 },
+  { 0x010020a9, 19686 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0100058a, 16638 },
+  { 0x0000ff91,   547 },
+  { 0x1008ff94, 27286 },
+  { 0x100811d0, 28395 },
+  { 0x01000586, 17722 },
+  { 0x10081262, 29086 },
+  { 0x01001ed3, 19060 },
+  { 0x010028c3, 23703 },
+  { 0x10081207, 28521 },
+  { 0x00000ac6, 12359 },
+  { 0x00000adf, 12691 },
+  { 0x00000ae7, 12817 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x010010e2, 17985 },
+  { 0x0100281d, 20734 },
+  { 0x000007b3, 10376 },
+  { 0x000005c1,  7273 },
+  { 0x01001eee, 19393 },
+  { 0x1008ffa8, 27540 },
+  { 0x1008ffa3, 27490 },
+  { 0x000006b6,  9082 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000ff50,   358 },
+  { 0x00000df6, 14825 },
+  { 0x0000fe5c,  2059 },
+  { 0x01002896, 22876 },
+  { 0x10081241, 28870 },
+  { 0x0000feea,  3051 },
+  { 0x000000e9,  4881 },
+  { 0x0000ff7e, 15110 },
+  { 0x00000eed, 16249 },
+  { 0x00000ed1, 15778 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01000d8e, 24955 },
+  { 0x1008ff4d, 26508 },
+  { 0x010028af, 23329 },
+  { 0x0000ffcd,   877 },
+  { 0x000004bb,  6591 },
+  { 0x000007f0, 11024 },
+  { 0x000003a5,  5779 },
+  { 0x010010d0, 17754 },
+  { 0x0000ffff,    80 },
+  { 0x01001eac, 18561 },
+  { 0x00000bce, 13210 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000da7, 13876 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x1008ff1d, 25886 },
+  { 0x000001e3,  5408 },
+  { 0x00000ebc, 15558 },
+  { 0x1008ff99, 27350 },
+  { 0x01001eaf, 18613 },
+  { 0x000004ae,  6476 },
+  { 0x0000003c,  3968 },
+  { 0x01000553, 17636 },
+  { 0x1008ff69, 26813 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0100285c, 21833 },
+  { 0x000002dd,  5678 },
+  { 0x0000fe64,  2167 },
+  { 0x000003f1,  5993 },
+  { 0x000007c7, 10633 },
+  { 0x010028ae, 23310 },
+  { 0x01000df2, 25529 },
+  { 0x010010e0, 17959 },
+  { 0x100811ad, 28212 },
+  { 0x0000ff53,   371 },
+  { 0x0100280e, 20482 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01000ddc, 25494 },
+  { 0x0100012c, 18271 },
+  { 0x00000edf, 16011 },
+  { 0x000006f9, 10016 },
+  { 0x01002084, 19873 },
+  { 0x1008ff23, 25969 },
+  { 0x0000fe58,  2003 },
+  { 0x0000fffa, 20246 },
+  { 0x0100055e, 16754 },
+  { 0x000008b6, 11511 },
+  { 0x000003cf,  5902 },
+  { 0x1008ffb6, 27654 },
+  { 0x000006c3,  9337 },
+  { 0x00000cf8, 13735 },
+  { 0x010010d2, 17779 },
+  { 0x000006ad,  8922 },
+  { 0x00000ba9, 13150 },
+  { 0x010010e1, 17972 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000ff2b,   268 },
+  { 0x000007c1, 10561 },
+  { 0x1008121d, 28802 },
+  { 0x000004c2,  6657 },
+  { 0x010006f5,  6977 },
+  { 0x1008ff52, 26585 },
+  { 0x010028f9, 24724 },
+  { 0x01000667,  7208 },
+  { 0x010028f6, 24664 },
+  { 0x01002825, 20869 },
+  { 0x0000ff34, 14906 },
+  { 0x010001b7, 18367 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000ffb9,   806 },
+  { 0x00000aa7, 12102 },
+  { 0x000004b1,  6516 },
+  { 0x0100288c, 22701 },
+  { 0x000009f0, 11955 },
+  { 0x0100055b, 16720 },
+  { 0x0000fef4,  3227 },
+  { 0x000007f9, 11131 },
+  { 0x010010e9, 18079 },
+  { 0x0100287b, 22401 },
+  { 0x000009e1, 11839 },
+  { 0x1008ff98, 27334 },
+  { 0x000008d6, 11686 },
+  { 0x010028df, 24224 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000006d4,  9545 },
+  { 0x00000055,  4039 },
+  { 0x0100057b, 17444 },
+  { 0x0000fe76,  2807 },
+  { 0x100812a9, 29793 },
+  { 0x000002b1,  5586 },
+  { 0x1008121e, 28822 },
+  { 0x0000fe24,  1523 },
+  { 0x01002868, 22049 },
+  { 0x00000bc4, 13182 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x10081200, 28430 },
+  { 0x000008ac, 11320 },
+  { 0x00000db3, 14038 },
+  { 0x1008ff11, 25715 },
+  { 0x010004b9,  8513 },
+  { 0x0000fd05,  3467 },
+  { 0x010020aa, 19694 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000004b,  4019 },
+  { 0x00000db2, 14022 },
+  { 0x0000ff7e, 11143 },
+  { 0x000009e2, 11852 },
+  { 0x1008fe22, 27928 },
+  { 0x01002263, 20111 },
+  { 0x0000fee5,  2964 },
+  { 0x000009f3, 12000 },
+  { 0x10081266, 29192 },
+  { 0x01002879, 22363 },
+  { 0x000007a5, 10183 },
+  { 0x010028cc, 23865 },
+  { 0x000008db, 11705 },
+  { 0x01000563, 16835 },
+  { 0x000007a5, 10202 },
+  { 0x0000fe09,  1327 },
+  { 0x000000ba,  4458 },
+  { 0x000007f1, 11033 },
+  { 0x000009e5, 11861 },
+  { 0x00000079,  4173 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000aff, 13112 },
+  { 0x0100053c, 17046 },
+  { 0x0000fe2f,  1769 },
+  { 0x000005c5,  7342 },
+  { 0x0000fd19,  3698 },
+  { 0x000002e5,  5697 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01002843, 21396 },
+  { 0x01001e6a,  6210 },
+  { 0x10081240, 28853 },
+  { 0x000004d2,  6802 },
+  { 0x010028b0, 23349 },
+  { 0x01000dd9, 25468 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x1008ff4b, 26484 },
+  { 0x0000ffab,   708 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01000545, 17284 },
+  { 0x000001f9,  5500 },
+  { 0x000005ec,  7780 },
+  { 0x0000fd01,  3414 },
+  { 0x000003a6,  5786 },
+  { 0x010028ab, 23254 },
+  { 0x010028a3, 23111 },
+  { 0x0000fe5d,  2071 },
+  { 0x01002837, 21182 },
+  { 0x1008ff1c, 25870 },
+  { 0x000004db,  6874 },
+  { 0x01000d89, 24917 },
+  { 0x010010d4, 17805 },
+  { 0x010004b2,  8399 },
+  { 0x000001ec,  5444 },
+  { 0x000004d8,  6850 },
+  { 0x0100055c, 16672 },
+  { 0x000001db,  5379 },
+  { 0x0100281f, 20770 },
+  { 0x0100049d,  8244 },
+  { 0x100812b5, 29949 },
+  { 0x0000fe7a,  2879 },
+  { 0x000000b2,  4378 },
+  { 0x010010e5, 18024 },
+  { 0x01000df4, 25549 },
+  { 0x000000b5,  4410 },
+  { 0x0000fe54,  1951 },
+  { 0x000004ad,  6468 },
+  { 0x000004da,  6866 },
+  { 0x0000fed2,  2641 },
+  { 0x000005ea,  7753 },
+  { 0x100812ba, 29998 },
+  { 0x1008ff14, 25771 },
+  { 0x000000e4,  4845 },
+  { 0x0000fe13,  1249 },
+  { 0x01000d90, 24972 },
+  { 0x0000ff7e,  8083 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x010028ea, 24430 },
+  { 0x00000adc, 12635 },
+  { 0x0000feee,  3115 },
+  { 0x0000ffec,  1115 },
+  { 0x000000d3,  4687 },
+  { 0x00000dbd, 14163 },
+  { 0x0000ff29,   244 },
+  { 0x0000ff56,   396 },
+  { 0x0000ff25,   200 },
+  { 0x01002888, 22633 },
+  { 0x000006a1,  8697 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000fe33,  1857 },
+  { 0x010028db, 24145 },
+  { 0x100812bc, 30030 },
+  { 0x00000ae0, 12704 },
+  { 0x0000fee1,  2911 },
+  { 0x000000f1,  4952 },
+  { 0x000004b5,  6544 },
+  { 0x010010f1, 18186 },
+  { 0x010006f0,  6937 },
+  { 0x01002838, 21201 },
+  { 0x000003b5,  5828 },
+  { 0x01000323, 19576 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01000532, 16796 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01002076, 19765 },
+  { 0x000006e2,  9730 },
+  { 0x01002826, 20886 },
+  { 0x100811be, 28379 },
+  { 0x00000da4, 13833 },
+  { 0x0000ffc3,   826 },
+  { 0x00000ceb, 13510 },
+  { 0x00000add, 12655 },
+  { 0x010006cc,  8023 },
+  { 0x010028d1, 23958 },
+  { 0x000001d0,  5331 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000fd1d,  3764 },
+  { 0x0000fe53,  1923 },
+  { 0x000005cb,  7434 },
+  { 0x000003a2,  5764 },
+  { 0x00000cf2, 13617 },
+  { 0x0000ff2d,   283 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0100286a, 22084 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01000d9f, 25070 },
+  { 0x000004c2,  6666 },
+  { 0x000007ab, 10284 },
+  { 0x01001ecd, 18987 },
+  { 0x01002209, 19994 },
+  { 0x000000f7,  5003 },
+  { 0x01001ec2, 18839 },
+  { 0x000013bc,  6294 },
+  { 0x00000ce8, 13459 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01000492,  8097 },
+  { 0x010028e3, 24298 },
+  { 0x0000fe02,  1148 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000ff14,    53 },
+  { 0x01000d9b, 25035 },
+  { 0x00000de1, 14562 },
+  { 0x01002867, 22030 },
+  { 0x01002814, 20581 },
+  { 0x1008ff7e, 27040 },
+  { 0x1008fe09, 27836 },
+  { 0x000004ac,  6460 },
+  { 0x000006d1,  9509 },
+  { 0x0100053f, 17126 },
+  { 0x01002075, 19752 },
+  { 0x0000005b,  4051 },
+  { 0x000006bb,  9203 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01001ef3,  6287 },
+  { 0x000006a6,  8786 },
+  { 0x01002864, 21977 },
+  { 0x000004c1,  6649 },
+  { 0x10081294, 29546 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000ffd3,   920 },
+  { 0x0000fed4,  2661 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x0000ffdc,   988 },
+  { 0x000007cd, 10712 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01000d91, 24981 },
+  { 0x1008ff56, 26626 },
+  { 0x000002fd,  5741 },
+  { 0x000000e8,  4874 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000004c0,  6632 },
+  { 0x0000ffda,   969 },
+  { 0x1008ff15, 25785 },
+  { 0x0000ff23,   186 },
+  { 0x0000ff6a,   476 },
+  { 0x000004d0,  6786 },
+  { 0x0000ff69,   469 },
+  { 0x010028d0, 23941 },
+  { 0x01001ece, 18997 },
+  { 0x01002866, 22012 },
+  { 0x00000076,  4167 },
+  { 0x01001ed9, 19163 },
+  { 0x000000ed,  4918 },
+  { 0x01000dd1, 25415 },
+  { 0x00000075,  4165 },
+  { 0x000000c6,  4579 },
+  { 0x01000555, 17688 },
+  { 0x0000fe2e,  1750 },
+  { 0x000007ca, 10666 },
+  { 0x00000ed6, 15844 },
+  { 0x000000cc,  4628 },
+  { 0x00000ae2, 12740 },
+  { 0x0000ff94,   565 },
+  { 0x00000072,  4159 },
+  { 0x00000dcc, 14331 },
+  { 0x1008ff3a, 26260 },
+  { 0x01000ddb, 25485 },
+  { 0x000004ab,  6453 },
+  { 0x0000fff7, 20204 },
+  { 0x01000660,  7145 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000008bd, 11564 },
+  { 0x010028d5, 24031 },
+  { 0x01001ed4, 19077 },
+  { 0x000007f7, 11111 },
+  { 0x0000fef1,  3173 },
+  { 0x000004bd,  6608 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000000e7,  4865 },
+  { 0x00000af9, 13020 },
+  { 0x010004e3,  8613 },
+  { 0x010010db, 17894 },
+  { 0x000008aa, 11288 },
+  { 0x0100289f, 23041 },
+  { 0x10081204, 28482 },
+  { 0x01001edd, 19216 },
+  { 0x1008ff8f, 27224 },
+  { 0x000008b4, 11467 },
+  { 0x00000ad2, 12519 },
+  { 0x100811b9, 28310 },
+  { 0x00000ad4, 12560 },
+  { 0x01000d8c, 24939 },
+  { 0x000000ee,  4925 },
+  { 0x01002839, 21218 },
+  { 0x00000028,  3872 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x1008ff9a, 27370 },
+  { 0x100811aa, 28185 },
+  { 0x0000fe93,  2459 },
+  { 0x000000f3,  4966 },
+  { 0x010028bf, 23632 },
+  { 0x000008ef, 11754 },
+  { 0x10081201, 28443 },
+  { 0x010004e2,  8595 },
+  { 0x000007ee, 11001 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x010010f0, 18173 },
+  { 0x0000ffe0,  1020 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x1008ff40, 26352 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000ae8, 12834 },
+  { 0x0000003e,  3979 },
+  { 0x000004d5,  6826 },
+  { 0x000001ba,  5222 },
+  { 0x00000ee1, 16050 },
+  { 0x0000fe2c,  1707 },
+  { 0x01002235, 20069 },
+  { 0x000000f8,  5012 },
+  { 0x01001ebd, 18764 },
+  { 0x010006f4,  6969 },
+  { 0x01000567, 16935 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01002870, 22197 },
+  { 0x000002c5,  5634 },
+  { 0x000005d2,  7514 },
+  { 0x000005ce,  7469 },
+  { 0x01002831, 21077 },
+  { 0x010028d3, 23994 },
+  { 0x0000fe0f,  1434 },
+  { 0x000000f5,  4985 },
+  { 0x1008ff4f, 26532 },
+  { 0x00000bd6, 13232 },
+  { 0x000004c3,  6674 },
+  { 0x01002872, 22232 },
+  { 0x01001e60,  6190 },
+  { 0x1008ffb0, 27573 },
+  { 0x010028dc, 24165 },
+  { 0x000002a9,  5557 },
+  { 0x000007af, 10323 },
+  { 0x01000db1, 25236 },
+  { 0x010006f2,  6953 },
+  { 0x000000fa,  5035 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000000ea,  4888 },
+  { 0x000004b2,  6523 },
+  { 0x00000dcf, 14368 },
+  { 0x00000aa1, 12046 },
+  { 0x0000ffb1,   766 },
+  { 0x00000ae5, 12789 },
+  { 0x0000ff9e,   667 },
+  { 0x00000edc, 15950 },
+  { 0x000008fb, 11781 },
+  { 0x01001eeb, 19362 },
+  { 0x01002893, 22823 },
+  { 0x000006bd,  9230 },
+  { 0x000006c6,  9374 },
+  { 0x00000eef, 16280 },
+  { 0x0000ffc2,   823 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000cfa, 13770 },
+  { 0x010028e9, 24411 },
+  { 0x01001eb0, 18625 },
+  { 0x01001ec0, 18805 },
+  { 0x1008ff87, 27134 },
+  { 0x0100053a, 16994 },
+  { 0x1008ff2c, 26079 },
+  { 0x000000dc,  4775 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01000538, 16946 },
+  { 0x01002816, 20614 },
+  { 0x000000ff,  5078 },
+  { 0x01001ef9, 19482 },
+  { 0x0000fe72,  2737 },
+  { 0x0000ff35, 14919 },
+  { 0x01000546, 17308 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x000005cf,  7481 },
+  { 0x1008ff3e, 26320 },
+  { 0x00000038,  3948 },
+  { 0x0000ff9a,   619 },
+  { 0x0000fef9,  3315 },
+  { 0x1008ff9e, 27432 },
+  { 0x1008fe21, 27914 },
+  { 0x010028a1, 23077 },
+  { 0x00000acd, 12431 },
+  { 0x000006c2,  9325 },
+  { 0x1008ff61, 26737 },
+  { 0x100812a6, 29757 },
+  { 0x01000da4, 25113 },
+  { 0x00000ed8, 15879 },
+  { 0x01001e41,  6160 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x01000653,  7878 },
+  { 0x01000533, 16822 },
+  { 0x01001e0b,  6120 },
+  { 0x10081244, 28915 },
+  { 0x01002835, 21146 },
+  { 0x0000fee8,  3015 },
+  { 0x0000ff2c,   276 },
+  { 0x000000b7,  4423 },
+  { 0x0100055d, 16600 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x00000ad6, 12582 },
+  { 0x01002875, 22287 },
+  { 0x00000ead, 15325 },
+  { 0x01001ed6, 19109 },
+  { 0x0000ffc6,   835 },
+  { 0x01001ea2, 18415 },
+  { 0x01001eec, 19373 },
+  { 0x01002817, 20631 },
+  { 0, CIM_KEYSYM_NO_NAME },
+  { 0x1008ff5c, 26687 },
+  { 0x01002895, 22858 },
+  { 0x10081276, 29408 },
+  { 0x00000dca, 14309 },
+  { 0x00000dd8, 14482 },
+  { 0x0100058a, 16654 },
+  { 0x0000fefc,  3373 },
+  { 0x00000046,  4009 },
+  { 0x000008bc, 11550 },
+  { 0x010028c5, 23738 },
+  { 0x000007d4, 10775 },
+};
+
+#define CIM_KEYSYM_TO_UNICODE_N_BUCKETS 186
+#define CIM_KEYSYM_TO_UNICODE_N_SLOTS   835
+
+static const uint16_t cim_keysym_to_unicode_disps[186] = {
+      2,    2,    1,   41,    1,    1,    9,   33,    2,    2,   26,    7,
+      4,    8,   21,    6,  128,   30,    6,   77,    4,    2,    1,    5,
+     14,    4,   17,    4,   17,    1,    1,   19,    2,    7,  105,    3,
+      3,    2,   13,   32,    6,    1,   75,  143,    1,    2,    1,    3,
+      1,    0,  112,    1,   76,    3,   11,   46,   28,   61,    3,   71,
+      1,   13,    2,    8,    8,    3,   84,   10,   28,    1,   69,   13,
+     42,    5,   38,  191,    0,   85,    4,    4,   24,    3,    1,   40,
+      7,    3,   85,  141,   12,   13,    7,    8,    3,  124,    2,    3,
+      1,    3,    5,    3,    1,    5,    3,   64,   23,   77,   15,    5,
+      1,    0,   56,   14,   12,    1,   72,   11,   28,   28,   18,    5,
+     27,    0,   54,    9,   38,  161,   33,   85,   24,    5,    7,    2,
+     31,   29,   14,    4,   11,   46,   31,    4,   13,  139,    0,   66,
+    359,   16,  101,   24,    2,   37,   12,   44,   25,   46,    7,    2,
+     47,    6,   94,   34,   21,    3,  160,    5,   25,  264,  189,    5,
+     33,   20,    5,    8,    3,    1,  191,   20,   82,   65,   14,   70,
+      3,    9,   69,    5,  266,  198,
+};
+
+static const CimKeysymUnicode cim_keysym_to_unicode_slots[835] = {
+  { 0x00000df4, 0x000e54 },
+  { 0x00000cef, 0x0005df },
+  { 0, 0 },
+  { 0x00000ab1, 0x002154 },
+  { 0x000004d1, 0x0030e0 },
+  { 0x00000dc3, 0x000e23 },
+  { 0x000001bd, 0x0002dd },
+  { 0x00000eee, 0x0011c2 },
+  { 0x000009ee, 0x00253c },
+  { 0x000003f9, 0x000173 },
+  { 0x000006d2, 0x000440 },
+  { 0x000007f9, 0x0003c9 },
+  { 0x00000eb6, 0x003146 },
+  { 0x00000da6, 0x000e06 },
+  { 0x000001c8, 0x00010c },
+  { 0x000004a3, 0x00300d },
+  { 0x00000ede, 0x0011b2 },
+  { 0x00000db8, 0x000e18 },
+  { 0x000013bc, 0x000152 },
+  { 0x00000eb4, 0x003144 },
+  { 0, 0 },
+  { 0x00000da5, 0x000e05 },
+  { 0x000005d2, 0x000632 },
+  { 0x00000dc6, 0x000e26 },
+  { 0x000003e0, 0x000101 },
+  { 0x000007e5, 0x0003b5 },
+  { 0x00000ce9, 0x0005d9 },
+  { 0x000004bd, 0x0030b9 },
+  { 0x00000af0, 0x002720 },
+  { 0x00000aed, 0x002666 },
+  { 0x00000ec9, 0x003159 },
+  { 0x000006a1, 0x000452 },
+  { 0x000001a6, 0x00015a },
+  { 0x00000eac, 0x00313c },
+  { 0, 0 },
+  { 0, 0 },
+  { 0x000006ce, 0x00043d },
+  { 0x00000dbe, 0x000e1e },
+  { 0x000008ae, 0x0023a0 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0x00000aa4, 0x002005 },
+  { 0x00000deb, 0x000e4b },
+  { 0x000007c6, 0x000396 },
+  { 0x000008fc, 0x002191 },
+  { 0x000009e8, 0x002424 },
+  { 0x000008c0, 0x002234 },
+  { 0x000007ea, 0x0003ba },
+  { 0x000005d8, 0x000638 },
+  { 0x000007c9, 0x000399 },
+  { 0x000006b8, 0x000408 },
+  { 0, 0 },
+  { 0x000001b6, 0x00015b },
+  { 0x00000eef, 0x00316d },
+  { 0x000001b2, 0x0002db },
+  { 0x00000ad1, 0x002019 },
+  { 0x000007a3, 0x000389 },
+  { 0x000008a9, 0x0023a4 },
+  { 0x000001db, 0x000170 },
+  { 0x0000ff80, 0x000020 },
+  { 0x00000ef6, 0x00318d },
+  { 0x000006b7, 0x000407 },
+  { 0x000001d8, 0x000158 },
+  { 0x000001b1, 0x000105 },
+  { 0x00000cf9, 0x0005e9 },
+  { 0x000007f5, 0x0003c5 },
+  { 0x000007a2, 0x000388 },
+  { 0x00000ed6, 0x0011aa },
+  { 0x000005e8, 0x000648 },
+  { 0x000006af, 0x00045f },
+  { 0x000007bb, 0x0003ce },
+  { 0x000004b1, 0x0030a2 },
+  { 0x000006a2, 0x000453 },
+  { 0x000002e5, 0x00010b },
+  { 0x00000aaa, 0x002013 },
+  { 0x000003ba, 0x000113 },
+  { 0x00000ef1, 0x003178 },
+  { 0x000006a8, 0x000458 },
+  { 0x000001ec, 0x00011b },
+  { 0x00000afe, 0x00201e },
+  { 0x000006ec, 0x00041b },
+  { 0x000007ee, 0x0003be },
+  { 0x000006ad, 0x000491 },
+  { 0x00000dc1, 0x000e21 },
+  { 0x000003cc, 0x000116 },
+  { 0x00000ab4, 0x002157 },
+  { 0x00000af5, 0x00266f },
+  { 0x000008bd, 0x002260 },
+  { 0x00000aa7, 0x002009 },
+  { 0x000001d0, 0x000110 },
+  { 0x000006e3, 0x000426 },
+  { 0x00000bc2, 0x0022a4 },
+  { 0x00000eaf, 0x00313f },
+  { 0x00000eca, 0x00315a },
+  { 0x00000ea8, 0x003138 },
+  { 0x00000ecc, 0x00315c },
+  { 0x000006e1, 0x000410 },
+  { 0x00000aa6, 0x002008 },
+  { 0x00000cf4, 0x0005e4 },
+  { 0x00000dbf, 0x000e1f },
+  { 0x000003cf, 0x00012a },
+  { 0x000001e5, 0x00013a },
+  { 0, 0 },
+  { 0x000004c2, 0x0030c4 },
+  { 0x000002de, 0x00015c },
+  { 0x000003bf, 0x00014b },
+  { 0x00000db9, 0x000e19 },
+  { 0x000006b5, 0x000405 },
+  { 0x000006ee, 0x00041d },
+  { 0, 0 },
+  { 0x00000dbc, 0x000e1c },
+  { 0, 0 },
+  { 0x000013be, 0x000178 },
+  { 0, 0 },
+  { 0x00000cec, 0x0005dc },
+  { 0x00000ebe, 0x00314e },
+  { 0, 0 },
+  { 0x00000ab7, 0x00215a },
+  { 0x00000ebb, 0x00314b },
+  { 0x000007ca, 0x00039a },
+  { 0x000005cf, 0x00062f },
+  { 0, 0 },
+  { 0, 0 },
+  { 0x00000ce5, 0x0005d5 },
+  { 0x000001bb, 0x000165 },
+  { 0x00000cea, 0x0005da },
+  { 0x000006bb, 0x00040b },
+  { 0x000007cf, 0x00039f },
+  { 0x000006b2, 0x000403 },
+  { 0, 0 },
+  { 0x000008ce, 0x0021d2 },
+  { 0x000005cd, 0x00062d },
+  { 0x00000ee5, 0x0011b9 },
+  { 0x000009e0, 0x0025c6 },
+  { 0x00000ea4, 0x003134 },
+  { 0x000004a1, 0x003002 },
+  { 0x000006e8, 0x000425 },
+  { 0x000004aa, 0x0030a7 },
+  { 0x0000ffaf, 0x00002f },
+  { 0x00000ab3, 0x002156 },
+  { 0x000001a1, 0x000104 },
+  { 0x000007d5, 0x0003a5 },
+  { 0x000006cd, 0x00043c },
+  { 0x00000ec2, 0x003152 },
+  { 0x00000ea6, 0x003136 },
+  { 0x00000eba, 0x00314a },
+  { 0x00000cf3, 0x0005e3 },
+  { 0x000008ef, 0x002202 },
+  { 0x000004c1, 0x0030c1 },
+  { 0x000006e0, 0x00042e },
+  { 0x000001a9, 0x000160 },
+  { 0x00000ed2, 0x003162 },
+  { 0x00000df8, 0x000e58 },
+  { 0x000001e8, 0x00010d },
+  { 0x000003b5, 0x000129 },
+  { 0x00000de6, 0x000e46 },
+  { 0x00000eed, 0x0011c1 },
+  { 0x000004ce, 0x0030db },
+  { 0x000008ab, 0x00239b },
+  { 0x00000ec8, 0x003158 },
+  { 0x000001bf, 0x00017c },
+  { 0, 0 },
+  { 0x00000ecb, 0x00315b },
+  { 0x00000cee, 0x0005de },
+  { 0x000001e0, 0x000155 },
+  { 0x000002fe, 0x00015d },
+  { 0x000001af, 0x00017b },
+  { 0x00000de1, 0x000e41 },
+  { 0x000004dc, 0x0030ef },
+  { 0x000001ca, 0x000118 },
+  { 0x00000af1, 0x002020 },
+  { 0x00000af4, 0x002717 },
+  { 0x000007b1, 0x0003ac },
+  { 0x000007ef, 0x0003bf },
+  { 0x00000bc4, 0x00230a },
+  { 0x000002d5, 0x000120 },
+  { 0x00000ed5, 0x0011a9 },
+  { 0x000004d0, 0x0030df },
+  { 0x000007b7, 0x0003cc },
+  { 0x00000dcd, 0x000e2d },
+  { 0x000001ae, 0x00017d },
+  { 0x000005e5, 0x000645 },
+  { 0x00000bcc, 0x002395 },
+  { 0x00000eb3, 0x003143 },
+  { 0x000005e6, 0x000646 },
+  { 0x000007f8, 0x0003c8 },
+  { 0x000006f2, 0x000420 },
+  { 0, 0 },
+  { 0x0000ff89, 0x000009 },
+  { 0x00000ab6, 0x002159 },
+  { 0x000004d2, 0x0030e1 },
+  { 0x00000daa, 0x000e0a },
+  { 0x000005c1, 0x000621 },
+  { 0x000004ca, 0x0030cf },
+  { 0x00000edc, 0x0011b0 },
+  { 0x000002e6, 0x000109 },
+  { 0x000002a9, 0x000130 },
+  { 0x000007ec, 0x0003bc },
+  { 0x000004bb, 0x0030b5 },
+  { 0x00000ea2, 0x003132 },
+  { 0x000004cb, 0x0030d2 },
+  { 0x000006c9, 0x000438 },
+  { 0x000008cf, 0x002261 },
+  { 0x000004b8, 0x0030af },
+  { 0x00000dc0, 0x000e20 },
+  { 0x000006de, 0x000447 },
+  { 0x000004d8, 0x0030ea },
+  { 0x000006a4, 0x000454 },
+  { 0x000006d0, 0x00043f },
+  { 0x000004c3, 0x0030c6 },
+  { 0x00000ee8, 0x0011bc },
+  { 0x000002f5, 0x000121 },
+  { 0x000006f6, 0x000416 },
+  { 0x000008db, 0x002283 },
+  { 0x000006c0, 0x00044e },
+  { 0x00000dab, 0x000e0b },
+  { 0x00000dd0, 0x000e30 },
+  { 0x00000edb, 0x0011af },
+  { 0x00000dce, 0x000e2e },
+  { 0, 0 },
+  { 0x000003d3, 0x000136 },
+  { 0x000007cb, 0x00039b },
+  { 0x000002b9, 0x000131 },
+  { 0x00000cfa, 0x0005ea },
+  { 0x00000cf8, 0x0005e8 },
+  { 0x000001e3, 0x000103 },
+  { 0x00000db0, 0x000e10 },
+  { 0x000009e1, 0x002592 },
+  { 0, 0 },
+  { 0x00000afd, 0x00201a },
+  { 0x000005f1, 0x000651 },
+  { 0x00000ad6, 0x002032 },
+  { 0x000007e7, 0x0003b7 },
+  { 0x00000de0, 0x000e40 },
+  { 0x000006c1, 0x000430 },
+  { 0x000007a1, 0x000386 },
+  { 0, 0 },
+  { 0x000003ab, 0x000122 },
+  { 0x000005d9, 0x000639 },
+  { 0x000008dc, 0x002229 },
+  { 0x000007d9, 0x0003a9 },
+  { 0x000005ec, 0x00064c },
+  { 0x000008da, 0x002282 },
+  { 0x000007f4, 0x0003c4 },
+  { 0x000006be, 0x00040e },
+  { 0x00000ee6, 0x0011ba },
+  { 0x000006ae, 0x00045e },
+  { 0x00000df3, 0x000e53 },
+  { 0x000009e4, 0x00240d },
+  { 0x000006c3, 0x000446 },
+  { 0x000008bc, 0x002264 },
+  { 0x000001f9, 0x00016f },
+  { 0, 0 },
+  { 0, 0 },
+  { 0x000007a5, 0x0003aa },
+  { 0x00000eb7, 0x003147 },
+  { 0x00000ece, 0x00315e },
+  { 0x00000de7, 0x000e47 },
+  { 0x000006ea, 0x000419 },
+  { 0x00000dc7, 0x000e27 },
+  { 0x00000dc9, 0x000e29 },
+  { 0, 0 },
+  { 0x000006c4, 0x000434 },
+  { 0x000007b9, 0x0003cb },
+  { 0x0000ffb6, 0x000036 },
+  { 0x00000ef3, 0x003181 },
+  { 0x000006e4, 0x000414 },
+  { 0x000009ef, 0x0023ba },
+  { 0x000007cd, 0x00039d },
+  { 0x000008f6, 0x000192 },
+  { 0x000004dd, 0x0030f3 },
+  { 0, 0 },
+  { 0x000005c4, 0x000624 },
+  { 0x00000dad, 0x000e0d },
+  { 0x000005bb, 0x00061b },
+  { 0x000003b3, 0x000157 },
+  { 0x000001d2, 0x000147 },
+  { 0, 0 },
+  { 0x000004a4, 0x003001 },
+  { 0x00000eb9, 0x003149 },
+  { 0x000004b6, 0x0030ab },
+  { 0x000001aa, 0x00015e },
+  { 0, 0 },
+  { 0x000009f7, 0x00252c },
+  { 0x000005c8, 0x000628 },
+  { 0, 0 },
+  { 0x00000ee2, 0x0011b6 },
+  { 0, 0 },
+  { 0x0000ffbd, 0x00003d },
+  { 0x000009e2, 0x002409 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0x000008de, 0x002227 },
+  { 0x000003bb, 0x000123 },
+  { 0x000006d8, 0x00044c },
+  { 0x00000dc5, 0x000e25 },
+  { 0x000020ac, 0x0020ac },
+  { 0x000004a8, 0x0030a3 },
+  { 0x000004c5, 0x0030ca },
+  { 0, 0 },
+  { 0x000009ea, 0x002518 },
+  { 0x00000ab0, 0x002153 },
+  { 0x000004cc, 0x0030d5 },
+  { 0x00000ee3, 0x0011b7 },
+  { 0x00000df9, 0x000e59 },
+  { 0, 0 },
+  { 0x000007f6, 0x0003c6 },
+  { 0x000006ff, 0x00042a },
+  { 0x0000ffab, 0x00002b },
+  { 0x000006a5, 0x000455 },
+  { 0x000007e4, 0x0003b4 },
+  { 0x00000aa9, 0x002014 },
+  { 0x00000af3, 0x002713 },
+  { 0x00000ea5, 0x003135 },
+  { 0, 0 },
+  { 0x000003a5, 0x000128 },
+  { 0x00000ce4, 0x0005d4 },
+  { 0, 0 },
+  { 0x00000ec1, 0x003151 },
+  { 0x00000de3, 0x000e43 },
+  { 0x000003fd, 0x000169 },
+  { 0x000005c9, 0x000629 },
+  { 0x00000ebf, 0x00314f },
+  { 0x00000ed8, 0x0011ac },
+  { 0, 0 },
+  { 0x00000dea, 0x000e4a },
+  { 0x000009ed, 0x002514 },
+  { 0x00000eae, 0x00313e },
+  { 0x000006a6, 0x000456 },
+  { 0x000006bf, 0x00040f },
+  { 0x00000ce7, 0x0005d7 },
+  { 0, 0 },
+  { 0x000003b6, 0x00013c },
+  { 0x000006ed, 0x00041c },
+  { 0, 0 },
+  { 0x00000bcf, 0x0025cb },
+  { 0x000006ca, 0x000439 },
+  { 0x000004c4, 0x0030c8 },
+  { 0x000006b4, 0x000404 },
+  { 0, 0 },
+  { 0x000002ab, 0x00011e },
+  { 0x00000da7, 0x000e07 },
+  { 0x000001bc, 0x00017a },
+  { 0, 0 },
+  { 0x000007cc, 0x00039c },
+  { 0, 0 },
+  { 0x00000dd5, 0x000e35 },
+  { 0x000007f7, 0x0003c7 },
+  { 0x000004be, 0x0030bb },
+  { 0x000001f8, 0x000159 },
+  { 0x00000dd8, 0x000e38 },
+  { 0x000006e6, 0x000424 },
+  { 0x000005e0, 0x000640 },
+  { 0x000006bd, 0x000490 },
+  { 0x000001de, 0x000162 },
+  { 0x00000cf6, 0x0005e6 },
+  { 0, 0 },
+  { 0x000004b3, 0x0030a6 },
+  { 0x00000ea7, 0x003137 },
+  { 0x00000dd1, 0x000e31 },
+  { 0x00000aa8, 0x00200a },
+  { 0x000008fe, 0x002193 },
+  { 0x000004ac, 0x0030e3 },
+  { 0x000009f3, 0x0023bd },
+  { 0x00000dc8, 0x000e28 },
+  { 0, 0 },
+  { 0x00000aec, 0x002663 },
+  { 0x000005ce, 0x00062e },
+  { 0x00000da3, 0x000e03 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0x000006fa, 0x000417 },
+  { 0x000003ef, 0x00012b },
+  { 0x00000ec3, 0x003153 },
+  { 0x00000bdc, 0x0022a3 },
+  { 0x000007f0, 0x0003c0 },
+  { 0x00000aae, 0x002026 },
+  { 0x000007c2, 0x000392 },
+  { 0x000005ee, 0x00064e },
+  { 0x00000ee1, 0x0011b5 },
+  { 0x000007f3, 0x0003c2 },
+  { 0x00000af6, 0x00266d },
+  { 0, 0 },
+  { 0x000006e5, 0x000415 },
+  { 0x000007d8, 0x0003a8 },
+  { 0x000001be, 0x00017e },
+  { 0x000008c2, 0x00221e },
+  { 0, 0 },
+  { 0x000005e3, 0x000643 },
+  { 0, 0 },
+  { 0x000006b0, 0x002116 },
+  { 0, 0 },
+  { 0x000004a7, 0x0030a1 },
+  { 0x000005bf, 0x00061f },
+  { 0, 0 },
+  { 0, 0 },
+  { 0x000001ac, 0x000179 },
+  { 0x000006f1, 0x00042f },
+  { 0x000004d9, 0x0030eb },
+  { 0, 0 },
+  { 0x000006fd, 0x000429 },
+  { 0, 0 },
+  { 0x000004cf, 0x0030de },
+  { 0x000003fe, 0x00016b },
+  { 0x000005d7, 0x000637 },
+  { 0x00000eeb, 0x0011bf },
+  { 0x000006cb, 0x00043a },
+  { 0x00000ad4, 0x00211e },
+  { 0x00000dca, 0x000e2a },
+  { 0x00000abb, 0x002012 },
+  { 0x000009e3, 0x00240c },
+  { 0x00000eb8, 0x003148 },
+  { 0x000007ed, 0x0003bd },
+  { 0x00000aa2, 0x002002 },
+  { 0x000009e5, 0x00240a },
+  { 0x000003d2, 0x00014c },
+  { 0x000007d2, 0x0003a3 },
+  { 0x000001c0, 0x000154 },
+  { 0x000009ec, 0x00250c },
+  { 0, 0 },
+  { 0x00000cf2, 0x0005e2 },
+  { 0x000008aa, 0x0023a6 },
+  { 0x00000ab2, 0x002155 },
+  { 0x000004c9, 0x0030ce },
+  { 0x000005d3, 0x000633 },
+  { 0x000004b5, 0x0030aa },
+  { 0x0000ffaa, 0x00002a },
+  { 0x000006fb, 0x000428 },
+  { 0x000006c5, 0x000435 },
+  { 0, 0 },
+  { 0x000002d8, 0x00011c },
+  { 0x00000dc4, 0x000e24 },
+  { 0x00000dd4, 0x000e34 },
+  { 0x00000ab8, 0x002105 },
+  { 0x00000afc, 0x002038 },
+  { 0x00000ce2, 0x0005d2 },
+  { 0x00000dd9, 0x000e39 },
+  { 0x000005c5, 0x000625 },
+  { 0x00000da8, 0x000e08 },
+  { 0x00000ef8, 0x0011eb },
+  { 0x000001b9, 0x000161 },
+  { 0, 0 },
+  { 0x00000df6, 0x000e56 },
+  { 0x000006d5, 0x000443 },
+  { 0x000005eb, 0x00064b },
+  { 0x0000ffb2, 0x000032 },
+  { 0x00000db2, 0x000e12 },
+  { 0x000005da, 0x00063a },
+  { 0x000009f0, 0x0023bb },
+  { 0x00000ac6, 0x00215e },
+  { 0x000004bc, 0x0030b7 },
+  { 0x000006db, 0x000448 },
+  { 0x000001fe, 0x000163 },
+  { 0, 0 },
+  { 0x000002a1, 0x000126 },
+  { 0x00000ea3, 0x003133 },
+  { 0x00000de5, 0x000e45 },
+  { 0x00000ee4, 0x0011b8 },
+  { 0x000009e9, 0x00240b },
+  { 0x000001cc, 0x00011a },
+  { 0x00000dcf, 0x000e2f },
+  { 0x00000ed9, 0x0011ad },
+  { 0, 0 },
+  { 0x000008a7, 0x0023a1 },
+  { 0x00000aa3, 0x002004 },
+  { 0x00000de2, 0x000e42 },
+  { 0x000006dd, 0x000449 },
+  { 0x000008df, 0x002228 },
+  { 0, 0 },
+  { 0x000008d6, 0x00221a },
+  { 0x00000ce0, 0x0005d0 },
+  { 0x000006b3, 0x000401 },
+  { 0x00000aee, 0x002665 },
+  { 0x000003f1, 0x000146 },
+  { 0x00000af2, 0x002021 },
+  { 0x00000ead, 0x00313d },
+  { 0x000006ba, 0x00040a },
+  { 0x000004d7, 0x0030e9 },
+  { 0x000006a3, 0x000451 },
+  { 0x0000ffb0, 0x000030 },
+  { 0x000003bd, 0x00014a },
+  { 0x00000dae, 0x000e0e },
+  { 0x00000da9, 0x000e09 },
+  { 0x000003f3, 0x000137 },
+  { 0x000007ba, 0x0003b0 },
+  { 0x000006bc, 0x00040c },
+  { 0x000007d4, 0x0003a4 },
+  { 0x000007e8, 0x0003b8 },
+  { 0x000006d9, 0x00044b },
+  { 0, 0 },
+  { 0x000008bf, 0x00222b },
+  { 0x00000ced, 0x0005dd },
+  { 0x00000efa, 0x0011f9 },
+  { 0, 0 },
+  { 0x00000aa1, 0x002003 },
+  { 0x000007b3, 0x0003ae },
+  { 0x000001e6, 0x000107 },
+  { 0x000002b1, 0x000127 },
+  { 0x000001d9, 0x00016e },
+  { 0, 0 },
+  { 0x000009f1, 0x002500 },
+  { 0x0000ffac, 0x00002c },
+  { 0x000006a9, 0x000459 },
+  { 0x000001d1, 0x000143 },
+  { 0x000008a5, 0x002321 },
+  { 0x000004a2, 0x00300c },
+  { 0x00000bca, 0x002218 },
+  { 0x000001b3, 0x000142 },
+  { 0x00000ea9, 0x003139 },
+  { 0x000004b7, 0x0030ad },
+  { 0x000005e7, 0x000647 },
+  { 0x000007c7, 0x000397 },
+  { 0x00000eea, 0x0011be },
+  { 0x000005e4, 0x000644 },
+  { 0x000002ac, 0x000134 },
+  { 0x00000dd3, 0x000e33 },
+  { 0x000008c9, 0x002243 },
+  { 0x000007c4, 0x000394 },
+  { 0x0000ffb7, 0x000037 },
+  { 0x00000ac3, 0x00215b },
+  { 0x000005c6, 0x000626 },
+  { 0x00000dd2, 0x000e32 },
+  { 0x000007ab, 0x00038f },
+  { 0x00000de8, 0x000e48 },
+  { 0, 0 },
+  { 0x000005ca, 0x00062a },
+  { 0x00000eb5, 0x003145 },
+  { 0x000007e2, 0x0003b2 },
+  { 0x000004a6, 0x0030f2 },
+  { 0x00000ef4, 0x003184 },
+  { 0x000006f8, 0x00042c },
+  { 0, 0 },
+  { 0x000007eb, 0x0003bb },
+  { 0x000004b4, 0x0030a8 },
+  { 0x000003dd, 0x000168 },
+  { 0x000007b5, 0x0003ca },
+  { 0x000001a2, 0x0002d8 },
+  { 0x000007b8, 0x0003cd },
+  { 0x00000dd7, 0x000e37 },
+  { 0x000005f0, 0x000650 },
+  { 0x0000ffae, 0x00002e },
+  { 0x000005d4, 0x000634 },
+  { 0x00000dac, 0x000e0c },
+  { 0x00000ce8, 0x0005d8 },
+  { 0x000005c3, 0x000623 },
+  { 0, 0 },
+  { 0x000004b2, 0x0030a4 },
+  { 0x000008c1, 0x00221d },
+  { 0, 0 },
+  { 0x000004c7, 0x0030cc },
+  { 0, 0 },
+  { 0x00000ec7, 0x003157 },
+  { 0x000007a9, 0x0003ab },
+  { 0x00000cf7, 0x0005e7 },
+  { 0x00000daf, 0x000e0f },
+  { 0x000001b5, 0x00013e },
+  { 0x000006da, 0x000437 },
+  { 0x000007af, 0x002015 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0x000009f2, 0x0023bc },
+  { 0x000008a4, 0x002320 },
+  { 0x0000047e, 0x00203e },
+  { 0x000002c6, 0x000108 },
+  { 0, 0 },
+  { 0x00000ce3, 0x0005d3 },
+  { 0x000001f2, 0x000148 },
+  { 0x00000db4, 0x000e14 },
+  { 0x000004c8, 0x0030cd },
+  { 0, 0 },
+  { 0x00000eb1, 0x003141 },
+  { 0x000005f2, 0x000652 },
+  { 0, 0 },
+  { 0x000007d1, 0x0003a1 },
+  { 0x000006d7, 0x000432 },
+  { 0x00000ad0, 0x002018 },
+  { 0, 0 },
+  { 0x00000bce, 0x0022a5 },
+  { 0x000003ec, 0x000117 },
+  { 0x000002bc, 0x000135 },
+  { 0, 0 },
+  { 0x000001c6, 0x000106 },
+  { 0x000003ac, 0x000166 },
+  { 0, 0 },
+  { 0x0000ffb4, 0x000034 },
+  { 0x00000de9, 0x000e49 },
+  { 0x000006c7, 0x000433 },
+  { 0x000003e7, 0x00012f },
+  { 0x000004d5, 0x0030e6 },
+  { 0x00000dcb, 0x000e2b },
+  { 0x000009f8, 0x002502 },
+  { 0x000006e9, 0x000418 },
+  { 0x00000ee0, 0x0011b4 },
+  { 0x000005d6, 0x000636 },
+  { 0x000007a7, 0x00038c },
+  { 0x00000ac9, 0x002122 },
+  { 0x000006cc, 0x00043b },
+  { 0x00000da4, 0x000e04 },
+  { 0x00000ef2, 0x00317f },
+  { 0, 0 },
+  { 0x00000eb0, 0x003140 },
+  { 0x00000da2, 0x000e02 },
+  { 0x000007ae, 0x000385 },
+  { 0x000005ed, 0x00064d },
+  { 0x000004a9, 0x0030a5 },
+  { 0x000006eb, 0x00041a },
+  { 0x00000ed3, 0x003163 },
+  { 0x000004af, 0x0030c3 },
+  { 0x00000af8, 0x002640 },
+  { 0x000007c3, 0x000393 },
+  { 0x00000ef0, 0x003171 },
+  { 0x000005e2, 0x000642 },
+  { 0x00000dec, 0x000e4c },
+  { 0x000007c1, 0x000391 },
+  { 0x00000db7, 0x000e17 },
+  { 0x000007ce, 0x00039e },
+  { 0x00000ecd, 0x00315d },
+  { 0x000001ba, 0x00015f },
+  { 0x000004cd, 0x0030d8 },
+  { 0x000005cb, 0x00062b },
+  { 0x000004db, 0x0030ed },
+  { 0x0000ff8d, 0x00000d },
+  { 0x000002dd, 0x00016c },
+  { 0x000004c6, 0x0030cb },
+  { 0x000002fd, 0x00016d },
+  { 0x000005ea, 0x00064a },
+  { 0x000004ab, 0x0030a9 },
+  { 0x00000dda, 0x000e3a },
+  { 0x000007d6, 0x0003a6 },
+  { 0, 0 },
+  { 0x00000aaf, 0x002025 },
+  { 0, 0 },
+  { 0x0000ffb5, 0x000035 },
+  { 0x000007b4, 0x0003af },
+  { 0x000001a3, 0x000141 },
+  { 0x000003d1, 0x000145 },
+  { 0x000008dd, 0x00222a },
+  { 0x000001c5, 0x000139 },
+  { 0x00000de4, 0x000e44 },
+  { 0x000007b6, 0x000390 },
+  { 0x000006b6, 0x000406 },
+  { 0x000006aa, 0x00045a },
+  { 0x000004ad, 0x0030e5 },
+  { 0x000001c3, 0x000102 },
+  { 0, 0 },
+  { 0x000003de, 0x00016a },
+  { 0x00000ce1, 0x0005d1 },
+  { 0x0000ffb3, 0x000033 },
+  { 0x0000ffb9, 0x000039 },
+  { 0x000005c7, 0x000627 },
+  { 0x000004d3, 0x0030e2 },
+  { 0x00000db3, 0x000e13 },
+  { 0x000006f3, 0x000421 },
+  { 0x00000af7, 0x002642 },
+  { 0x00000dcc, 0x000e2c },
+  { 0x00000eda, 0x0011ae },
+  { 0x000006b1, 0x000402 },
+  { 0x00000db6, 0x000e16 },
+  { 0x000008af, 0x0023a8 },
+  { 0x000003c7, 0x00012e },
+  { 0x000005cc, 0x00062c },
+  { 0x000008c8, 0x00223c },
+  { 0x000002bb, 0x00011f },
+  { 0x000006c2, 0x000431 },
+  { 0x000009eb, 0x002510 },
+  { 0x000008ad, 0x00239e },
+  { 0x000008ac, 0x00239d },
+  { 0x000001ff, 0x0002d9 },
+  { 0, 0 },
+  { 0x00000eb2, 0x003142 },
+  { 0x000005d5, 0x000635 },
+  { 0x00000eec, 0x0011c0 },
+  { 0x000006ab, 0x00045b },
+  { 0x00000ed1, 0x003161 },
+  { 0x000006d1, 0x00044f },
+  { 0x000004a5, 0x0030fb },
+  { 0x000006f9, 0x00042b },
+  { 0x000008c5, 0x002207 },
+  { 0x00000ad7, 0x002033 },
+  { 0x00000ad9, 0x00271d },
+  { 0x000008a1, 0x0023b7 },
+  { 0x00000cf1, 0x0005e1 },
+  { 0x00000ad3, 0x00201d },
+  { 0, 0 },
+  { 0x000007f2, 0x0003c3 },
+  { 0x00000ed0, 0x003160 },
+  { 0x000003f2, 0x00014d },
+  { 0x0000ffb8, 0x000038 },
+  { 0x00000eab, 0x00313b },
+  { 0x000004d6, 0x0030e8 },
+  { 0x000004c0, 0x0030bf },
+  { 0, 0 },
+  { 0x00000ddf, 0x000e3f },
+  { 0x000005e9, 0x000649 },
+  { 0x000006c8, 0x000445 },
+  { 0x000001ea, 0x000119 },
+  { 0x000006d4, 0x000442 },
+  { 0x000006c6, 0x000444 },
+  { 0x00000ebd, 0x00314d },
+  { 0x000004ae, 0x0030e7 },
+  { 0x000002b6, 0x000125 },
+  { 0x00000df1, 0x000e51 },
+  { 0x00000dbd, 0x000e1d },
+  { 0x000007e1, 0x0003b1 },
+  { 0x00000ce6, 0x0005d6 },
+  { 0x00000bd3, 0x002308 },
+  { 0x000006fe, 0x000427 },
+  { 0, 0 },
+  { 0x000003aa, 0x000112 },
+  { 0x000007e6, 0x0003b6 },
+  { 0, 0 },
+  { 0x000006b9, 0x000409 },
+  { 0x000007e3, 0x0003b3 },
+  { 0x000008cd, 0x0021d4 },
+  { 0x00000df0, 0x000e50 },
+  { 0x000001f0, 0x000111 },
+  { 0x000007c8, 0x000398 },
+  { 0x000006f4, 0x000422 },
+  { 0x00000ab5, 0x002158 },
+  { 0x000008fd, 0x002192 },
+  { 0x00000ef5, 0x003186 },
+  { 0x00000edf, 0x0011b3 },
+  { 0x00000ad2, 0x00201c },
+  { 0x000006ac, 0x00045c },
+  { 0x000006d3, 0x000441 },
+  { 0x000002a6, 0x000124 },
+  { 0x00000dd6, 0x000e36 },
+  { 0x000007c5, 0x000395 },
+  { 0x000006f7, 0x000412 },
+  { 0x000007a8, 0x00038e },
+  { 0x000004b9, 0x0030b1 },
+  { 0x00000ee9, 0x0011bd },
+  { 0x000004ba, 0x0030b3 },
+  { 0, 0 },
+  { 0x000007a4, 0x00038a },
+  { 0x00000edd, 0x0011b1 },
+  { 0x00000eaa, 0x00313a },
+  { 0x000006a7, 0x000457 },
+  { 0x00000df5, 0x000e55 },
+  { 0x00000cf0, 0x0005e0 },
+  { 0x000009f5, 0x002524 },
+  { 0x00000db1, 0x000e11 },
+  { 0x00000ec0, 0x003150 },
+  { 0x000002c5, 0x00010a },
+  { 0x000005ac, 0x00060c },
+  { 0x000004de, 0x00309b },
+  { 0x000006df, 0x00044a },
+  { 0x00000dba, 0x000e1a },
+  { 0x00000bfc, 0x0022a2 },
+  { 0x000003a2, 0x000138 },
+  { 0, 0 },
+  { 0x00000db5, 0x000e15 },
+  { 0x000008a8, 0x0023a3 },
+  { 0x000007e9, 0x0003b9 },
+  { 0x000006fc, 0x00042d },
+  { 0x000013bd, 0x000153 },
+  { 0x000009f4, 0x00251c },
+  { 0x000004da, 0x0030ec },
+  { 0x000007b2, 0x0003ad },
+  { 0x000005e1, 0x000641 },
+  { 0x000007f1, 0x0003c1 },
+  { 0, 0 },
+  { 0x000006dc, 0x00044d },
+  { 0x00000ec6, 0x003156 },
+  { 0x000008fb, 0x002190 },
+  { 0x000006f0, 0x00041f },
+  { 0x000003d9, 0x000172 },
+  { 0x000006ef, 0x00041e },
+  { 0x000003a6, 0x00013b },
+  { 0x00000cf5, 0x0005e5 },
+  { 0x000004d4, 0x0030e4 },
+  { 0x000001b7, 0x0002c7 },
+  { 0x000007d0, 0x0003a0 },
+  { 0x00000df7, 0x000e57 },
+  { 0x00000ecf, 0x00315f },
+  { 0x000004df, 0x00309c },
+  { 0x00000da1, 0x000e01 },
+  { 0x000003a3, 0x000156 },
+  { 0x000006cf, 0x00043e },
+  { 0x00000afa, 0x002315 },
+  { 0x000009f6, 0x002534 },
+  { 0x000008b0, 0x0023ac },
+  { 0x00000ea1, 0x003131 },
+  { 0x000005d1, 0x000631 },
+  { 0, 0 },
+  { 0x0000ffb1, 0x000031 },
+  { 0x00000aa5, 0x002007 },
+  { 0, 0 },
+  { 0x00000ebc, 0x00314c },
+  { 0x00000ac5, 0x00215d },
+  { 0x00000ec4, 0x003154 },
+  { 0x000002f8, 0x00011d },
+  { 0x00000ed4, 0x0011a8 },
+  { 0x000001fb, 0x000171 },
+  { 0x000006d6, 0x000436 },
+  { 0x00000af9, 0x00260e },
+  { 0, 0 },
+  { 0, 0 },
+  { 0x000008be, 0x002265 },
+  { 0x000001a5, 0x00013d },
+  { 0x000006f5, 0x000423 },
+  { 0x000003c0, 0x000100 },
+  { 0x000001f1, 0x000144 },
+  { 0x000003bc, 0x000167 },
+  { 0x00000ad5, 0x002030 },
+  { 0, 0 },
+  { 0, 0 },
+  { 0x0000ffad, 0x00002d },
+  { 0x000005c2, 0x000622 },
+  { 0, 0 },
+  { 0x00000ef9, 0x0011f0 },
+  { 0x000001f5, 0x000151 },
+  { 0x00000ed7, 0x0011ab },
+  { 0x000006e2, 0x000411 },
+  { 0x00000dc2, 0x000e22 },
+  { 0x00000afb, 0x002117 },
+  { 0x00000ec5, 0x003155 },
+  { 0x00000ceb, 0x0005db },
+  { 0x000001ef, 0x00010f },
+  { 0x00000cdf, 0x002017 },
+  { 0x000005d0, 0x000630 },
+  { 0x00000ee7, 0x0011bb },
+  { 0x00000dbb, 0x000e1b },
+  { 0x00000df2, 0x000e52 },
+  { 0x000001ab, 0x000164 },
+  { 0x00000ef7, 0x00318e },
+  { 0x000001d5, 0x000150 },
+  { 0x000005ef, 0x00064f },
+  { 0x000007d7, 0x0003a7 },
+  { 0x000004b0, 0x0030fc },
+  { 0x000006e7, 0x000413 },
+  { 0x000001cf, 0x00010e },
+  { 0x000004bf, 0x0030bd },
+  { 0x00000ac4, 0x00215c },
+  { 0x00000ded, 0x000e4d },
+};
+
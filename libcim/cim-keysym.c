@@ -0,0 +1,146 @@
+/* -*- Mode: C; indent-tabs-mode: nil; c-basic-offset: 2; tab-width: 2 -*- */
+/*
+ * cim-keysym.c
+ * This file is part of Cim.
+ *
+ * Copyright (C) 2023 Hodong Kim <hodong@nimfsoft.art>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+#include "cim.h"
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct
+{
+  uint32_t keysym;
+  uint16_t name; /* offset in cim_keysym_names */
+} CimKeysymName;
+
+typedef struct
+{
+  uint32_t keysym;
+  uint32_t unicode;
+} CimKeysymUnicode;
+
+#include "cim-keysym-table.h"
+
+/* The hashes must match those in gen-keysym-table.rb. */
+static inline uint32_t cim_keysym_fmix32 (uint32_t h)
+{
+  h ^= h >> 16;
+  h *= 0x85ebca6b;
+  h ^= h >> 13;
+  h *= 0xc2b2ae35;
+  h ^= h >> 16;
+
+  return h;
+}
+
+static inline uint32_t cim_keysym_reduce (uint32_t h, uint32_t n)
+{
+  return (uint64_t) h * n >> 32;
+}
+
+static inline uint32_t cim_keysym_slot (uint32_t        h,
+                                        const uint16_t* disps,
+                                        uint32_t        n_buckets,
+                                        uint32_t        n_slots)
+{
+  uint16_t disp = disps[cim_keysym_reduce (cim_keysym_fmix32 (h), n_buckets)];
+
+  return cim_keysym_reduce (cim_keysym_fmix32 (h + disp * 0x9e3779b9u),
+                            n_slots);
+}
+
+/*
+ * Also takes "0x" followed by a hexadecimal keysym, and "U" followed by a
+ * hexadecimal code point, as xkb does.  Returns 0 for unknown names.
+ */
+uint32_t cim_keysym_from_name (const char* name)
+{
+  const CimKeysymName* slot;
+  uint32_t             h = 2166136261u;
+  char*                end;
+  unsigned long        value;
+
+  for (const char* p = name; *p; p++)
+    h = (h ^ (uint8_t) *p) * 16777619u;
+
+  slot = &cim_keysym_from_name_slots[
+    cim_keysym_slot (h, cim_keysym_from_name_disps,
+                     CIM_KEYSYM_FROM_NAME_N_BUCKETS,
+                     CIM_KEYSYM_FROM_NAME_N_SLOTS)];
+
+  if (slot->name != CIM_KEYSYM_NO_NAME &&
+      !strcmp (cim_keysym_names + slot->name, name))
+    return slot->keysym;
+
+  if (name[0] == 'U' && name[1] != '+' && name[1] != '-' && name[1])
+  {
+    value = strtoul (name + 1, &end, 16);
+
+    if (!*end && value <= 0x10ffff)
+      return value < 0x100 ? value : 0x01000000 | value;
+  }
+  else if (name[0] == '0' && (name[1] == 'x' || name[1] == 'X') && name[2] &&
+           name[2] != '+' && name[2] != '-')
+  {
+    value = strtoul (name + 2, &end, 16);
+
+    if (!*end && value <= 0x1fffffff)
+      return value;
+  }
+
+  return 0;
+}
+
+/* Returns NULL for keysyms without a name. */
+const char* cim_keysym_get_name (uint32_t keysym)
+{
+  const CimKeysymName* slot;
+
+  if (keysym < 0x100)
+  {
+    uint16_t name = cim_keysym_latin1_names[keysym];
+
+    return name != CIM_KEYSYM_NO_NAME ? cim_keysym_names + name : NULL;
+  }
+
+  slot = &cim_keysym_to_name_slots[
+    cim_keysym_slot (keysym, cim_keysym_to_name_disps,
+                     CIM_KEYSYM_TO_NAME_N_BUCKETS,
+                     CIM_KEYSYM_TO_NAME_N_SLOTS)];
+
+  return slot->keysym == keysym ? cim_keysym_names + slot->name : NULL;
+}
+
+/* Returns the character a keysym types, or 0. */
+uint32_t cim_keysym_to_unicode (uint32_t keysym)
+{
+  const CimKeysymUnicode* slot;
+
+  /* Latin-1 keysyms are their own code points. */
+  if ((keysym - 0x20 < 0x5f) | (keysym - 0xa0 < 0x60))
+    return keysym;
+
+  if (keysym - 0x01000100 <= 0x10ffff - 0x100)
+    return keysym - 0x01000000;
+
+  slot = &cim_keysym_to_unicode_slots[
+    cim_keysym_slot (keysym, cim_keysym_to_unicode_disps,
+                     CIM_KEYSYM_TO_UNICODE_N_BUCKETS,
+                     CIM_KEYSYM_TO_UNICODE_N_SLOTS)];
+
+  return slot->keysym == keysym ? slot->unicode : 0;
+}
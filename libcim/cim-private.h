@@ -0,0 +1,76 @@
+/* -*- Mode: C; indent-tabs-mode: nil; c-basic-offset: 2; tab-width: 2 -*- */
+/*
+ * cim-private.h
+ * This file is part of Cim.
+ *
+ * Copyright (C) 2023 Hodong Kim <hodong@nimfsoft.art>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+#ifndef __CIM_PRIVATE_H__
+#define __CIM_PRIVATE_H__
+
+#include "cim.h"
+#include "c-macros.h"
+#include <stddef.h>
+
+C_BEGIN_DECLS
+
+/* built-in engine used when cim.so is missing or cannot be loaded */
+const CimIcOps* cim_fallback_query   (uint32_t abi_version);
+CimIc*          cim_fallback_ic_new  ();
+void            cim_fallback_ic_free (CimIc* ic);
+
+/* for cim-server, which sends it back with the answer */
+int             cim_ic_take_repeats_left (CimIc* ic);
+
+/* engine forwarding to cim-server, see cim-client.c */
+typedef struct _CimClient CimClient;
+
+CimClient*      cim_client_new       ();
+void            cim_client_free      (CimClient* client);
+const CimIcOps* cim_client_query     (CimClient* client);
+bool            cim_client_is_dead   (CimClient* client);
+CimIc*          cim_client_ic_new    (CimClient* client);
+void            cim_client_ic_free   (CimIc* ic);
+
+/* per-IC candidate storage, see cim-candidate.c */
+#define CIM_ITEM_NONE 0xff /* an empty cell of a CimCandidate table */
+
+typedef struct _CimCandidateArena CimCandidateArena;
+struct _CimCandidateArena {
+  CimCandidateBlock block;
+  char*             text;
+  size_t            text_len;
+  size_t            text_capa;
+  uint32_t*         offsets;
+  uint32_t*         lens;
+  uint8_t*          types;
+  CimItem*          items;
+  CimItem**         table;
+  int               capa;
+};
+
+void      cim_candidate_arena_reserve (CimCandidateArena* arena, int n_items);
+void      cim_candidate_arena_reset   (CimCandidateArena* arena, int index);
+void      cim_candidate_arena_add     (CimCandidateArena* arena,
+                                       int                type,
+                                       const char*        text,
+                                       size_t             len);
+const CimCandidateBlock*
+          cim_candidate_arena_block   (CimCandidateArena* arena);
+CimItem** cim_candidate_arena_table   (CimCandidateArena* arena);
+void      cim_candidate_arena_clear   (CimCandidateArena* arena);
+
+C_END_DECLS
+
+#endif /* __CIM_PRIVATE_H__ */
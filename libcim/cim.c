@@ -17,18 +17,157 @@
  * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
  */
 #include "cim.h"
+#include "cim-private.h"
 #include <dlfcn.h>
+#include <stddef.h>
 #include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <pthread.h>
 #include <stdatomic.h>
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <sys/eventfd.h>
+#endif
 #include "c-utils.h"
 #include "c-str.h"
+#include "c-utf8.h"
 #include "c-mem.h"
 #include "c-log.h"
 
-static void    *cim_plugin;
-static CimIc* (*cim_plugin_new)  ();
-static void   (*cim_plugin_free) (CimIc*);
-static atomic_uint cim_ref_count;
+/*
+ * An engine generation.  Every IC holds a reference to the generation that
+ * created it, and the current generation holds one more.  When cim.so is
+ * replaced, new ICs get a new generation while existing ICs keep running
+ * on the old one, which is dlclose()d once its last IC is freed.  Key
+ * events go straight to the IC and never look at this.
+ *
+ * When cim-server is running, the generation is a connection to it instead
+ * of a loaded cim.so, and the server takes care of reloading.
+ */
+typedef struct _CimEngine CimEngine;
+struct _CimEngine {
+  void*       handle; /* NULL for the built-in engine */
+  int         fd;
+  CimClient*  client; /* non-NULL when forwarding to cim-server */
+  CimIcOps    ops;
+  CimIc*    (*ic_new)  ();
+  void      (*ic_free) (CimIc* ic);
+  atomic_uint ref_count;
+};
+
+/*
+ * libcim's part of an IC.  While cim_ic_filter_events() runs, callbacks
+ * from the engine are not forwarded to the toolkit but recorded here, and
+ * flushed as one commit and at most one preedit and candidate update.
+ *
+ * While an asynchronous event is pending, later events wait in a ring
+ * buffer so that they reach the engine in order.
+ *
+ * Candidate prefetches also go through the ready list, so that they run
+ * from cim_dispatch().
+ */
+typedef struct _CimPreeditEdge CimPreeditEdge;
+struct _CimPreeditEdge {
+  int pos;
+  int type;
+  int delta; /* 1 where an attribute starts, -1 where it ends */
+};
+
+struct _CimIcPrivate {
+  CimIcShared  shared;  /* first, for the inline calls in cim.h */
+  CimEngine*   engine;
+  CimCallbacks callbacks;
+  void*        user_data[CIM_CB_N_TYPES];
+  /* the focused field, see cim_ic_set_content_type() */
+  CimPurpose   purpose;
+  uint32_t     hints;
+  /* what the toolkit has been told */
+  bool         preedit_started;
+  bool         candidate_started;
+  uint64_t     preedit_generation;
+  char*        last_text;  /* for preedit_delta, in last_arena */
+  CimPreeditAttr* last_attrs;
+  int          last_attrs_len;
+  CArena       last_arena;
+  max_align_t  last_seed[16];
+  /* measured texts */
+  CimText      preedit_text;
+  bool         preedit_text_valid;
+  uint64_t     preedit_text_generation;
+  CimPreeditRun*  runs;
+  CimPreeditEdge* edges;  /* scratch for the runs */
+  int          runs_capa; /* of both, in attributes */
+  int          n_runs;
+  bool         runs_valid;
+  uint64_t     runs_generation;
+  int*         text_offsets; /* byte offsets, then UTF-16 offsets */
+  size_t       text_offsets_capa;
+  CimText      commit_text;  /* while the commit callback runs */
+  /* surrounding text window, see cim_ic_set_surround() */
+  CimSurround  surround;
+  char*        surround_buf;
+  size_t       surround_capa;
+  int          surround_cursor;  /* in bytes */
+  int          surround_anchor;  /* in bytes */
+  bool         surround_valid;
+  bool         surround_tracked; /* the toolkit reports changes */
+  uint64_t     surround_generation;
+  /* batch state */
+  CimEvent*    batch;        /* the events given to the engine */
+  int*         batch_first;  /* the index of each in the caller's events */
+  bool*        batch_handled;
+  int*         batch_left;   /* repeats the engine did not use */
+  int          batch_len;    /* while the engine has the batch */
+  int          batch_capa;
+  bool         batching;
+  bool         engine_preedit_started;
+  bool         engine_candidate_started;
+  bool         preedit_dirty;
+  bool         candidate_dirty;
+  CString      commit;
+  /* async state */
+  bool         pending;
+  bool         ready;  /* on cim_async_ready, guarded by cim_async_mutex */
+  CimIc*       next_ready;
+  CimEvent     pending_event;
+  int          pending_n;  /* queued events it stands for, 0 if none */
+  int          repeats_left; /* see cim_ic_set_repeats_used() */
+  bool         completing; /* in cim_ic_complete() */
+  bool         freed;      /* by event_done, see cim_ic_complete() */
+  CimEvent*    queue;
+  int          queue_head;
+  int          queue_len;
+  int          queue_capa;
+  bool         prefetch;       /* waiting for cim_dispatch() */
+  bool         interest_changed; /* likewise, set from any thread */
+  int          prefetch_index;
+  int          prefetch_len;
+  int          prefetched_index; /* since the list last changed */
+  int          prefetched_len;
+  CimCandidateArena candidates;
+  /* see cim_ic_get_arena() */
+  CArena       arena;
+  max_align_t  arena_seed[64];
+};
+
+static CimEngine cim_fallback_engine = {
+  .fd      = -1,
+  .ic_new  = cim_fallback_ic_new,
+  .ic_free = cim_fallback_ic_free
+};
+
+static CimEngine*      cim_engine; /* the current generation */
+static pthread_mutex_t cim_engine_mutex = PTHREAD_MUTEX_INITIALIZER;
+static int             cim_engine_watch = -1;
+static pthread_mutex_t cim_preload_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_t       cim_preload_thread;
+static bool            cim_preload_running;
+static pthread_mutex_t cim_async_mutex = PTHREAD_MUTEX_INITIALIZER;
+static int             cim_async_fd  = -1; /* read end */
+static int             cim_async_wfd = -1; /* write end */
+static CimIc*          cim_async_ready;
 
 /*
  * Returns the newly allocated cim.so path string on success,
@@ -52,128 +191,2397 @@ char* cim_get_cim_so_path ()
   return path;
 }
 
+static void cim_ic_nop (CimIc* ic)
+{
+}
+
+static bool cim_ic_filter_event_nop (CimIc* ic, const CimEvent* event)
+{
+  return false;
+}
+
+static void cim_ic_set_cursor_pos_nop (CimIc* ic, const CimRect* area)
+{
+}
+
+static const CimPreedit* cim_ic_get_preedit_nop (CimIc* ic)
+{
+  static const CimPreedit preedit = { "", NULL, 0, 0 };
+  return &preedit;
+}
+
+static const CimCandidate* cim_ic_get_candidate_nop (CimIc* ic)
+{
+  static const CimCandidate candidate;
+  return &candidate;
+}
+
+static void cim_ic_set_callbacks_nop (CimIc*              ic,
+                                      const CimCallbacks* callbacks,
+                                      void*               user_data)
+{
+}
+
+static int cim_ic_filter_events_loop (CimIc*          ic,
+                                      const CimEvent* events,
+                                      int             n_events,
+                                      bool*           handled)
+{
+  for (int i = 0; i < n_events; i++)
+  {
+    handled[i] = ic->ops->filter_event (ic, &events[i]);
+
+    /* events is the batch of cim_ic_filter_events() */
+    if (!handled[i] || ic->priv->batch_left[i])
+      return i + 1;
+  }
+
+  return n_events;
+}
+
+static CimFilterResult cim_ic_filter_event_async_sync (CimIc*          ic,
+                                                       const CimEvent* event,
+                                                       void (*wakeup) (CimIc*))
+{
+  if (ic->ops->filter_event (ic, event))
+    return CIM_FILTER_HANDLED;
+
+  return CIM_FILTER_NOT_HANDLED;
+}
+
+static bool cim_ic_filter_event_finish_nop (CimIc* ic)
+{
+  return false;
+}
+
+/* Engines without a candidate provider are served their current page. */
+static int cim_ic_get_n_candidates_page (CimIc* ic, bool* exact)
+{
+  const CimCandidate* candidate = ic->ops->get_candidate (ic);
+
+  *exact = candidate->n_pages <= 1;
+
+  if (!candidate->table)
+    return 0;
+
+  return candidate->n_rows * candidate->n_cols * C_MAX (candidate->n_pages, 1);
+}
+
+static int cim_ic_get_candidates_page (CimIc*   ic,
+                                       int      index,
+                                       int      n_items,
+                                       CimItem* items)
+{
+  const CimCandidate* candidate = ic->ops->get_candidate (ic);
+  int                 page_len;
+  int                 first;
+  int                 n;
+
+  if (!candidate->table)
+    return 0;
+
+  page_len = candidate->n_rows * candidate->n_cols;
+  first    = candidate->page_index * page_len;
+
+  if (index < first)
+    return 0;
+
+  for (n = 0; n < n_items && index + n < first + page_len; n++)
+  {
+    const CimItem* item = candidate->table[index + n - first];
+
+    if (item)
+      items[n] = *item;
+    else
+      items[n] = (CimItem) { CIM_ITEM_STRING, "" };
+  }
+
+  return n;
+}
+
+static void cim_ic_prefetch_candidates_nop (CimIc* ic, int index, int n_items)
+{
+}
+
+static void cim_ic_set_content_type_nop (CimIc*     ic,
+                                         CimPurpose purpose,
+                                         uint32_t   hints)
+{
+}
+
+/* the oldest engine ABI whose types this libcim still shares */
+#define CIM_ABI_VERSION_MIN 2
+
 /*
- * Returns a newly allocated CimIc.
+ * Returns false if the engine cannot be used with this libcim.
  */
-CimIc* cim_ic_new ()
+static bool cim_ops_is_valid (const CimIcOps* ops)
+{
+  if (ops && ops->abi_version < CIM_ABI_VERSION_MIN)
+  {
+    c_log_warning ("The engine was built for ABI version %u, "
+                   "but libcim needs %d or later", ops->abi_version,
+                   CIM_ABI_VERSION_MIN);
+    return false;
+  }
+
+  return ops && ops->size >= offsetof (CimIcOps, focus_in);
+}
+
+/*
+ * Copies the part of the engine's table that this libcim knows about and
+ * fills the gaps, so that callers can dispatch without NULL checks.
+ */
+static void cim_engine_set_ops (CimEngine* engine, const CimIcOps* ops)
+{
+  memset (&engine->ops, 0, sizeof (CimIcOps));
+  memcpy (&engine->ops, ops, C_MIN (ops->size, sizeof (CimIcOps)));
+
+  engine->ops.size = sizeof (CimIcOps);
+
+  if (!engine->ops.focus_in)
+    engine->ops.focus_in = cim_ic_nop;
+  if (!engine->ops.focus_out)
+    engine->ops.focus_out = cim_ic_nop;
+  if (!engine->ops.reset)
+    engine->ops.reset = cim_ic_nop;
+  if (!engine->ops.filter_event)
+    engine->ops.filter_event = cim_ic_filter_event_nop;
+  if (!engine->ops.set_cursor_pos)
+    engine->ops.set_cursor_pos = cim_ic_set_cursor_pos_nop;
+  if (!engine->ops.get_preedit)
+    engine->ops.get_preedit = cim_ic_get_preedit_nop;
+  if (!engine->ops.get_candidate)
+    engine->ops.get_candidate = cim_ic_get_candidate_nop;
+  if (!engine->ops.set_callbacks)
+    engine->ops.set_callbacks = cim_ic_set_callbacks_nop;
+  if (!engine->ops.filter_events)
+    engine->ops.filter_events = cim_ic_filter_events_loop;
+  if (!engine->ops.filter_event_async || !engine->ops.filter_event_finish)
+  {
+    engine->ops.filter_event_async  = cim_ic_filter_event_async_sync;
+    engine->ops.filter_event_finish = cim_ic_filter_event_finish_nop;
+  }
+  if (!engine->ops.get_n_candidates || !engine->ops.get_candidates)
+  {
+    engine->ops.get_n_candidates = cim_ic_get_n_candidates_page;
+    engine->ops.get_candidates   = cim_ic_get_candidates_page;
+  }
+  if (!engine->ops.prefetch_candidates)
+    engine->ops.prefetch_candidates = cim_ic_prefetch_candidates_nop;
+  if (!engine->ops.set_content_type)
+    engine->ops.set_content_type = cim_ic_set_content_type_nop;
+}
+
+/*
+ * Returns a new generation with a reference count of 1, or NULL on failure.
+ *
+ * On Linux the file is opened first and loaded through /proc/self/fd, so
+ * a replaced cim.so is not mistaken for the already loaded one by its path.
+ * The fd stays open with the generation to keep that name unique.
+ */
+static CimEngine* cim_engine_load ()
 {
-  cim_ref_count++;
+  CimEngine*        engine;
+  void*             handle;
+  int               fd   = -1;
+  char*             path = cim_get_cim_so_path ();
+  const CimIcOps*   ops  = NULL;
+  const CimIcOps* (*query) (uint32_t abi_version);
+
+  if (!path)
+    return NULL;
 
-  if (cim_ref_count == 1)
+#ifdef __linux__
+  fd = open (path, O_RDONLY | O_CLOEXEC);
+
+  if (fd >= 0)
+  {
+    char* name = c_str_sprintf ("/proc/self/fd/%d", fd);
+    handle = dlopen (name, RTLD_LAZY | RTLD_LOCAL);
+    free (name);
+  }
+  else
+  {
+    handle = NULL;
+  }
+#else
+  handle = dlopen (path, RTLD_LAZY | RTLD_LOCAL);
+#endif
+
+  free (path);
+
+  if (!handle)
   {
-    char* path = cim_get_cim_so_path ();
+    if (fd >= 0)
+      close (fd);
 
-    if (!path)
-      goto fail;
+    return NULL;
+  }
 
-    cim_plugin = dlopen (path, RTLD_LAZY | RTLD_LOCAL);
-    free (path);
+  engine = c_calloc (1, sizeof (CimEngine));
+  engine->handle  = handle;
+  engine->fd      = fd;
+  engine->ic_new  = dlsym (handle, "cim_plugin_new");
+  engine->ic_free = dlsym (handle, "cim_plugin_free");
+  atomic_init (&engine->ref_count, 1);
 
-    if (!cim_plugin)
-      goto fail;
+  if ((query = dlsym (handle, "cim_plugin_query")))
+    ops = query (CIM_ABI_VERSION);
 
-    cim_plugin_new  = dlsym (cim_plugin, "cim_plugin_new");
-    cim_plugin_free = dlsym (cim_plugin, "cim_plugin_free");
+  if (cim_ops_is_valid (ops))
+    cim_engine_set_ops (engine, ops);
+  else
+    ops = NULL;
 
-    if (!cim_plugin_new || !cim_plugin_free)
-    {
-      dlclose (cim_plugin);
-      cim_plugin      = NULL;
-      cim_plugin_new  = NULL;
-      cim_plugin_free = NULL;
+  if (!ops || !engine->ic_new || !engine->ic_free)
+  {
+    dlclose (handle);
 
-      goto fail;
-    }
+    if (fd >= 0)
+      close (fd);
+
+    free (engine);
+
+    return NULL;
   }
 
-  if (cim_plugin_new && cim_plugin_free)
-    return cim_plugin_new ();
+  return engine;
+}
 
-  fail:
 /*
- * TODO: Fallback
- * Cannot open "/home/username/.config/cim.so"
+ * Returns a new generation connected to cim-server, or NULL if no server
+ * is running.
  */
-  return c_calloc (1, sizeof (CimIc));
+static CimEngine* cim_engine_connect ()
+{
+  CimEngine* engine;
+  CimClient* client;
+
+  if (!(client = cim_client_new ()))
+    return NULL;
+
+  engine = c_calloc (1, sizeof (CimEngine));
+  engine->fd      = -1;
+  engine->client  = client;
+  engine->ic_free = cim_client_ic_free;
+  atomic_init (&engine->ref_count, 1);
+  cim_engine_set_ops (engine, cim_client_query (client));
+
+  return engine;
 }
 
-void cim_ic_free (CimIc* ic)
+static void cim_engine_ref (CimEngine* engine)
 {
-  cim_ref_count--;
+  if (engine != &cim_fallback_engine)
+    atomic_fetch_add_explicit (&engine->ref_count, 1, memory_order_relaxed);
+}
 
-  if (cim_plugin_free)
-    cim_plugin_free (ic);
-  else
-    free (ic);
+static void cim_engine_unref (CimEngine* engine)
+{
+  if (engine == &cim_fallback_engine)
+    return;
 
-  if (cim_ref_count == 0)
+  if (atomic_fetch_sub_explicit (&engine->ref_count, 1,
+                                 memory_order_acq_rel) == 1)
   {
-    if (cim_plugin)
-      dlclose (cim_plugin);
+    if (engine->handle)
+      dlclose (engine->handle);
+
+    if (engine->client)
+      cim_client_free (engine->client);
 
-    cim_plugin      = NULL;
-    cim_plugin_new  = NULL;
-    cim_plugin_free = NULL;
+    if (engine->fd >= 0)
+      close (engine->fd);
+
+    free (engine);
   }
 }
 
-void cim_ic_focus_in (CimIc* ic)
+/*
+ * Watches the config directory for cim.so being created or replaced.  The
+ * watch is set up before the first dlopen() so that a file created in
+ * between is not missed.
+ */
+static void cim_engine_watch_start ()
 {
-  if (ic->focus_in)
-    ic->focus_in (ic);
+#ifdef __linux__
+  char* conf_dir;
+
+  if (cim_engine_watch >= 0 || !(conf_dir = c_get_user_config_dir ()))
+    return;
+
+  cim_engine_watch = inotify_init1 (IN_NONBLOCK | IN_CLOEXEC);
+
+  if (cim_engine_watch >= 0 &&
+      inotify_add_watch (cim_engine_watch, conf_dir,
+                         IN_CREATE | IN_CLOSE_WRITE | IN_MOVED_TO) < 0)
+  {
+    close (cim_engine_watch);
+    cim_engine_watch = -1;
+  }
+
+  free (conf_dir);
+#endif
 }
 
-void cim_ic_focus_out (CimIc* ic)
+static void cim_engine_watch_stop ()
 {
-  if (ic->focus_out)
-    ic->focus_out (ic);
+  if (cim_engine_watch >= 0)
+  {
+    close (cim_engine_watch);
+    cim_engine_watch = -1;
+  }
 }
 
-void cim_ic_reset (CimIc* ic)
+/*
+ * Returns true if cim.so has been created or replaced since the last call.
+ * This is a single read() on a non-blocking fd.
+ */
+static bool cim_engine_watch_changed ()
 {
-  if (ic->reset)
-    ic->reset (ic);
+  bool changed = false;
+
+#ifdef __linux__
+  char buf[4096]
+    __attribute__ ((aligned (__alignof__ (struct inotify_event))));
+  ssize_t len;
+
+  if (cim_engine_watch < 0)
+    return false;
+
+  while ((len = read (cim_engine_watch, buf, sizeof buf)) > 0)
+  {
+    const struct inotify_event* event;
+
+    for (char* p = buf; p < buf + len; p += sizeof (*event) + event->len)
+    {
+      event = (const struct inotify_event*) p;
+
+      if (event->len && !strcmp (event->name, "cim.so"))
+        changed = true;
+    }
+  }
+#endif
+
+  return changed;
 }
 
-bool cim_ic_filter_event (CimIc* ic, const CimEvent* event)
+/*
+ * Connects to cim-server or loads cim.so on the first call and swaps in a
+ * new generation whenever the watch reports a change.  A failed load keeps
+ * the current generation, so a missing engine is only looked up again
+ * after cim.so has been created, and a half-written file is retried on its
+ * next change.  If the server goes away, cim.so is loaded locally.
+ * Must be called with cim_engine_mutex held.
+ */
+static void cim_engine_update_locked ()
 {
-  if (ic->filter_event)
-    return ic->filter_event (ic, event);
+  CimEngine* engine;
 
-  return false;
+  if (cim_engine && cim_engine->client &&
+      cim_client_is_dead (cim_engine->client))
+  {
+    cim_engine_unref (cim_engine);
+    cim_engine = NULL;
+  }
+
+  if (!cim_engine)
+  {
+    if (!(engine = cim_engine_connect ()))
+    {
+      cim_engine_watch_start ();
+      engine = cim_engine_load ();
+    }
+
+    if (!engine)
+    {
+      engine = &cim_fallback_engine;
+
+      if (!engine->ops.size)
+        cim_engine_set_ops (engine, cim_fallback_query (CIM_ABI_VERSION));
+    }
+
+    cim_engine = engine;
+  }
+  else if (cim_engine_watch_changed () && (engine = cim_engine_load ()))
+  {
+    cim_engine_unref (cim_engine);
+    cim_engine = engine;
+  }
 }
 
-void cim_ic_set_cursor_pos (CimIc* ic, const CimRect* area)
+/*
+ * Returns a reference to the current generation.
+ */
+static CimEngine* cim_engine_get ()
 {
-  if (ic->set_cursor_pos)
-    ic->set_cursor_pos (ic, area);
+  CimEngine* engine;
+
+  pthread_mutex_lock (&cim_engine_mutex);
+
+  cim_engine_update_locked ();
+  engine = cim_engine;
+  cim_engine_ref (engine);
+
+  pthread_mutex_unlock (&cim_engine_mutex);
+
+  return engine;
 }
 
-const CimPreedit* cim_ic_get_preedit (CimIc* ic)
+static void* cim_preload_thread_func (void* unused)
 {
-  if (ic->get_preedit)
-    return ic->get_preedit (ic);
+  pthread_mutex_lock (&cim_engine_mutex);
+  cim_engine_update_locked ();
+  pthread_mutex_unlock (&cim_engine_mutex);
 
-  static const CimPreedit preedit = { "", NULL, 0, 0 };
-  return &preedit;
+  return NULL;
 }
 
-const CimCandidate* cim_ic_get_candidate (CimIc* ic)
+/*
+ * Starts loading the engine in a background thread, so that the first
+ * cim_ic_new() does not block on dlopen().  Toolkit modules call it when
+ * they are loaded.  Calling it more than once is harmless.
+ */
+void cim_preload ()
 {
-  if (ic->get_candidate)
-    return ic->get_candidate (ic);
+  pthread_mutex_lock (&cim_preload_mutex);
 
-  static const CimCandidate candidate;
-  return &candidate;
+  if (!cim_preload_running &&
+      !pthread_create (&cim_preload_thread, NULL, cim_preload_thread_func,
+                       NULL))
+    cim_preload_running = true;
+
+  pthread_mutex_unlock (&cim_preload_mutex);
 }
 
-void cim_ic_set_callback (CimIc*    ic,
-                          CimCbType type,
-                          void*     callback,
-                          void*     user_data)
+/*
+ * Waits for the preload thread and drops the current generation.  ICs
+ * that are still alive keep theirs.  Call it before unloading the module
+ * that links libcim.
+ */
+void cim_finalize ()
+{
+  pthread_mutex_lock (&cim_preload_mutex);
+
+  if (cim_preload_running)
+  {
+    pthread_join (cim_preload_thread, NULL);
+    cim_preload_running = false;
+  }
+
+  pthread_mutex_unlock (&cim_preload_mutex);
+
+  pthread_mutex_lock (&cim_engine_mutex);
+
+  if (cim_engine)
+  {
+    cim_engine_unref (cim_engine);
+    cim_engine = NULL;
+  }
+
+  cim_engine_watch_stop ();
+
+  pthread_mutex_unlock (&cim_engine_mutex);
+
+  pthread_mutex_lock (&cim_async_mutex);
+
+  if (cim_async_fd >= 0)
+  {
+    if (cim_async_wfd != cim_async_fd)
+      close (cim_async_wfd);
+
+    close (cim_async_fd);
+    cim_async_fd  = -1;
+    cim_async_wfd = -1;
+  }
+
+  pthread_mutex_unlock (&cim_async_mutex);
+}
+
+/*
+ * Returns the fd that becomes readable when an asynchronous event has been
+ * answered, or -1 on failure.  There is one per process.  Toolkit modules
+ * watch it in their main loop and call cim_dispatch() when it is readable.
+ */
+int cim_get_async_fd ()
+{
+  int fd;
+
+  pthread_mutex_lock (&cim_async_mutex);
+
+  if (cim_async_fd < 0)
+  {
+#ifdef __linux__
+    cim_async_fd  = eventfd (0, EFD_NONBLOCK | EFD_CLOEXEC);
+    cim_async_wfd = cim_async_fd;
+#else
+    int fds[2];
+
+    if (!pipe (fds))
+    {
+      for (int i = 0; i < 2; i++)
+      {
+        fcntl (fds[i], F_SETFL, O_NONBLOCK);
+        fcntl (fds[i], F_SETFD, FD_CLOEXEC);
+      }
+
+      cim_async_fd  = fds[0];
+      cim_async_wfd = fds[1];
+    }
+#endif
+  }
+
+  fd = cim_async_fd;
+
+  pthread_mutex_unlock (&cim_async_mutex);
+
+  return fd;
+}
+
+/* Maps a character index of the old preedit text into the new one. */
+static int cim_delta_map (const CimPreeditDelta* delta, int index)
+{
+  if (index <= delta->start)
+    return index;
+
+  if (index >= delta->start + delta->n_deleted)
+    return index - delta->n_deleted + delta->n_inserted;
+
+  return delta->start + delta->n_inserted;
+}
+
+static bool cim_attrs_contain (const CimPreeditAttr* attrs,
+                               int                   attrs_len,
+                               CimPreeditAttrType    type,
+                               int                   start_index,
+                               int                   end_index)
+{
+  for (int i = 0; i < attrs_len; i++)
+    if (attrs[i].type        == type        &&
+        attrs[i].start_index == start_index &&
+        attrs[i].end_index   == end_index)
+      return true;
+
+  return false;
+}
+
+static void cim_delta_add_span (CimPreeditDelta* delta,
+                                bool*            any,
+                                int              start,
+                                int              end)
 {
-  if (ic->set_callback)
-    ic->set_callback (ic, type, callback, user_data);
+  if (start >= end)
+    return;
+
+  if (*any)
+  {
+    delta->attr_start = C_MIN (delta->attr_start, start);
+    delta->attr_end   = C_MAX (delta->attr_end,   end);
+  }
   else
-    c_log_critical ("set_callback() must be implemented in the IM plugin.");
+  {
+    delta->attr_start = start;
+    delta->attr_end   = end;
+    *any = true;
+  }
+}
+
+/*
+ * Compares the preedit with the one the toolkit has seen: common prefix
+ * and suffix of the text, then the attributes that are not just shifted
+ * by the edit.  Remembers the new preedit for the next time.
+ */
+static void cim_ic_preedit_delta (CimIcPrivate*     priv,
+                                  const CimPreedit* preedit,
+                                  CimPreeditDelta*  delta)
+{
+  const char* old_text = priv->last_text ? priv->last_text : "";
+  const char* new_text = preedit->text   ? preedit->text   : "";
+  size_t      old_len  = strlen (old_text);
+  size_t      new_len  = strlen (new_text);
+  size_t      prefix   = 0;
+  size_t      suffix   = 0;
+  bool        any;
+
+  while (prefix < old_len && prefix < new_len &&
+         old_text[prefix] == new_text[prefix])
+    prefix++;
+
+  /* back to a character boundary */
+  while (prefix > 0 && ((old_text[prefix] & 0xc0) == 0x80 ||
+                        (new_text[prefix] & 0xc0) == 0x80))
+    prefix--;
+
+  while (suffix < old_len - prefix && suffix < new_len - prefix &&
+         old_text[old_len - suffix - 1] == new_text[new_len - suffix - 1])
+    suffix++;
+
+  while (suffix > 0 && (new_text[new_len - suffix] & 0xc0) == 0x80)
+    suffix--;
+
+  delta->start        = c_utf8_strnlen (new_text, prefix);
+  delta->n_deleted    = c_utf8_strnlen (old_text + prefix,
+                                        old_len - suffix - prefix);
+  delta->inserted     = new_text + prefix;
+  delta->inserted_len = new_len - suffix - prefix;
+  delta->n_inserted   = c_utf8_strnlen (delta->inserted, delta->inserted_len);
+  delta->attr_start   = delta->start;
+  delta->attr_end     = delta->start;
+
+  any = false;
+  cim_delta_add_span (delta, &any, delta->start,
+                      delta->start + delta->n_inserted);
+
+  for (int i = 0; i < preedit->attrs_len; i++)
+  {
+    const CimPreeditAttr* attr = &preedit->attrs[i];
+    bool found = false;
+
+    for (int j = 0; j < priv->last_attrs_len && !found; j++)
+      found = priv->last_attrs[j].type == attr->type &&
+              cim_delta_map (delta, priv->last_attrs[j].start_index) ==
+                attr->start_index &&
+              cim_delta_map (delta, priv->last_attrs[j].end_index) ==
+                attr->end_index;
+
+    if (!found)
+      cim_delta_add_span (delta, &any, attr->start_index, attr->end_index);
+  }
+
+  for (int i = 0; i < priv->last_attrs_len; i++)
+  {
+    const CimPreeditAttr* attr  = &priv->last_attrs[i];
+    int                   start = cim_delta_map (delta, attr->start_index);
+    int                   end   = cim_delta_map (delta, attr->end_index);
+
+    if (!cim_attrs_contain (preedit->attrs, preedit->attrs_len,
+                            attr->type, start, end))
+      cim_delta_add_span (delta, &any, start, end);
+  }
+
+  c_arena_reset (&priv->last_arena);
+
+  priv->last_text      = c_arena_strndup (&priv->last_arena,
+                                          new_text, new_len);
+  priv->last_attrs     = c_arena_memdup (&priv->last_arena, preedit->attrs,
+                                         preedit->attrs_len *
+                                         sizeof (CimPreeditAttr));
+  priv->last_attrs_len = preedit->attrs_len;
+}
+
+/*
+ * Every preedit change goes through here and gets a new generation.
+ * Toolkits that registered preedit_delta get only what changed.
+ */
+static void cim_ic_emit_preedit (CimIc* ic, const CimPreedit* preedit)
+{
+  CimIcPrivate* priv = ic->priv;
+
+  priv->preedit_generation++;
+
+  if (priv->callbacks.preedit_delta)
+  {
+    CimPreeditDelta delta;
+
+    cim_ic_preedit_delta (priv, preedit, &delta);
+    delta.generation = priv->preedit_generation;
+    delta.preedit    = preedit;
+
+    priv->callbacks.preedit_delta (ic, &delta,
+                                   priv->user_data[CIM_CB_PREEDIT_DELTA]);
+  }
+  else if (priv->callbacks.preedit_changed)
+  {
+    priv->callbacks.preedit_changed (ic, preedit,
+                                     priv->user_data[CIM_CB_PREEDIT_CHANGED]);
+  }
+}
+
+/*
+ * Counts the characters and UTF-16 code units of text->text in one pass,
+ * recording where each character starts if offsets are given.
+ */
+static void cim_text_measure (CimText* text,
+                              int*     byte_offsets,
+                              int*     utf16_offsets)
+{
+  const uint8_t* p       = (const uint8_t*) text->text;
+  int            n_chars = 0;
+  int            n_utf16 = 0;
+  int            i       = 0;
+
+  text->byte_offsets  = byte_offsets;
+  text->utf16_offsets = utf16_offsets;
+
+  if (!byte_offsets)
+  {
+    size_t n_units;
+
+    text->n_chars = c_utf8_count (text->text, text->len, &n_units);
+    text->n_utf16 = n_units;
+
+    return;
+  }
+
+  while (i < text->len)
+  {
+    byte_offsets[n_chars]  = i;
+    utf16_offsets[n_chars] = n_utf16;
+
+    if (p[i] < 0xe0)
+      i += p[i] < 0x80 ? 1 : 2;
+    else if (p[i] < 0xf0)
+      i += 3;
+    else
+    {
+      i += 4;
+      n_utf16++; /* a surrogate pair */
+    }
+
+    n_chars++;
+    n_utf16++;
+  }
+
+  byte_offsets[n_chars]  = text->len;
+  utf16_offsets[n_chars] = n_utf16;
+
+  text->n_chars = n_chars;
+  text->n_utf16 = n_utf16;
+}
+
+static void cim_ic_surround_invalidate (CimIcPrivate* priv)
+{
+  if (priv->surround_valid)
+  {
+    priv->surround_valid = false;
+    priv->surround_generation++;
+  }
+}
+
+/* Catches up with the keys the inline cim_ic_filter_event() let through. */
+static void cim_ic_surround_check (CimIcPrivate* priv)
+{
+  if (priv->shared.surround_stale)
+  {
+    priv->shared.surround_stale = false;
+    cim_ic_surround_invalidate (priv);
+  }
+}
+
+static void cim_ic_surround_reserve (CimIcPrivate* priv, size_t size)
+{
+  if (size > priv->surround_capa)
+  {
+    priv->surround_capa = C_MAX (size, 2 * priv->surround_capa);
+    priv->surround_buf  = c_realloc (priv->surround_buf, priv->surround_capa);
+    priv->surround.text = priv->surround_buf;
+  }
+}
+
+/*
+ * Returns the byte index of the n_chars-th character of text, or of its
+ * end if it is shorter.  len may be -1 for NUL-terminated text.
+ */
+static int cim_utf8_index (const char* text, int len, int n_chars)
+{
+  int i = 0;
+
+  for (; n_chars > 0 && (len < 0 ? text[i] != 0 : i < len); n_chars--)
+  {
+    i++;
+
+    while ((len < 0 || i < len) && (text[i] & 0xc0) == 0x80)
+      i++;
+  }
+
+  return i;
+}
+
+/*
+ * Copies at most CIM_SURROUND_WINDOW characters on each side of the
+ * cursor, so the cost does not depend on the size of the document.
+ * Indices are in bytes; len may be -1 for NUL-terminated text.
+ */
+static void cim_ic_surround_store (CimIcPrivate* priv,
+                                   const char*   text,
+                                   int           len,
+                                   int           cursor_index,
+                                   int           anchor_index)
+{
+  const char* cursor;
+  const char* anchor;
+  const char* start;
+  int         before = 0;
+  int         size;
+
+  if (len < 0)
+    len = strlen (text);
+
+  cursor_index = C_MIN (C_MAX (cursor_index, 0), len);
+  anchor_index = C_MIN (C_MAX (anchor_index, 0), len);
+
+  cursor = start = text + cursor_index;
+
+  while (before < CIM_SURROUND_WINDOW && start > text)
+  {
+    do
+      start--;
+    while (start > text && (*start & 0xc0) == 0x80);
+
+    before++;
+  }
+
+  size = cursor - start +
+         cim_utf8_index (cursor, len - cursor_index, CIM_SURROUND_WINDOW);
+  anchor = C_MIN (C_MAX (text + anchor_index, start), start + size);
+
+  cim_ic_surround_reserve (priv, size + 1);
+  memcpy (priv->surround_buf, start, size);
+  priv->surround_buf[size] = 0;
+
+  priv->surround.text       = priv->surround_buf;
+  priv->surround.len        = size;
+  priv->surround.cursor_pos = before;
+  priv->surround.anchor_pos = c_utf8_strnlen (start, anchor - start);
+  priv->surround_cursor     = cursor - start;
+  priv->surround_anchor     = anchor - start;
+  priv->surround_valid      = true;
+  priv->surround_generation++;
+
+  priv->shared.surround_stale = false;
+}
+
+/* Removes bytes [start, end) of the window, which hold n_chars characters. */
+static void cim_ic_surround_cut (CimIcPrivate* priv,
+                                 int           start,
+                                 int           end,
+                                 int           n_chars)
+{
+  memmove (priv->surround_buf + start, priv->surround_buf + end,
+           priv->surround.len - end + 1);
+  priv->surround.len -= end - start;
+
+  if (priv->surround_cursor >= end)
+  {
+    priv->surround_cursor     -= end - start;
+    priv->surround.cursor_pos -= n_chars;
+  }
+  else if (priv->surround_cursor > start)
+  {
+    priv->surround_cursor     = start;
+    priv->surround.cursor_pos = c_utf8_strnlen (priv->surround_buf, start);
+  }
+
+  priv->surround_anchor     = priv->surround_cursor;
+  priv->surround.anchor_pos = priv->surround.cursor_pos;
+}
+
+/* A commit replaces the selection and leaves the cursor after the text. */
+static void cim_ic_surround_commit (CimIcPrivate* priv,
+                                    const char*   text,
+                                    int           len)
+{
+  int n_chars;
+
+  cim_ic_surround_check (priv);
+
+  if (!priv->surround_valid)
+    return;
+
+  if (priv->surround_anchor != priv->surround_cursor)
+  {
+    int start = C_MIN (priv->surround_anchor, priv->surround_cursor);
+    int end   = C_MAX (priv->surround_anchor, priv->surround_cursor);
+
+    cim_ic_surround_cut (priv, start, end,
+                         c_utf8_strnlen (priv->surround_buf + start,
+                                         end - start));
+  }
+
+  n_chars = c_utf8_strnlen (text, len);
+  cim_ic_surround_reserve (priv, priv->surround.len + len + 1);
+  memmove (priv->surround_buf + priv->surround_cursor + len,
+           priv->surround_buf + priv->surround_cursor,
+           priv->surround.len - priv->surround_cursor + 1);
+  memcpy (priv->surround_buf + priv->surround_cursor, text, len);
+
+  priv->surround.len        += len;
+  priv->surround_cursor     += len;
+  priv->surround.cursor_pos += n_chars;
+  priv->surround_anchor      = priv->surround_cursor;
+  priv->surround.anchor_pos  = priv->surround.cursor_pos;
+  priv->surround_generation++;
+
+  /* keep the window bounded while typing goes on */
+  if (priv->surround.cursor_pos > 2 * CIM_SURROUND_WINDOW)
+  {
+    int n_drop = priv->surround.cursor_pos - CIM_SURROUND_WINDOW;
+
+    cim_ic_surround_cut (priv, 0, cim_utf8_index (priv->surround_buf,
+                                                  priv->surround.len, n_drop),
+                         n_drop);
+  }
+}
+
+/* offset and n_chars as in delete_surround, relative to the cursor */
+static void cim_ic_surround_delete (CimIcPrivate* priv,
+                                    int           offset,
+                                    int           n_chars)
+{
+  int first = priv->surround.cursor_pos + offset;
+  int start;
+  int end;
+
+  cim_ic_surround_check (priv);
+
+  if (!priv->surround_valid)
+    return;
+
+  /* reaches outside the window; the copy cannot follow */
+  if (first < 0 || n_chars < 0)
+  {
+    cim_ic_surround_invalidate (priv);
+    return;
+  }
+
+  start = cim_utf8_index (priv->surround_buf, priv->surround.len, first);
+  end   = start + cim_utf8_index (priv->surround_buf + start,
+                                  priv->surround.len - start, n_chars);
+
+  if (c_utf8_strnlen (priv->surround_buf + start, end - start) < n_chars)
+  {
+    cim_ic_surround_invalidate (priv);
+    return;
+  }
+
+  cim_ic_surround_cut (priv, start, end, n_chars);
+  priv->surround_generation++;
+}
+
+static void cim_ic_emit_commit (CimIc* ic, const char* text, int len)
+{
+  CimIcPrivate* priv       = ic->priv;
+  uint64_t      generation = priv->surround_generation;
+
+  if (!priv->callbacks.commit)
+    return;
+
+  priv->commit_text = (CimText) { text, len, -1 };
+  priv->callbacks.commit (ic, text, priv->user_data[CIM_CB_COMMIT]);
+  priv->commit_text.text = NULL;
+
+  /* unless the toolkit has already told us the new text */
+  if (generation == priv->surround_generation)
+    cim_ic_surround_commit (priv, text, len < 0 ? strlen (text) : len);
+}
+
+/*
+ * Sends what a batch has recorded to the toolkit: the joined commit first,
+ * then the final preedit and candidate state.
+ */
+static void cim_ic_flush (CimIc* ic)
+{
+  CimIcPrivate* priv = ic->priv;
+
+  if (!priv->batching)
+    return;
+
+  priv->batching = false;
+
+  if (priv->commit.len)
+  {
+    cim_ic_emit_commit (ic, priv->commit.str, priv->commit.len);
+    c_string_assign (&priv->commit, "");
+  }
+
+  if (priv->engine_preedit_started && !priv->preedit_started)
+  {
+    priv->preedit_started = true;
+
+    if (priv->callbacks.preedit_start)
+      priv->callbacks.preedit_start (ic,
+                                     priv->user_data[CIM_CB_PREEDIT_START]);
+  }
+
+  if (priv->preedit_dirty)
+    cim_ic_emit_preedit (ic, ic->ops->get_preedit (ic));
+
+  if (!priv->engine_preedit_started && priv->preedit_started)
+  {
+    priv->preedit_started = false;
+
+    if (priv->callbacks.preedit_end)
+      priv->callbacks.preedit_end (ic, priv->user_data[CIM_CB_PREEDIT_END]);
+  }
+
+  if (priv->engine_candidate_started && !priv->candidate_started)
+  {
+    priv->candidate_started = true;
+
+    if (priv->callbacks.candidate_start)
+      priv->callbacks.candidate_start (ic,
+                                     priv->user_data[CIM_CB_CANDIDATE_START]);
+  }
+
+  if (priv->candidate_dirty && priv->callbacks.candidate_changed)
+    priv->callbacks.candidate_changed (ic, ic->ops->get_candidate (ic),
+                                   priv->user_data[CIM_CB_CANDIDATE_CHANGED]);
+
+  if (!priv->engine_candidate_started && priv->candidate_started)
+  {
+    priv->candidate_started = false;
+
+    if (priv->callbacks.candidate_end)
+      priv->callbacks.candidate_end (ic,
+                                     priv->user_data[CIM_CB_CANDIDATE_END]);
+  }
+
+  priv->preedit_dirty   = false;
+  priv->candidate_dirty = false;
+}
+
+/*
+ * The engine always reports to these, and they forward to whatever the
+ * toolkit has registered on the IC, or record it during a batch.
+ */
+static void cim_ic_preedit_start (CimIc* ic, void* unused)
+{
+  CimIcPrivate* priv = ic->priv;
+
+  if (priv->batching)
+  {
+    priv->engine_preedit_started = true;
+    return;
+  }
+
+  priv->preedit_started = true;
+
+  if (priv->callbacks.preedit_start)
+    priv->callbacks.preedit_start (ic, priv->user_data[CIM_CB_PREEDIT_START]);
+}
+
+static void cim_ic_preedit_end (CimIc* ic, void* unused)
+{
+  CimIcPrivate* priv = ic->priv;
+
+  if (priv->batching)
+  {
+    priv->engine_preedit_started = false;
+    return;
+  }
+
+  priv->preedit_started = false;
+
+  if (priv->callbacks.preedit_end)
+    priv->callbacks.preedit_end (ic, priv->user_data[CIM_CB_PREEDIT_END]);
+}
+
+static void cim_ic_preedit_changed (CimIc*            ic,
+                                    const CimPreedit* preedit,
+                                    void*             unused)
+{
+  CimIcPrivate* priv = ic->priv;
+
+  if (priv->batching)
+  {
+    priv->preedit_dirty = true;
+    return;
+  }
+
+  cim_ic_emit_preedit (ic, preedit);
+}
+
+static void cim_ic_commit (CimIc* ic, const char* text, void* unused)
+{
+  CimIcPrivate* priv = ic->priv;
+
+  if (priv->batching)
+  {
+    c_string_append (&priv->commit, text);
+    return;
+  }
+
+  cim_ic_emit_commit (ic, text, -1);
+}
+
+/* The toolkit's text has to be up to date before the engine looks at it. */
+static const CimSurround* cim_ic_get_surround (CimIc* ic, void* unused)
+{
+  CimIcPrivate* priv = ic->priv;
+
+  if (priv->batching)
+  {
+    cim_ic_flush (ic);
+    priv->batching = true;
+  }
+
+  cim_ic_surround_check (priv);
+
+  /* a toolkit that reports changes need not be asked again */
+  if (priv->surround_valid && priv->surround_tracked)
+    return &priv->surround;
+
+  if (priv->callbacks.get_surround)
+  {
+    const CimSurround* surround;
+    uint64_t           generation = priv->surround_generation;
+
+    surround = priv->callbacks.get_surround (ic,
+                                     priv->user_data[CIM_CB_GET_SURROUND]);
+
+    /* the toolkit called cim_ic_set_surround() */
+    if (priv->surround_valid && priv->surround_generation != generation)
+      return &priv->surround;
+
+    if (surround && surround->text)
+    {
+      cim_ic_surround_store (priv, surround->text, surround->len,
+                             cim_utf8_index (surround->text, surround->len,
+                                             surround->cursor_pos),
+                             cim_utf8_index (surround->text, surround->len,
+                                             surround->anchor_pos));
+      return &priv->surround;
+    }
+  }
+
+  return NULL;
+}
+
+static bool cim_ic_delete_surround (CimIc* ic,
+                                    int    offset,
+                                    int    n_chars,
+                                    void*  unused)
+{
+  CimIcPrivate* priv = ic->priv;
+  uint64_t      generation;
+
+  if (priv->batching)
+  {
+    cim_ic_flush (ic);
+    priv->batching = true;
+  }
+
+  generation = priv->surround_generation;
+
+  if (priv->callbacks.delete_surround &&
+      priv->callbacks.delete_surround (ic, offset, n_chars,
+                                       priv->user_data[CIM_CB_DELETE_SURROUND]))
+  {
+    if (generation == priv->surround_generation)
+      cim_ic_surround_delete (priv, offset, n_chars);
+
+    return true;
+  }
+
+  cim_ic_surround_invalidate (priv);
+
+  return false;
+}
+
+static void cim_ic_candidate_start (CimIc* ic, void* unused)
+{
+  CimIcPrivate* priv = ic->priv;
+
+  if (priv->batching)
+  {
+    priv->engine_candidate_started = true;
+    return;
+  }
+
+  priv->candidate_started = true;
+
+  if (priv->callbacks.candidate_start)
+    priv->callbacks.candidate_start (ic,
+                                     priv->user_data[CIM_CB_CANDIDATE_START]);
+}
+
+static void cim_ic_candidate_end (CimIc* ic, void* unused)
+{
+  CimIcPrivate* priv = ic->priv;
+
+  if (priv->batching)
+  {
+    priv->engine_candidate_started = false;
+    return;
+  }
+
+  priv->candidate_started = false;
+
+  if (priv->callbacks.candidate_end)
+    priv->callbacks.candidate_end (ic, priv->user_data[CIM_CB_CANDIDATE_END]);
+}
+
+static void cim_ic_candidate_changed (CimIc*              ic,
+                                      const CimCandidate* candidate,
+                                      void*               unused)
+{
+  CimIcPrivate* priv = ic->priv;
+
+  priv->prefetched_len = 0;
+
+  if (priv->batching)
+  {
+    priv->candidate_dirty = true;
+    return;
+  }
+
+  if (priv->callbacks.candidate_changed)
+    priv->callbacks.candidate_changed (ic, candidate,
+                                   priv->user_data[CIM_CB_CANDIDATE_CHANGED]);
+}
+
+/*
+ * Puts the IC on the ready list and wakes up the main loop.  The engine
+ * calls it from its own thread when a pending event has been answered.
+ */
+static void cim_ic_wakeup (CimIc* ic)
+{
+  uint64_t one = 1;
+
+  pthread_mutex_lock (&cim_async_mutex);
+
+  if (!ic->priv->ready)
+  {
+    ic->priv->ready      = true;
+    ic->priv->next_ready = cim_async_ready;
+    cim_async_ready      = ic;
+  }
+
+  if (cim_async_wfd >= 0 && write (cim_async_wfd, &one, sizeof one) < 0)
+    c_log_warning ("Failed to wake up the main loop");
+
+  pthread_mutex_unlock (&cim_async_mutex);
+}
+
+static void cim_ic_event_done (CimIc* ic, const CimEvent* event, bool handled)
+{
+  CimIcPrivate* priv = ic->priv;
+
+  if (priv->callbacks.event_done)
+    priv->callbacks.event_done (ic, event, handled,
+                                priv->user_data[CIM_CB_EVENT_DONE]);
+}
+
+/*
+ * Tells libcim that an engine with CIM_CAP_REPEAT applied only the first
+ * n_used of the auto-repeats merged into event, e.g. because its preedit
+ * ran out.  The rest are handed back to the toolkit as not handled.  Call
+ * it before returning the event as handled; filter_events() then stops
+ * after the event, as after one that is not handled.
+ */
+void cim_ic_set_repeats_used (CimIc* ic, const CimEvent* event, int n_used)
+{
+  CimIcPrivate* priv = ic->priv;
+  int           left;
+
+  left = event->n_repeats - C_MAX (0, C_MIN (n_used, event->n_repeats));
+
+  if (event >= priv->batch && event < priv->batch + priv->batch_len)
+    priv->batch_left[event - priv->batch] = left;
+  else
+    priv->repeats_left = left;
+}
+
+/* Returns the repeats the engine left of the last event, and forgets it. */
+int cim_ic_take_repeats_left (CimIc* ic)
+{
+  int left = ic->priv->repeats_left;
+
+  ic->priv->repeats_left = 0;
+
+  return left;
+}
+
+/*
+ * Whether one of the events a merged event stands for was handled: only
+ * the first n_taken presses are, along with the releases made up before
+ * them.  *n_presses counts the presses seen so far.
+ */
+static bool cim_event_split (const CimEvent* event,
+                             bool            handled,
+                             int             n_taken,
+                             int*            n_presses)
+{
+  int nth = *n_presses + 1;
+
+  if (event->type == CIM_EVENT_KEY_PRESS)
+    (*n_presses)++;
+
+  return handled && nth <= n_taken;
+}
+
+static CimFilterResult cim_ic_start_event (CimIc* ic, const CimEvent* event)
+{
+  CimFilterResult result = CIM_FILTER_NOT_HANDLED;
+
+  ic->priv->repeats_left = 0;
+
+  if (cim_ic_wants_event (ic, event))
+    result = ic->ops->filter_event_async (ic, event, cim_ic_wakeup);
+
+  if (result == CIM_FILTER_PENDING)
+  {
+    ic->priv->pending       = true;
+    ic->priv->pending_event = *event;
+    ic->priv->pending_n     = 0;
+  }
+  else if (result == CIM_FILTER_NOT_HANDLED &&
+           event->type == CIM_EVENT_KEY_PRESS)
+  {
+    /* the toolkit will apply the key to the text */
+    cim_ic_surround_invalidate (ic->priv);
+  }
+
+  return result;
+}
+
+static void cim_ic_queue_push (CimIc* ic, const CimEvent* event)
+{
+  CimIcPrivate* priv = ic->priv;
+
+  if (priv->queue_len == priv->queue_capa)
+  {
+    int       capa  = priv->queue_capa ? priv->queue_capa * 2 : 8;
+    CimEvent* queue = c_malloc (capa * sizeof (CimEvent));
+
+    for (int i = 0; i < priv->queue_len; i++)
+      queue[i] = priv->queue[(priv->queue_head + i) % priv->queue_capa];
+
+    free (priv->queue);
+    priv->queue      = queue;
+    priv->queue_capa = capa;
+    priv->queue_head = 0;
+  }
+
+  priv->queue[(priv->queue_head + priv->queue_len) % priv->queue_capa] = *event;
+  priv->queue_len++;
+}
+
+/*
+ * Whether next continues the auto-repeat run of event, so the two can be
+ * given to the engine as one.
+ */
+static bool cim_event_repeats (const CimEvent* event, const CimEvent* next)
+{
+  return event->type == CIM_EVENT_KEY_PRESS &&
+         next->type  == CIM_EVENT_KEY_PRESS &&
+         (event->flags & next->flags & CIM_EVENT_REPEAT) &&
+         event->keycode == next->keycode &&
+         event->keyval  == next->keyval  &&
+         event->state   == next->state   &&
+         event->n_repeats < UINT16_MAX;
+}
+
+/* a release the toolkit made up before an auto-repeat, as Qt does on X11 */
+static bool cim_event_is_made_up (const CimEvent* event, const CimEvent* next)
+{
+  return event->type == CIM_EVENT_KEY_RELEASE &&
+         next->type  == CIM_EVENT_KEY_PRESS   &&
+         (event->flags & next->flags & CIM_EVENT_REPEAT) &&
+         event->keycode == next->keycode &&
+         event->keyval  == next->keyval  &&
+         event->state   == next->state;
+}
+
+static const CimEvent* cim_ic_queue_nth (CimIcPrivate* priv, int i)
+{
+  return &priv->queue[(priv->queue_head + i) % priv->queue_capa];
+}
+
+/*
+ * Takes the event at the head of the queue, merged with the auto-repeats
+ * queued behind it for engines with CIM_CAP_REPEAT.  A made-up release
+ * goes with the repeat that follows it.  Returns the number of queued
+ * events it stands for; they stay queued until answered.
+ */
+static int cim_ic_queue_peek (CimIc* ic, CimEvent* event)
+{
+  CimIcPrivate* priv = ic->priv;
+  int           n    = 1;
+
+  *event = *cim_ic_queue_nth (priv, 0);
+
+  if (!(ic->ops->caps & CIM_CAP_REPEAT))
+    return 1;
+
+  if (n < priv->queue_len &&
+      cim_event_is_made_up (event, cim_ic_queue_nth (priv, n)))
+    *event = *cim_ic_queue_nth (priv, n++);
+
+  while (n < priv->queue_len)
+  {
+    const CimEvent* next = cim_ic_queue_nth (priv, n);
+    int             m    = n;
+
+    if (m + 1 < priv->queue_len &&
+        cim_event_is_made_up (next, cim_ic_queue_nth (priv, m + 1)))
+      next = cim_ic_queue_nth (priv, ++m);
+
+    if (!cim_event_repeats (event, next))
+      break;
+
+    event->n_repeats++;
+    event->time = next->time;
+    n = m + 1;
+  }
+
+  return n;
+}
+
+/*
+ * Answers the n queued events an engine answer stands for, or the event
+ * itself if it was not queued.  The repeats the engine did not use are
+ * answered as not handled.
+ */
+static void cim_ic_answer (CimIc*          ic,
+                           const CimEvent* event,
+                           int             n,
+                           bool            handled)
+{
+  CimIcPrivate* priv      = ic->priv;
+  int           n_taken   = 1 + event->n_repeats -
+                            cim_ic_take_repeats_left (ic);
+  int           n_presses = 0;
+
+  if (n == 0)
+  {
+    if (!handled && event->type == CIM_EVENT_KEY_PRESS)
+      cim_ic_surround_invalidate (priv);
+
+    cim_ic_event_done (ic, event, handled);
+  }
+
+  for (int i = 0; i < n && !priv->freed; i++)
+  {
+    CimEvent queued = priv->queue[priv->queue_head];
+    bool     done   = cim_event_split (&queued, handled, n_taken, &n_presses);
+
+    priv->queue_head = (priv->queue_head + 1) % priv->queue_capa;
+    priv->queue_len--;
+
+    /* the toolkit will apply the key to the text */
+    if (!done && queued.type == CIM_EVENT_KEY_PRESS)
+      cim_ic_surround_invalidate (priv);
+
+    cim_ic_event_done (ic, &queued, done);
+  }
+}
+
+/*
+ * Collects the answer for the pending event, then feeds the queued events
+ * to the engine until one of them is pending again.  The toolkit delivers
+ * unhandled keys from event_done, so the queued ones are only started
+ * after that.  If event_done frees the IC, it is freed here on return.
+ */
+static void cim_ic_complete (CimIc* ic)
+{
+  CimIcPrivate* priv = ic->priv;
+  CimEvent      event;
+  bool          handled;
+
+  if (!priv->pending)
+    return;
+
+  handled = ic->ops->filter_event_finish (ic);
+  priv->pending    = false;
+  priv->completing = true;
+
+  cim_ic_answer (ic, &priv->pending_event, priv->pending_n, handled);
+
+  while (!priv->freed && !priv->pending && priv->queue_len)
+  {
+    CimFilterResult result;
+    int             n = cim_ic_queue_peek (ic, &event);
+
+    result = cim_ic_start_event (ic, &event);
+
+    if (result == CIM_FILTER_PENDING)
+      priv->pending_n = n;
+    else
+      cim_ic_answer (ic, &event, n, result == CIM_FILTER_HANDLED);
+  }
+
+  priv->completing = false;
+
+  if (priv->freed)
+    cim_ic_free (ic);
+}
+
+/* a copy, since the engine may publish another one meanwhile */
+static void cim_ic_emit_interest (CimIc* ic)
+{
+  CimIcPrivate* priv = ic->priv;
+  CimInterest   interest;
+
+  if (!priv->callbacks.interest_changed)
+    return;
+
+  cim_ic_get_interest (ic, &interest);
+  priv->callbacks.interest_changed (ic, &interest,
+                                    priv->user_data[CIM_CB_INTEREST_CHANGED]);
+}
+
+/*
+ * Delivers the answers of completed asynchronous events through the
+ * event_done callback, and interest changes.  Call it on the toolkit
+ * thread when the fd from cim_get_async_fd() becomes readable.
+ */
+void cim_dispatch ()
+{
+  uint64_t buf;
+
+  pthread_mutex_lock (&cim_async_mutex);
+
+  if (cim_async_fd >= 0)
+    while (read (cim_async_fd, &buf, sizeof buf) > 0)
+      ;
+
+  pthread_mutex_unlock (&cim_async_mutex);
+
+  for (;;)
+  {
+    CimIc* ic;
+
+    pthread_mutex_lock (&cim_async_mutex);
+
+    if ((ic = cim_async_ready))
+    {
+      cim_async_ready      = ic->priv->next_ready;
+      ic->priv->ready      = false;
+      ic->priv->next_ready = NULL;
+    }
+
+    pthread_mutex_unlock (&cim_async_mutex);
+
+    if (!ic)
+      break;
+
+    if (ic->priv->prefetch)
+    {
+      ic->priv->prefetch         = false;
+      ic->priv->prefetched_index = ic->priv->prefetch_index;
+      ic->priv->prefetched_len   = ic->priv->prefetch_len;
+      ic->ops->prefetch_candidates (ic, ic->priv->prefetch_index,
+                                    ic->priv->prefetch_len);
+    }
+
+    if (__atomic_exchange_n (&ic->priv->interest_changed, false,
+                             __ATOMIC_RELAXED))
+      cim_ic_emit_interest (ic);
+
+    cim_ic_complete (ic);
+  }
+}
+
+static const CimCallbacks cim_ic_callbacks = {
+  .preedit_start     = cim_ic_preedit_start,
+  .preedit_end       = cim_ic_preedit_end,
+  .preedit_changed   = cim_ic_preedit_changed,
+  .commit            = cim_ic_commit,
+  .get_surround      = cim_ic_get_surround,
+  .delete_surround   = cim_ic_delete_surround,
+  .candidate_start   = cim_ic_candidate_start,
+  .candidate_end     = cim_ic_candidate_end,
+  .candidate_changed = cim_ic_candidate_changed
+};
+
+/*
+ * Returns a newly allocated CimIc on the current engine generation.
+ * If cim.so is not available, the IC is backed by the built-in engine.
+ */
+CimIc* cim_ic_new ()
+{
+  CimEngine* engine = cim_engine_get ();
+  CimIc*     ic;
+
+  if (engine->client)
+    ic = cim_client_ic_new (engine->client);
+  else
+    ic = engine->ic_new ();
+
+  ic->ops  = &engine->ops;
+  ic->priv = c_calloc (1, sizeof (CimIcPrivate));
+  ic->priv->engine = engine;
+  c_arena_init (&ic->priv->arena, ic->priv->arena_seed,
+                sizeof ic->priv->arena_seed);
+  c_arena_init (&ic->priv->last_arena, ic->priv->last_seed,
+                sizeof ic->priv->last_seed);
+  c_string_init (&ic->priv->commit);
+  ic->priv->shared.interest.flags = CIM_INTEREST_RELEASE;
+  ic->ops->set_callbacks (ic, &cim_ic_callbacks, ic);
+  cim_get_async_fd ();
+
+  return ic;
+}
+
+void cim_ic_free (CimIc* ic)
+{
+  CimIcPrivate* priv   = ic->priv;
+  CimEngine*    engine = priv->engine;
+
+  if (priv->completing)
+  {
+    priv->freed = true;
+    return;
+  }
+
+  /* The engine does not call wakeup after this. */
+  engine->ic_free (ic);
+  cim_engine_unref (engine);
+
+  pthread_mutex_lock (&cim_async_mutex);
+
+  if (priv->ready)
+  {
+    for (CimIc** p = &cim_async_ready; *p; p = &(*p)->priv->next_ready)
+    {
+      if (*p == ic)
+      {
+        *p = priv->next_ready;
+        break;
+      }
+    }
+  }
+
+  pthread_mutex_unlock (&cim_async_mutex);
+
+  c_string_fini (&priv->commit);
+  free (priv->queue);
+  free (priv->batch);
+  free (priv->batch_first);
+  free (priv->batch_handled);
+  free (priv->batch_left);
+  c_arena_clear (&priv->last_arena);
+  c_arena_clear (&priv->arena);
+  free (priv->text_offsets);
+  free (priv->runs);
+  free (priv->edges);
+  free (priv->surround_buf);
+  cim_candidate_arena_clear (&priv->candidates);
+  free (priv);
+}
+
+/*
+ * Returns false if cim.so has been replaced since the IC was created.
+ * Toolkit modules call it on focus-in and recreate the IC, so that
+ * long-lived text fields also move to the new engine.
+ */
+bool cim_ic_is_current (CimIc* ic)
+{
+  bool retval;
+
+  pthread_mutex_lock (&cim_engine_mutex);
+
+  cim_engine_update_locked ();
+  retval = ic->priv->engine == cim_engine;
+
+  pthread_mutex_unlock (&cim_engine_mutex);
+
+  return retval;
+}
+
+/*
+ * A key that changes focus, such as Tab, is released in another widget, so
+ * the next press of it here would look like a repeat.
+ */
+static void cim_ic_forget_held_key (CimIcPrivate* priv)
+{
+  priv->shared.held_keycode = 0;
+}
+
+void cim_ic_focus_in (CimIc* ic)
+{
+  cim_ic_surround_invalidate (ic->priv);
+  cim_ic_forget_held_key (ic->priv);
+  ic->ops->focus_in (ic);
+}
+
+void cim_ic_focus_out (CimIc* ic)
+{
+  cim_ic_surround_invalidate (ic->priv);
+  cim_ic_forget_held_key (ic->priv);
+  ic->ops->focus_out (ic);
+}
+
+void cim_ic_reset (CimIc* ic)
+{
+  cim_ic_surround_invalidate (ic->priv);
+  cim_ic_forget_held_key (ic->priv);
+  ic->ops->reset (ic);
+}
+
+void cim_ic_set_cursor_pos (CimIc* ic, const CimRect* area)
+{
+  ic->ops->set_cursor_pos (ic, area);
+}
+
+const CimCandidate* cim_ic_get_candidate (CimIc* ic)
+{
+  return ic->ops->get_candidate (ic);
+}
+
+int cim_ic_get_n_candidates (CimIc* ic, bool* exact)
+{
+  bool dummy;
+
+  return ic->ops->get_n_candidates (ic, exact ? exact : &dummy);
+}
+
+/*
+ * Fills items with up to n_items candidates from index on and returns how
+ * many it filled.  The pages before and after are prefetched from the
+ * next cim_dispatch(), unless they already have been or one is waiting.
+ */
+int cim_ic_get_candidates (CimIc*   ic,
+                           int      index,
+                           int      n_items,
+                           CimItem* items)
+{
+  CimIcPrivate* priv = ic->priv;
+  int           n;
+  int           start;
+  int           end;
+
+  if (index < 0 || n_items <= 0)
+    return 0;
+
+  n = ic->ops->get_candidates (ic, index, n_items, items);
+
+  if (ic->ops->prefetch_candidates == cim_ic_prefetch_candidates_nop)
+    return n;
+
+  start = C_MAX (index - n_items, 0);
+  end   = index + 2 * n_items;
+
+  if (priv->prefetched_len && start >= priv->prefetched_index &&
+      end <= priv->prefetched_index + priv->prefetched_len)
+    return n;
+
+  priv->prefetch_index = start;
+  priv->prefetch_len   = end - start;
+
+  /* the waiting one takes the new range */
+  if (!priv->prefetch)
+  {
+    priv->prefetch = true;
+    cim_ic_wakeup (ic);
+  }
+
+  return n;
+}
+
+void cim_ic_prefetch_candidates (CimIc* ic, int index, int n_items)
+{
+  if (index >= 0 && n_items > 0)
+    ic->ops->prefetch_candidates (ic, index, n_items);
+}
+
+/*
+ * Like cim_ic_get_candidates(), but copies the range into one flat block.
+ * The block lives in storage the IC reuses, and stays valid until the next
+ * call or until the list changes.
+ */
+const CimCandidateBlock* cim_ic_get_candidate_block (CimIc* ic,
+                                                     int    index,
+                                                     int    n_items)
+{
+  CimCandidateArena* arena = &ic->priv->candidates;
+  int                n;
+
+  n_items = C_MAX (n_items, 0);
+  cim_candidate_arena_reserve (arena, n_items);
+  n = cim_ic_get_candidates (ic, index, n_items, arena->items);
+  cim_candidate_arena_reset (arena, index);
+
+  for (int i = 0; i < n; i++)
+  {
+    const char* text = "";
+
+    if (arena->items[i].type == CIM_ITEM_STRING && arena->items[i].data)
+      text = arena->items[i].data;
+
+    cim_candidate_arena_add (arena, arena->items[i].type, text, strlen (text));
+  }
+
+  return cim_candidate_arena_block (arena);
+}
+
+/*
+ * Returns the text of the preedit the toolkit was last told about with
+ * its lengths, and with its character offsets if asked for.  The result
+ * is kept until the preedit changes, so asking again costs nothing.
+ */
+const CimText* cim_ic_get_preedit_text (CimIc* ic, bool offsets)
+{
+  CimIcPrivate* priv = ic->priv;
+  CimText*      text = &priv->preedit_text;
+  size_t        capa;
+
+  if (priv->preedit_text_valid &&
+      priv->preedit_text_generation == priv->preedit_generation &&
+      (!offsets || text->byte_offsets))
+    return text;
+
+  text->text = ic->ops->get_preedit (ic)->text;
+
+  if (!text->text)
+    text->text = "";
+
+  text->len = strlen (text->text);
+  capa      = 2 * (text->len + 1);
+
+  if (!offsets)
+  {
+    cim_text_measure (text, NULL, NULL);
+  }
+  else
+  {
+    if (priv->text_offsets_capa < capa)
+    {
+      free (priv->text_offsets);
+      priv->text_offsets      = c_malloc (capa * sizeof (int));
+      priv->text_offsets_capa = capa;
+    }
+
+    cim_text_measure (text, priv->text_offsets,
+                      priv->text_offsets + text->len + 1);
+  }
+
+  priv->preedit_text_valid      = true;
+  priv->preedit_text_generation = priv->preedit_generation;
+
+  return text;
+}
+
+static int cim_preedit_edge_compare (const void* a, const void* b)
+{
+  return ((const CimPreeditEdge*) a)->pos - ((const CimPreeditEdge*) b)->pos;
+}
+
+/*
+ * Returns the preedit split into runs of characters under the same set of
+ * attribute types; characters without attributes are left out.  The
+ * attribute edges are swept in order, so the work depends on the number
+ * of attributes, not on the length of the text.  Kept like the text.
+ */
+const CimPreeditRun* cim_ic_get_preedit_runs (CimIc* ic, int* n_runs)
+{
+  CimIcPrivate*     priv    = ic->priv;
+  const CimPreedit* preedit = ic->ops->get_preedit (ic);
+  int               count[32] = { 0 };
+  uint32_t          run_mask  = 0;
+  int               run_start = 0;
+  int               n_edges   = 0;
+  int               n_chars;
+
+  if (priv->runs_valid && priv->runs_generation == priv->preedit_generation)
+  {
+    *n_runs = priv->n_runs;
+    return priv->runs;
+  }
+
+  n_chars = cim_ic_get_preedit_text (ic, false)->n_chars;
+
+  if (priv->runs_capa < preedit->attrs_len)
+  {
+    priv->runs_capa = C_MAX (preedit->attrs_len, priv->runs_capa * 2);
+    priv->runs  = c_realloc (priv->runs,
+                             2 * priv->runs_capa * sizeof (CimPreeditRun));
+    priv->edges = c_realloc (priv->edges,
+                             2 * priv->runs_capa * sizeof (CimPreeditEdge));
+  }
+
+  for (int i = 0; i < preedit->attrs_len; i++)
+  {
+    const CimPreeditAttr* attr = &preedit->attrs[i];
+    int start = C_MAX (0, C_MIN (attr->start_index, n_chars));
+    int end   = C_MAX (start, C_MIN (attr->end_index, n_chars));
+
+    if (start == end || (unsigned) attr->type >= 32)
+      continue;
+
+    priv->edges[n_edges++] = (CimPreeditEdge) { start, attr->type,  1 };
+    priv->edges[n_edges++] = (CimPreeditEdge) { end,   attr->type, -1 };
+  }
+
+  qsort (priv->edges, n_edges, sizeof (CimPreeditEdge),
+         cim_preedit_edge_compare);
+
+  priv->n_runs = 0;
+
+  for (int i = 0; i < n_edges;)
+  {
+    int      pos  = priv->edges[i].pos;
+    uint32_t mask = run_mask;
+
+    for (; i < n_edges && priv->edges[i].pos == pos; i++)
+    {
+      int type = priv->edges[i].type;
+
+      count[type] += priv->edges[i].delta;
+      mask = count[type] > 0 ? mask | 1u << type : mask & ~(1u << type);
+    }
+
+    if (mask == run_mask)
+      continue;
+
+    if (run_mask)
+      priv->runs[priv->n_runs++] = (CimPreeditRun) { run_start, pos,
+                                                     run_mask };
+    run_start = pos;
+    run_mask  = mask;
+  }
+
+  priv->runs_valid      = true;
+  priv->runs_generation = priv->preedit_generation;
+  *n_runs = priv->n_runs;
+
+  return priv->runs;
+}
+
+/*
+ * Returns the text being committed with its lengths.  Only valid inside
+ * the commit callback; NULL elsewhere.
+ */
+const CimText* cim_ic_get_commit_text (CimIc* ic)
+{
+  CimText* text = &ic->priv->commit_text;
+
+  if (!text->text)
+    return NULL;
+
+  if (text->len < 0)
+    text->len = strlen (text->text);
+
+  if (text->n_chars < 0)
+    cim_text_measure (text, NULL, NULL);
+
+  return text;
+}
+
+/*
+ * Tells libcim the text around the cursor, e.g. from set_surrounding in
+ * GTK.  Indices are in bytes; len may be -1 if text is NUL-terminated.
+ * libcim copies at most CIM_SURROUND_WINDOW characters on each side of
+ * the cursor and keeps the copy in step with commits and delete_surround.
+ *
+ * A toolkit that calls this or cim_ic_invalidate_surround() promises to
+ * report changes made behind libcim's back, and is then asked through
+ * get_surround only when the copy has been invalidated: by
+ * cim_ic_invalidate_surround(), focus changes, cim_ic_reset() and keys
+ * that cim_ic_filter_event_async() passes back unhandled.
+ */
+void cim_ic_set_surround (CimIc*      ic,
+                          const char* text,
+                          int         len,
+                          int         cursor_index,
+                          int         anchor_index)
+{
+  ic->priv->surround_tracked = true;
+
+  if (text)
+    cim_ic_surround_store (ic->priv, text, len, cursor_index, anchor_index);
+  else
+    cim_ic_surround_invalidate (ic->priv);
+}
+
+void cim_ic_invalidate_surround (CimIc* ic)
+{
+  ic->priv->surround_tracked = true;
+  cim_ic_surround_invalidate (ic->priv);
+}
+
+/* grows whenever the surrounding text libcim holds changes */
+uint64_t cim_ic_get_surround_generation (CimIc* ic)
+{
+  cim_ic_surround_check (ic->priv);
+
+  return ic->priv->surround_generation;
+}
+
+/*
+ * Tells libcim and the engine what the focused field is for.  Keys typed
+ * into password, PIN and numeric fields are answered as not handled
+ * without reaching the engine, so nothing is composed, looked up or
+ * learned there.
+ */
+void cim_ic_set_content_type (CimIc*     ic,
+                              CimPurpose purpose,
+                              uint32_t   hints)
+{
+  CimIcPrivate* priv = ic->priv;
+  bool          bypass;
+
+  if (priv->purpose == purpose && priv->hints == hints)
+    return;
+
+  switch (purpose)
+  {
+    case CIM_PURPOSE_DIGITS:
+    case CIM_PURPOSE_NUMBER:
+    case CIM_PURPOSE_PHONE:
+    case CIM_PURPOSE_PASSWORD:
+    case CIM_PURPOSE_PIN:
+      bypass = true;
+      break;
+    default:
+      bypass = false;
+      break;
+  }
+
+  /* What the engine has composed so far is not left hanging; cim-server
+   * does this for its own IC. */
+  if (bypass && !priv->shared.bypass && !priv->engine->client)
+    cim_ic_reset (ic);
+
+  priv->purpose = purpose;
+  priv->hints   = hints;
+  __atomic_store_n (&priv->shared.bypass, bypass, __ATOMIC_RELAXED);
+
+  ic->ops->set_content_type (ic, purpose, hints);
+}
+
+CimPurpose cim_ic_get_purpose (CimIc* ic)
+{
+  return ic->priv->purpose;
+}
+
+uint32_t cim_ic_get_hints (CimIc* ic)
+{
+  return ic->priv->hints;
+}
+
+/*
+ * Publishes which keys the engine wants; NULL restores the default of all
+ * of them.  It may be called from any thread, one at a time per IC.  The
+ * toolkit gets interest_changed from cim_dispatch(), with a copy.
+ */
+void cim_ic_set_interest (CimIc* ic, const CimInterest* interest)
+{
+  static const CimInterest all = { CIM_INTEREST_RELEASE };
+
+  CimIcShared* shared = &ic->priv->shared;
+  uint32_t     seq    = shared->seq;
+  uint32_t     n      = 0;
+
+  if (!interest)
+    interest = &all;
+
+  __atomic_store_n (&shared->seq, seq + 1, __ATOMIC_RELAXED);
+  __atomic_thread_fence (__ATOMIC_RELEASE);
+
+  __atomic_store_n (&shared->interest.flags, interest->flags,
+                    __ATOMIC_RELAXED);
+
+  for (uint32_t i = 0;
+       i < interest->n_ranges && i < CIM_INTEREST_N_RANGES; i++)
+  {
+    /* an empty range would wrap around and match everything */
+    if (interest->ranges[i].last < interest->ranges[i].first)
+      continue;
+
+    __atomic_store_n (&shared->interest.ranges[n].first,
+                      interest->ranges[i].first, __ATOMIC_RELAXED);
+    __atomic_store_n (&shared->interest.ranges[n].last,
+                      interest->ranges[i].last, __ATOMIC_RELAXED);
+    n++;
+  }
+
+  __atomic_store_n (&shared->interest.n_ranges, n, __ATOMIC_RELAXED);
+  __atomic_store_n (&shared->seq, seq + 2, __ATOMIC_RELEASE);
+
+  __atomic_store_n (&ic->priv->interest_changed, true, __ATOMIC_RELAXED);
+  cim_ic_wakeup (ic);
+}
+
+void cim_ic_get_interest (CimIc* ic, CimInterest* interest)
+{
+  const CimIcShared* shared = &ic->priv->shared;
+  uint32_t           seq;
+
+  do
+  {
+    seq = __atomic_load_n (&shared->seq, __ATOMIC_ACQUIRE);
+    memcpy (interest, &shared->interest, sizeof *interest);
+    __atomic_thread_fence (__ATOMIC_ACQUIRE);
+  } while ((seq & 1) ||
+           seq != __atomic_load_n (&shared->seq, __ATOMIC_RELAXED));
+}
+
+/*
+ * Returns the IC's region allocator.  Engines can build preedits and
+ * candidates in it and c_arena_reset() it when they start over, instead
+ * of allocating for every key.  It is freed with the IC.
+ */
+CArena* cim_ic_get_arena (CimIc* ic)
+{
+  return &ic->priv->arena;
+}
+
+/*
+ * Returns a number that grows every time the preedit changes, so toolkits
+ * can tell whether what they built from it is still valid.
+ */
+uint64_t cim_ic_get_preedit_generation (CimIc* ic)
+{
+  return ic->priv->preedit_generation;
+}
+
+/*
+ * Callbacks are kept in the IC by libcim, so registering them never calls
+ * into the engine.
+ */
+void cim_ic_set_callback (CimIc*    ic,
+                          CimCbType type,
+                          void*     callback,
+                          void*     user_data)
+{
+  CimCallbacks* callbacks = &ic->priv->callbacks;
+
+  switch (type)
+  {
+    case CIM_CB_PREEDIT_START:
+      callbacks->preedit_start = callback;
+      break;
+    case CIM_CB_PREEDIT_END:
+      callbacks->preedit_end = callback;
+      break;
+    case CIM_CB_PREEDIT_CHANGED:
+      callbacks->preedit_changed = callback;
+      break;
+    case CIM_CB_COMMIT:
+      callbacks->commit = callback;
+      break;
+    case CIM_CB_GET_SURROUND:
+      callbacks->get_surround = callback;
+      break;
+    case CIM_CB_DELETE_SURROUND:
+      callbacks->delete_surround = callback;
+      break;
+    case CIM_CB_CANDIDATE_START:
+      callbacks->candidate_start = callback;
+      break;
+    case CIM_CB_CANDIDATE_END:
+      callbacks->candidate_end = callback;
+      break;
+    case CIM_CB_CANDIDATE_CHANGED:
+      callbacks->candidate_changed = callback;
+      break;
+    case CIM_CB_EVENT_DONE:
+      callbacks->event_done = callback;
+      break;
+    case CIM_CB_PREEDIT_DELTA:
+      callbacks->preedit_delta = callback;
+      break;
+    case CIM_CB_INTEREST_CHANGED:
+      callbacks->interest_changed = callback;
+      break;
+    default:
+      c_log_warning ("Unknown callback type: %d", type);
+      return;
+  }
+
+  ic->priv->user_data[type] = user_data;
+}
+
+/*
+ * Registers all callbacks at once.  NULL members unregister.
+ */
+void cim_ic_set_callbacks (CimIc*              ic,
+                           const CimCallbacks* callbacks,
+                           void*               user_data)
+{
+  ic->priv->callbacks = *callbacks;
+
+  for (int i = 0; i < CIM_CB_N_TYPES; i++)
+    ic->priv->user_data[i] = user_data;
+}
+
+static void cim_ic_reserve_batch (CimIcPrivate* priv, int n_events)
+{
+  if (n_events <= priv->batch_capa)
+    return;
+
+  priv->batch_capa    = C_MAX (n_events, priv->batch_capa * 2);
+  priv->batch         = c_realloc (priv->batch,
+                                   priv->batch_capa * sizeof (CimEvent));
+  priv->batch_first   = c_realloc (priv->batch_first,
+                                   (priv->batch_capa + 1) * sizeof (int));
+  priv->batch_handled = c_realloc (priv->batch_handled,
+                                   priv->batch_capa * sizeof (bool));
+  priv->batch_left    = c_realloc (priv->batch_left,
+                                   priv->batch_capa * sizeof (int));
+}
+
+/*
+ * Filters events in order and stops after the first one that is not
+ * handled, so the caller can process it and pass the rest in another call.
+ * It also stops before a key the engine does not want, since the engine
+ * may want it again once it has seen the keys before it.  Sets handled[i]
+ * for each consumed event and returns their number.
+ *
+ * Callbacks are coalesced over the batch: the toolkit receives the text
+ * committed by all events as one commit, followed by a single preedit and
+ * candidate update with the final state.  Pending commits are flushed
+ * before the engine reads or deletes surrounding text.  Engines with
+ * CIM_CAP_REPEAT get each run of auto-repeats as one event; the repeats
+ * such an engine does not use end the call, as keys not handled.
+ */
+int cim_ic_filter_events (CimIc*          ic,
+                          const CimEvent* events,
+                          int             n_events,
+                          bool*           handled)
+{
+  CimIcPrivate* priv  = ic->priv;
+  uint32_t      held  = priv->shared.held_keycode;
+  bool          merge = ic->ops->caps & CIM_CAP_REPEAT;
+  int           n_batch = 0;
+  int           n_filtered;
+  int           i;
+
+  if (n_events <= 0)
+    return 0;
+
+  cim_ic_reserve_batch (priv, n_events);
+
+  /* the run up to the first key the engine does not want */
+  for (i = 0; i < n_events; i++)
+  {
+    CimEvent* last  = n_batch ? &priv->batch[n_batch - 1] : NULL;
+    CimEvent  event = events[i];
+    int       first = i;
+
+    cim_ic_track_repeat (ic, &event);
+
+    /* the releases a toolkit makes up before repeats go with them */
+    if (merge && i + 1 < n_events)
+    {
+      uint32_t saved = priv->shared.held_keycode;
+      CimEvent next  = events[i + 1];
+
+      cim_ic_track_repeat (ic, &next);
+
+      if (cim_event_is_made_up (&event, &next))
+      {
+        event = next;
+        i++;
+      }
+      else
+      {
+        priv->shared.held_keycode = saved;
+      }
+    }
+
+    if (!cim_ic_wants_event (ic, &event))
+    {
+      i = first;
+      break;
+    }
+
+    if (merge && last && cim_event_repeats (last, &event))
+    {
+      last->n_repeats++;
+      last->time = event.time;
+      continue;
+    }
+
+    priv->batch[n_batch]       = event;
+    priv->batch_first[n_batch] = first;
+    n_batch++;
+  }
+
+  priv->batch_first[n_batch] = i;
+
+  if (n_batch == 0)
+  {
+    handled[0] = false;
+    n_filtered = 1;
+  }
+  else
+  {
+    priv->batching                 = true;
+    priv->engine_preedit_started   = priv->preedit_started;
+    priv->engine_candidate_started = priv->candidate_started;
+
+    memset (priv->batch_left, 0, n_batch * sizeof (int));
+    priv->batch_len = n_batch;
+
+    n_filtered = ic->ops->filter_events (ic, priv->batch, n_batch,
+                                         priv->batch_handled);
+    priv->batch_len = 0;
+
+    /* an engine that consumes nothing has not handled the first event */
+    if (n_filtered < 1)
+    {
+      priv->batch_handled[0] = false;
+      priv->batch_left[0]    = 0;
+      n_filtered = 1;
+    }
+
+    n_batch = C_MIN (n_filtered, n_batch);
+
+    cim_ic_flush (ic);
+
+    /* the toolkit applies the repeats left over before any later key */
+    for (int j = 0; j < n_batch; j++)
+    {
+      if (priv->batch_handled[j] && priv->batch_left[j])
+      {
+        n_batch = j + 1;
+        break;
+      }
+    }
+
+    for (int j = 0; j < n_batch; j++)
+    {
+      int n_taken   = 1 + priv->batch[j].n_repeats - priv->batch_left[j];
+      int n_presses = 0;
+
+      for (int k = priv->batch_first[j]; k < priv->batch_first[j + 1]; k++)
+        handled[k] = cim_event_split (&events[k], priv->batch_handled[j],
+                                      n_taken, &n_presses);
+    }
+
+    n_filtered = priv->batch_first[n_batch];
+  }
+
+  /* the rest comes again, so only the consumed keys count as held */
+  priv->shared.held_keycode = held;
+
+  for (i = 0; i < n_filtered; i++)
+  {
+    CimEvent event = events[i];
+
+    cim_ic_track_repeat (ic, &event);
+
+    /* the toolkit will apply the key to the text */
+    if (!handled[i] && event.type == CIM_EVENT_KEY_PRESS)
+      cim_ic_surround_invalidate (priv);
+  }
+
+  return n_filtered;
+}
+
+/*
+ * Like cim_ic_filter_event(), but the engine may answer later.  On
+ * CIM_FILTER_PENDING the caller keeps the event and gets the answer through
+ * the event_done callback from cim_dispatch().  Events passed while an
+ * earlier one is pending are queued and answered in order, so every
+ * pending event gets exactly one event_done.
+ */
+CimFilterResult cim_ic_filter_event_async (CimIc* ic, const CimEvent* event)
+{
+  CimEvent tracked = *event;
+
+  cim_ic_track_repeat (ic, &tracked);
+
+  /* events queued before it may be waiting on an event_done callback */
+  if (ic->priv->pending || ic->priv->queue_len)
+  {
+    cim_ic_queue_push (ic, &tracked);
+    return CIM_FILTER_PENDING;
+  }
+
+  return cim_ic_start_event (ic, &tracked);
 }
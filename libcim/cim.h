@@ -157,6 +157,15 @@ enum _CimKeySym {
   CIM_KEY_ISO_Level3_Shift = 0xfe03, /* ISO_Level3_Shift */
   CIM_KEY_ISO_Left_Tab     = 0xfe20, /* ISO_Left_Tab */
 
+  CIM_KEY_dead_grave       = 0xfe50, /* dead_grave */
+  CIM_KEY_dead_acute       = 0xfe51, /* dead_acute */
+  CIM_KEY_dead_circumflex  = 0xfe52, /* dead_circumflex */
+  CIM_KEY_dead_tilde       = 0xfe53, /* dead_tilde */
+
+  CIM_KEY_dead_diaeresis   = 0xfe57, /* dead_diaeresis */
+
+  CIM_KEY_dead_cedilla     = 0xfe5b, /* dead_cedilla */
+
   CIM_KEY_BackSpace        = 0xff08, /* BackSpace */
   CIM_KEY_Tab              = 0xff09, /* Tab */
 
@@ -277,14 +286,57 @@ enum _CimKeySym {
 };
 typedef enum _CimKeySym CimKeySym;
 
+/* over all keysyms in X11's keysymdef.h and XF86keysym.h */
+uint32_t    cim_keysym_from_name  (const char* name);
+const char* cim_keysym_get_name   (uint32_t keysym);
+uint32_t    cim_keysym_to_unicode (uint32_t keysym);
+
+enum _CimEventFlags {
+  CIM_EVENT_REPEAT = 1 << 0 /* an auto-repeat of a key that is held down */
+};
+typedef enum _CimEventFlags CimEventFlags;
+
+/*
+ * libcim sets CIM_EVENT_REPEAT on a press of the key that was pressed last
+ * and not released since; a toolkit that knows better also sets it on the
+ * releases it makes up between repeats.  n_repeats is only set for
+ * engines with CIM_CAP_REPEAT.
+ */
 typedef struct _CimEvent CimEvent;
 struct _CimEvent {
   CimEventType type;
   uint32_t     state;
   uint32_t     keyval;
   uint32_t     keycode;
+  uint32_t     time;      /* in milliseconds, 0 if unknown */
+  uint16_t     flags;     /* CimEventFlags */
+  uint16_t     n_repeats; /* presses merged into this one after the first */
 };
 
+/*
+ * A set of key bindings, each mapping a keyval and modifiers to a non-zero
+ * action.  A binding matches when (state & ~ignored & CIM_MODIFIER_MASK)
+ * equals mods, leaving out the bits a modifier key sets itself, so that
+ * "<Release>Shift_L" matches; ASCII letters match either case.  The
+ * bindings are compiled into a hash on (keyval, press or release) at the
+ * first lookup after a change, and the first added of the matching ones
+ * wins.
+ */
+typedef struct _CimHotkeys CimHotkeys;
+
+CimHotkeys* cim_hotkeys_new        ();
+void        cim_hotkeys_free       (CimHotkeys* hotkeys);
+bool        cim_hotkeys_add        (CimHotkeys*  hotkeys,
+                                    CimEventType type,
+                                    uint32_t     keyval,
+                                    uint32_t     mods,
+                                    uint32_t     ignored,
+                                    int          action);
+bool        cim_hotkeys_add_string (CimHotkeys* hotkeys,
+                                    const char* binding,
+                                    int         action);
+int         cim_hotkeys_lookup     (CimHotkeys* hotkeys, const CimEvent* event);
+
 enum _CimPreeditAttrType
 {
   CIM_PREEDIT_ATTR_UNDERLINE,
@@ -299,6 +351,17 @@ struct _CimPreeditAttr {
   int end_index; /* in characters. The character at this index is not included */
 };
 
+/*
+ * A run of preedit characters under the same attribute types, for
+ * toolkits that cannot stack attributes; see cim_ic_get_preedit_runs().
+ */
+typedef struct _CimPreeditRun CimPreeditRun;
+struct _CimPreeditRun {
+  int      start_index; /* in characters */
+  int      end_index;
+  uint32_t types;       /* 1 << CimPreeditAttrType of each attribute */
+};
+
 typedef struct _CimPreedit CimPreedit;
 struct _CimPreedit {
   char* text;
@@ -307,6 +370,46 @@ struct _CimPreedit {
   int cursor_pos;
 };
 
+/*
+ * What changed between two preedits, in characters.  The characters
+ * [start, start + n_deleted) of the old text were replaced by inserted.
+ * Attributes may differ in [attr_start, attr_end) of the new text, which
+ * includes the inserted text; elsewhere they are the old ones, shifted.
+ */
+typedef struct _CimPreeditDelta CimPreeditDelta;
+struct _CimPreeditDelta {
+  uint64_t          generation;
+  int               start;
+  int               n_deleted;
+  const char*       inserted;     /* not NUL-terminated */
+  int               inserted_len; /* in bytes */
+  int               n_inserted;   /* in characters */
+  int               attr_start;
+  int               attr_end;
+  const CimPreedit* preedit;      /* the whole new preedit */
+};
+
+/*
+ * A text with its lengths, measured once by libcim.  If offsets were asked
+ * for, byte_offsets[i] and utf16_offsets[i] are where character i starts,
+ * for i from 0 to n_chars inclusive.
+ */
+typedef struct _CimText CimText;
+struct _CimText {
+  const char* text;
+  int         len;      /* in bytes */
+  int         n_chars;
+  int         n_utf16;  /* in UTF-16 code units */
+  const int*  byte_offsets;
+  const int*  utf16_offsets;
+};
+
+/*
+ * libcim keeps at most this many characters of surrounding text on each
+ * side of the cursor.
+ */
+#define CIM_SURROUND_WINDOW 256
+
 typedef struct _CimSurround CimSurround;
 struct _CimSurround {
   char* text;
@@ -337,6 +440,21 @@ struct _CimCandidate {
   int       n_cols;
 };
 
+/*
+ * A range of candidates stored flat: the texts one after another in text,
+ * each NUL-terminated, and per item its offset into text, its length in
+ * bytes and its CimItemType.
+ */
+typedef struct _CimCandidateBlock CimCandidateBlock;
+struct _CimCandidateBlock {
+  int             index;   /* of the first item */
+  int             n_items;
+  const char*     text;
+  const uint32_t* offsets;
+  const uint32_t* lens;
+  const uint8_t*  types;
+};
+
 typedef struct _CimRect CimRect;
 struct _CimRect {
   int x;
@@ -355,11 +473,64 @@ enum _CimCbType {
   CIM_CB_CANDIDATE_START,
   CIM_CB_CANDIDATE_END,
   CIM_CB_CANDIDATE_CHANGED,
+  CIM_CB_EVENT_DONE,
+  CIM_CB_PREEDIT_DELTA,
+  CIM_CB_INTEREST_CHANGED,
   CIM_CB_N_TYPES
 };
 typedef enum _CimCbType CimCbType;
 
+/*
+ * Which keys an engine wants to see; by default every press and release.
+ * An engine in a direct mode sets CIM_INTEREST_PASSTHROUGH with ranges
+ * covering the keys that switch it back, e.g. Hangul, or space for
+ * Shift+space.  Other keys are then answered as not handled without
+ * leaving libcim.  It only saves work: the engine may still be given a
+ * key it does not want, e.g. later in a batch that changed the interest.
+ */
+enum _CimInterestFlags {
+  CIM_INTEREST_RELEASE     = 1 << 0, /* key releases too */
+  CIM_INTEREST_PASSTHROUGH = 1 << 1  /* only keyvals in ranges */
+};
+typedef enum _CimInterestFlags CimInterestFlags;
+
+#define CIM_INTEREST_N_RANGES 4
+
+typedef struct _CimInterest CimInterest;
+struct _CimInterest {
+  uint32_t flags; /* CimInterestFlags */
+  uint32_t n_ranges;
+  struct {
+    uint32_t first;
+    uint32_t last;  /* inclusive */
+  } ranges[CIM_INTEREST_N_RANGES];
+};
+
+/* What a text field is for; the values follow GtkInputPurpose. */
+enum _CimPurpose {
+  CIM_PURPOSE_FREE_FORM,
+  CIM_PURPOSE_ALPHA,
+  CIM_PURPOSE_DIGITS,
+  CIM_PURPOSE_NUMBER,
+  CIM_PURPOSE_PHONE,
+  CIM_PURPOSE_URL,
+  CIM_PURPOSE_EMAIL,
+  CIM_PURPOSE_NAME,
+  CIM_PURPOSE_PASSWORD,
+  CIM_PURPOSE_PIN,
+  CIM_PURPOSE_TERMINAL
+};
+typedef enum _CimPurpose CimPurpose;
+
+enum _CimHintFlags {
+  CIM_HINT_NO_PREDICTION = 1 << 0, /* no completion or candidate lookups */
+  CIM_HINT_PRIVATE       = 1 << 1, /* do not learn from the text */
+  CIM_HINT_LATIN         = 1 << 2  /* Latin text is expected */
+};
+typedef enum _CimHintFlags CimHintFlags;
+
 typedef struct _CimIc CimIc;
+typedef struct _CimIcPrivate CimIcPrivate;
 typedef struct _CimCallbacks CimCallbacks;
 struct _CimCallbacks {
   void (*preedit_start)     (CimIc* ic, void* user_data);
@@ -381,9 +552,77 @@ struct _CimCallbacks {
   void (*candidate_changed) (CimIc* ic,
                              const CimCandidate* candidate,
                              void* user_data);
+  /* the result of an event for which cim_ic_filter_event_async()
+   * returned CIM_FILTER_PENDING.  The keys typed after it go on to the
+   * engine when this returns, so an unhandled key must be delivered to the
+   * widget from here to keep the order.  Freeing the IC here is allowed. */
+  void (*event_done)        (CimIc* ic,
+                             const CimEvent* event,
+                             bool  handled,
+                             void* user_data);
+  /* if set, called instead of preedit_changed */
+  void (*preedit_delta)     (CimIc* ic,
+                             const CimPreeditDelta* delta,
+                             void* user_data);
+  /* the engine called cim_ic_set_interest(), from cim_dispatch() */
+  void (*interest_changed)  (CimIc* ic,
+                             const CimInterest* interest,
+                             void* user_data);
 };
 
-struct _CimIc {
+enum _CimFilterResult {
+  CIM_FILTER_NOT_HANDLED = 0,
+  CIM_FILTER_HANDLED     = 1,
+  CIM_FILTER_PENDING     = 2
+};
+typedef enum _CimFilterResult CimFilterResult;
+
+/*
+ * Engine ABI
+ *
+ * cim.so exports three functions:
+ *
+ *   const CimIcOps* cim_plugin_query (uint32_t abi_version);
+ *   CimIc*          cim_plugin_new   ();
+ *   void            cim_plugin_free  (CimIc* ic);
+ *
+ * cim_plugin_query() receives the CIM_ABI_VERSION of libcim and returns
+ * the engine's ops table, or NULL if it cannot work with that version.
+ * libcim copies the first ops->size bytes of the table and fills entries
+ * the engine leaves NULL or does not know about with defaults, so the table
+ * can grow without breaking older engines.
+ *
+ * cim_plugin_new() returns a zero-initialized object whose first member is
+ * a CimIc.  libcim fills in the CimIc fields; the engine must not touch
+ * them.  After creation libcim calls set_callbacks() once, and the engine
+ * reports preedit, commit and candidate changes through that table.
+ *
+ * The version goes up when a type the engine sees changes layout.  2 added
+ * flags and n_repeats to CimEvent; libcim refuses engines built for 1.
+ */
+#define CIM_ABI_VERSION 2
+
+enum _CimCapFlags {
+  CIM_CAP_PREEDIT    = 1 << 0, /* shows preedit text */
+  CIM_CAP_SURROUND   = 1 << 1, /* uses surrounding text */
+  CIM_CAP_CANDIDATE  = 1 << 2, /* shows candidates */
+  CIM_CAP_CURSOR_POS = 1 << 3, /* uses the cursor location */
+  /*
+   * Takes a run of auto-repeats that libcim finds waiting, in a batch or
+   * behind a slow answer, as one event with n_repeats, along with the
+   * releases made up between them.  Handling it handles every event in
+   * it, unless the engine calls cim_ic_set_repeats_used(), e.g. when its
+   * preedit runs out; the rest then go back to the toolkit.
+   */
+  CIM_CAP_REPEAT     = 1 << 4
+};
+typedef enum _CimCapFlags CimCapFlags;
+
+typedef struct _CimIcOps CimIcOps;
+struct _CimIcOps {
+  uint32_t size;        /* sizeof (CimIcOps) the engine was built with */
+  uint32_t abi_version; /* CIM_ABI_VERSION the engine was built with */
+  uint32_t caps;        /* CimCapFlags */
   void (*focus_in)       (CimIc* ic);
   void (*focus_out)      (CimIc* ic);
   void (*reset)          (CimIc* ic);
@@ -391,27 +630,242 @@ struct _CimIc {
   void (*set_cursor_pos) (CimIc* ic, const CimRect*  area);
   const CimPreedit*   (*get_preedit)   (CimIc* ic);
   const CimCandidate* (*get_candidate) (CimIc* ic);
-  void (*set_callback)   (CimIc* ic,
-                          CimCbType type,
-                          void* callback,
+  void (*set_callbacks)  (CimIc* ic,
+                          const CimCallbacks* callbacks,
                           void* user_data);
+  /*
+   * Filters events in order and stops after the first one that is not
+   * handled, or whose repeats it did not all use.  Sets handled[i] for
+   * each event it consumed and returns their number.  Engines that can
+   * work on a whole run of keys at once implement this; otherwise libcim
+   * calls filter_event() in a loop.
+   */
+  int  (*filter_events)  (CimIc* ic,
+                          const CimEvent* events,
+                          int   n_events,
+                          bool* handled);
+  /*
+   * Starts filtering an event.  An engine that needs time, e.g. for a
+   * dictionary lookup, returns CIM_FILTER_PENDING, does the work on its own
+   * thread and then calls wakeup (ic) once from that thread.  libcim then
+   * calls filter_event_finish() on the toolkit thread, where the engine
+   * emits its callbacks and returns whether the event was handled.
+   * Callbacks must not be called from other threads, and wakeup must not be
+   * called after cim_plugin_free() has returned.  Engines without these
+   * are run through filter_event().
+   */
+  CimFilterResult (*filter_event_async) (CimIc* ic,
+                                         const CimEvent* event,
+                                         void (*wakeup) (CimIc* ic));
+  bool (*filter_event_finish) (CimIc* ic);
+  /*
+   * Candidates on demand.  get_n_candidates() returns the number of
+   * candidates and sets *exact to false if that is only an estimate, e.g.
+   * while a search still runs.  get_candidates() fills items with up to
+   * n_items candidates from index on and returns how many it filled; the
+   * items stay valid until the list changes or get_candidates() is called
+   * again.  prefetch_candidates() is a hint that a range will be asked for
+   * soon; libcim calls it from cim_dispatch(), not while keys are filtered.
+   * An engine with these calls candidate_changed() when the list changes
+   * and need not build CimCandidate tables.  Without them, libcim serves
+   * the current page of get_candidate().
+   */
+  int  (*get_n_candidates)    (CimIc* ic, bool* exact);
+  int  (*get_candidates)      (CimIc* ic,
+                               int      index,
+                               int      n_items,
+                               CimItem* items);
+  void (*prefetch_candidates) (CimIc* ic, int index, int n_items);
+  /*
+   * The field that has the focus.  An engine can turn off prediction for
+   * CIM_HINT_NO_PREDICTION.  Keys of password and numeric fields never
+   * reach the engine.
+   */
+  void (*set_content_type)    (CimIc*     ic,
+                               CimPurpose purpose,
+                               uint32_t   hints);
+};
+
+struct _CimIc {
+  /* Set by libcim.  Every entry is non-NULL. */
+  const CimIcOps* ops;
+  CimIcPrivate*   priv;
+};
+
+/*
+ * The start of CimIcPrivate, read by the inline calls below.  seq is odd
+ * while cim_ic_set_interest() writes the interest.  bypass is set for
+ * fields whose keys the engine does not see.  held_keycode is the key
+ * pressed last, until it is released.  surround_stale is set when a key
+ * press went back to the toolkit, which then changes the text.
+ */
+typedef struct _CimIcShared CimIcShared;
+struct _CimIcShared {
+  uint32_t    seq;
+  uint32_t    bypass;
+  uint32_t    held_keycode; /* on the toolkit thread */
+  bool        surround_stale; /* on the toolkit thread */
+  CimInterest interest;
 };
 
 CimIc* cim_ic_new ();
 void   cim_ic_free           (CimIc* ic);
+bool   cim_ic_is_current     (CimIc* ic);
 void   cim_ic_focus_in       (CimIc* ic);
 void   cim_ic_focus_out      (CimIc* ic);
 void   cim_ic_reset          (CimIc* ic);
-bool   cim_ic_filter_event   (CimIc* ic, const CimEvent* event);
 void   cim_ic_set_cursor_pos (CimIc* ic, const CimRect*  area);
 void   cim_ic_set_callback   (CimIc* ic,
                               CimCbType type,
                               void* callback,
                               void* user_data);
-const CimPreedit*   cim_ic_get_preedit   (CimIc* ic);
+void   cim_ic_set_callbacks  (CimIc* ic,
+                              const CimCallbacks* callbacks,
+                              void* user_data);
 const CimCandidate* cim_ic_get_candidate (CimIc* ic);
+int    cim_ic_get_n_candidates (CimIc* ic, bool* exact);
+int    cim_ic_get_candidates   (CimIc*   ic,
+                                int      index,
+                                int      n_items,
+                                CimItem* items);
+void   cim_ic_prefetch_candidates (CimIc* ic, int index, int n_items);
+const CimCandidateBlock* cim_ic_get_candidate_block (CimIc* ic,
+                                                     int    index,
+                                                     int    n_items);
+uint64_t cim_ic_get_preedit_generation (CimIc* ic);
+struct _CArena* cim_ic_get_arena (CimIc* ic);
+void   cim_ic_set_repeats_used (CimIc*          ic,
+                                const CimEvent* event,
+                                int             n_used);
+const CimText* cim_ic_get_preedit_text (CimIc* ic, bool offsets);
+const CimPreeditRun* cim_ic_get_preedit_runs (CimIc* ic, int* n_runs);
+const CimText* cim_ic_get_commit_text  (CimIc* ic);
+void   cim_ic_set_surround   (CimIc*      ic,
+                              const char* text,
+                              int         len,
+                              int         cursor_index,
+                              int         anchor_index);
+void   cim_ic_invalidate_surround     (CimIc* ic);
+uint64_t cim_ic_get_surround_generation (CimIc* ic);
+void   cim_ic_set_content_type (CimIc*     ic,
+                                CimPurpose purpose,
+                                uint32_t   hints);
+CimPurpose cim_ic_get_purpose (CimIc* ic);
+uint32_t   cim_ic_get_hints   (CimIc* ic);
+void   cim_ic_set_interest   (CimIc* ic, const CimInterest* interest);
+void   cim_ic_get_interest   (CimIc* ic, CimInterest* interest);
+int    cim_ic_filter_events  (CimIc* ic,
+                              const CimEvent* events,
+                              int   n_events,
+                              bool* handled);
+CimFilterResult cim_ic_filter_event_async (CimIc* ic, const CimEvent* event);
+
+/*
+ * Whether the engine wants event.  Lock-free: a read that overlaps
+ * cim_ic_set_interest() on another thread is retried.
+ */
+static inline bool cim_ic_wants_event (CimIc* ic, const CimEvent* event)
+{
+  const CimIcShared* shared = (const CimIcShared*) ic->priv;
+  uint32_t           seq;
+  bool               wants;
+
+  if (__atomic_load_n (&shared->bypass, __ATOMIC_RELAXED))
+    return false;
+
+  do
+  {
+    seq = __atomic_load_n (&shared->seq, __ATOMIC_ACQUIRE);
+
+    uint32_t flags = __atomic_load_n (&shared->interest.flags,
+                                      __ATOMIC_RELAXED);
+
+    if (event->type == CIM_EVENT_KEY_RELEASE &&
+        !(flags & CIM_INTEREST_RELEASE))
+    {
+      wants = false;
+    }
+    else if (!(flags & CIM_INTEREST_PASSTHROUGH))
+    {
+      wants = true;
+    }
+    else
+    {
+      uint32_t n = __atomic_load_n (&shared->interest.n_ranges,
+                                    __ATOMIC_RELAXED);
+
+      wants = false;
+
+      for (uint32_t i = 0; i < n && i < CIM_INTEREST_N_RANGES; i++)
+      {
+        uint32_t first = __atomic_load_n (&shared->interest.ranges[i].first,
+                                          __ATOMIC_RELAXED);
+        uint32_t last  = __atomic_load_n (&shared->interest.ranges[i].last,
+                                          __ATOMIC_RELAXED);
+
+        wants |= event->keyval - first <= last - first;
+      }
+    }
+
+    __atomic_thread_fence (__ATOMIC_ACQUIRE);
+  } while ((seq & 1) ||
+           seq != __atomic_load_n (&shared->seq, __ATOMIC_RELAXED));
+
+  return wants;
+}
+
+/* Marks event as an auto-repeat if its key is still held down. */
+static inline void cim_ic_track_repeat (CimIc* ic, CimEvent* event)
+{
+  CimIcShared* shared = (CimIcShared*) ic->priv;
+
+  if (event->type == CIM_EVENT_KEY_PRESS)
+  {
+    if (event->keycode && event->keycode == shared->held_keycode)
+      event->flags |= CIM_EVENT_REPEAT;
+
+    shared->held_keycode = event->keycode;
+  }
+  else if (event->keycode == shared->held_keycode &&
+           !(event->flags & CIM_EVENT_REPEAT))
+  {
+    shared->held_keycode = 0;
+  }
+}
+
+/* The hot calls dispatch straight into the engine. */
+static inline bool cim_ic_filter_event (CimIc* ic, const CimEvent* event)
+{
+  CimEvent tracked = *event;
+
+  cim_ic_track_repeat (ic, &tracked);
+
+  if (cim_ic_wants_event (ic, &tracked) &&
+      ic->ops->filter_event (ic, &tracked))
+    return true;
+
+  if (tracked.type == CIM_EVENT_KEY_PRESS)
+    ((CimIcShared*) ic->priv)->surround_stale = true;
+
+  return false;
+}
+
+static inline const CimPreedit* cim_ic_get_preedit (CimIc* ic)
+{
+  return ic->ops->get_preedit (ic);
+}
+
+static inline uint32_t cim_ic_get_caps (CimIc* ic)
+{
+  return ic->ops->caps;
+}
+
 /* utility functions */
 char* cim_get_cim_so_path ();
+void  cim_preload         ();
+void  cim_finalize        ();
+int   cim_get_async_fd    ();
+void  cim_dispatch        ();
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,188 @@
+#!/usr/bin/env ruby
+#
+# gen-keysym-table.rb
+# This file is part of Cim.
+#
+# Copyright (C) 2023 Hodong Kim <hodong@nimfsoft.art>
+#
+# Permission to use, copy, modify, and/or distribute this software for any
+# purpose with or without fee is hereby granted.
+#
+# THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+# WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+# MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+# ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+# WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+# ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+# OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+#
+# Usage: gen-keysym-table.rb keysymdef.h [XF86keysym.h] > cim-keysym-table.h
+#
+# Writes perfect hash tables for keysym -> name, name -> keysym and
+# keysym -> Unicode.  Each table has a displacement per bucket: a key in
+# bucket b lives in slot cim_keysym_slot (hash, disp[b]), and no two keys
+# share a slot.  The hashes must match those in cim-keysym.c.
+
+MASK   = 0xffffffff
+GOLDEN = 0x9e3779b9
+
+def fmix32(h)
+  h ^= h >> 16
+  h  = (h * 0x85ebca6b) & MASK
+  h ^= h >> 13
+  h  = (h * 0xc2b2ae35) & MASK
+  h ^ (h >> 16)
+end
+
+def fnv1a(str)
+  str.each_byte.inject(2166136261) { |h, b| ((h ^ b) * 16777619) & MASK }
+end
+
+def reduce(h, n)
+  (h * n) >> 32
+end
+
+def bucket_of(h, n_buckets)
+  reduce(fmix32(h), n_buckets)
+end
+
+def slot_of(h, disp, n_slots)
+  reduce(fmix32((h + disp * GOLDEN) & MASK), n_slots)
+end
+
+# keys: [[hash, value], ...]; returns [disps, slots]
+def perfect_hash(keys)
+  n_buckets = [(keys.size + 3) / 4, 1].max
+  n_slots   = keys.size + keys.size / 8 + 1
+  buckets   = Array.new(n_buckets) { [] }
+  disps     = Array.new(n_buckets, 0)
+  slots     = Array.new(n_slots)
+
+  keys.each { |key| buckets[bucket_of(key[0], n_buckets)] << key }
+
+  buckets.each_with_index.sort_by { |b, i| [-b.size, i] }.each do |bucket, i|
+    next if bucket.empty?
+
+    (1..0xffff).each do |disp|
+      picked = bucket.map { |key| slot_of(key[0], disp, n_slots) }
+
+      next if picked.uniq.size != picked.size || picked.any? { |s| slots[s] }
+
+      picked.zip(bucket).each { |s, key| slots[s] = key }
+      disps[i] = disp
+      break
+    end
+
+    abort "no displacement for bucket #{i}" if disps[i] == 0
+  end
+
+  [disps, slots]
+end
+
+# [name, keysym] in file order; of names sharing a keysym the first is canonical
+names   = []
+keysyms = {}
+unicode = {}
+
+ARGV.each do |path|
+  File.foreach(path) do |line|
+    next unless line =~ /^#define\s+(XF86)?XK_(\w+)\s+(?:_EVDEVK\()?(0x\h+)\)?\s*(?:\/\*\s*(.*?)\s*\*\/)?/
+
+    name    = $1 ? "XF86#{$2}" : $2
+    keysym  = $3.hex
+    comment = $4.to_s
+    keysym += 0x10081000 if line.include?("_EVDEVK(")
+
+    next if keysyms.key?(name)
+
+    names << [name, keysym]
+    keysyms[name] = keysym
+
+    # Parenthesized mappings are the deprecated ones.
+    if comment =~ /\AU\+(\h{4,6})\b/ && !unicode.key?(keysym)
+      unicode[keysym] = $1.hex
+    end
+  end
+end
+
+abort "no keysyms found" if names.empty?
+
+# keypad keys that type a character
+{
+  "KP_Space" => 0x20, "KP_Tab" => 0x09, "KP_Enter" => 0x0d,
+  "KP_Equal" => 0x3d, "KP_Multiply" => 0x2a, "KP_Add" => 0x2b,
+  "KP_Separator" => 0x2c, "KP_Subtract" => 0x2d, "KP_Decimal" => 0x2e,
+  "KP_Divide" => 0x2f
+}.merge((0..9).map { |i| ["KP_#{i}", 0x30 + i] }.to_h).each do |name, c|
+  unicode[keysyms[name]] ||= c if keysyms[name]
+end
+
+latin1 = ->(keysym) { (0x20..0x7e).include?(keysym) || (0xa0..0xff).include?(keysym) }
+direct = ->(keysym) { keysym >> 24 == 0x01 && (0x100..0x10ffff).include?(keysym & 0xffffff) }
+
+# one pool for all names; offsets are 16 bits
+pool    = ""
+offsets = {}
+
+names.each do |name, _|
+  offsets[name] = pool.bytesize
+  pool << name << "\0"
+end
+
+abort "name pool too large" if pool.bytesize >= 0xffff
+
+canonical = {}
+names.each { |name, keysym| canonical[keysym] ||= name }
+
+to_name = canonical.reject { |keysym, _| keysym < 0x100 }.map do |keysym, name|
+  [keysym, [keysym, offsets[name]]]
+end
+from_name = names.map { |name, keysym| [fnv1a(name), [offsets[name], keysym]] }
+to_unicode = unicode.reject { |keysym, _| latin1.(keysym) || direct.(keysym) }.map do |keysym, c|
+  [keysym, [keysym, c]]
+end
+
+def emit_table(out, prefix, keys, type, fields, empty)
+  disps, slots = perfect_hash(keys)
+
+  out.puts "#define CIM_KEYSYM_#{prefix.upcase}_N_BUCKETS #{disps.size}"
+  out.puts "#define CIM_KEYSYM_#{prefix.upcase}_N_SLOTS   #{slots.size}"
+  out.puts
+  out.puts "static const uint16_t cim_keysym_#{prefix}_disps[#{disps.size}] = {"
+  disps.each_slice(12) { |s| out.puts "  " + s.map { |d| "%5d" % d }.join(",") + "," }
+  out.puts "};"
+  out.puts
+  out.puts "static const #{type} cim_keysym_#{prefix}_slots[#{slots.size}] = {"
+  slots.each do |slot|
+    out.puts "  { " + (slot ? fields.(slot[1]) : empty) + " },"
+  end
+  out.puts "};"
+  out.puts
+end
+
+out = $stdout
+
+out.puts "/* Generated by gen-keysym-table.rb from #{ARGV.map { |p| File.basename(p) }.join(' and ')}; do not edit. */"
+out.puts
+out.puts "static const char cim_keysym_names[] ="
+pool.split("\0").each_slice(4) do |slice|
+  out.puts "  " + slice.map { |n| "\"#{n}\\0\"" }.join(" ")
+end
+out.puts ";"
+out.puts
+out.puts "#define CIM_KEYSYM_NO_NAME 0xffff"
+out.puts
+out.puts "/* names of 0x00 - 0xff by keysym */"
+out.puts "static const uint16_t cim_keysym_latin1_names[256] = {"
+(0..255).each_slice(8) do |slice|
+  out.puts "  " + slice.map { |k| canonical[k] ? "%6d" % offsets[canonical[k]] : "0xffff" }.join(",") + ","
+end
+out.puts "};"
+out.puts
+
+emit_table(out, "to_name", to_name, "CimKeysymName",
+           ->(v) { "0x%08x, %5d" % v }, "0, CIM_KEYSYM_NO_NAME")
+emit_table(out, "from_name", from_name, "CimKeysymName",
+           ->(v) { "0x%08x, %5d" % [v[1], v[0]] }, "0, CIM_KEYSYM_NO_NAME")
+emit_table(out, "to_unicode", to_unicode, "CimKeysymUnicode",
+           ->(v) { "0x%08x, 0x%06x" % v }, "0, 0")
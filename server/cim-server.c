@@ -0,0 +1,746 @@
+/* -*- Mode: C; indent-tabs-mode: nil; c-basic-offset: 2; tab-width: 2 -*- */
+/*
+ * cim-server.c
+ * This file is part of Cim.
+ *
+ * Copyright (C) 2023 Hodong Kim <hodong@nimfsoft.art>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+#include "cim.h"
+#include "cim-ipc.h"
+#include "cim-private.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include "c-array.h"
+#include "c-mem.h"
+#include "c-str.h"
+
+/*
+ * cim-server runs the engine once per user session.  Clients are the
+ * toolkit modules, whose libcim forwards every CimIc operation here; see
+ * cim-ipc.h for the transport.
+ */
+
+typedef struct _CimConn     CimConn;
+typedef struct _CimServerIc CimServerIc;
+
+struct _CimConn {
+  CimIpc     ipc;
+  CimShm*    shm; /* NULL until the client has sent it */
+  CArray*    ics;
+  CimMsgType waiting;  /* the answer it is waiting for, 0 if none */
+  bool       answered; /* the answer is in ipc */
+  bool       dead;
+};
+
+struct _CimServerIc {
+  CimConn*    conn;
+  uint32_t    id;
+  CimIc*      ic;
+  CimSurround surround;
+  uint32_t    purpose; /* kept for a new IC after cim.so is reloaded */
+  uint32_t    hints;
+};
+
+static volatile sig_atomic_t cim_server_quit;
+static uint32_t              cim_server_caps;
+static int                   cim_server_sock;
+static int                   cim_server_async_fd;
+static CArray*               cim_server_conns;
+
+static void cim_conn_dispatch   (CimConn* conn);
+static bool cim_server_iterate  (CimConn* waiter, int timeout);
+
+static void cim_server_send (CimServerIc* sic,
+                             CimMsgType   type,
+                             const void*  data,
+                             uint32_t     len)
+{
+  if (!sic->conn->dead &&
+      !cim_ipc_send (&sic->conn->ipc, type, sic->id, data, len))
+    sic->conn->dead = true;
+}
+
+static int64_t cim_server_now_ms ()
+{
+  struct timespec ts;
+
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+
+  return ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+/*
+ * Waits for the client's answer to a callback, handling requests that
+ * arrive before it.  The other connections are served meanwhile, so a
+ * slow client only holds up itself.  Returns false if the client does not
+ * answer.
+ */
+static bool cim_server_wait (CimConn* conn, CimMsgType type)
+{
+  CimMsgType outer    = conn->waiting; /* when a nested call asks too */
+  int64_t    deadline = cim_server_now_ms () + CIM_IPC_TIMEOUT;
+  int64_t    now;
+  bool       answered;
+
+  conn->waiting  = type;
+  conn->answered = false;
+
+  while (!conn->dead && !conn->answered &&
+         (now = cim_server_now_ms ()) < deadline)
+  {
+    if (!cim_server_iterate (conn, deadline - now))
+      break;
+  }
+
+  answered       = conn->answered;
+  conn->waiting  = outer;
+  conn->answered = false;
+
+  if (!answered)
+    conn->dead = true;
+
+  return answered;
+}
+
+static void cb_preedit_start (CimIc* ic, CimServerIc* sic)
+{
+  cim_server_send (sic, CIM_MSG_PREEDIT_START, NULL, 0);
+}
+
+static void cb_preedit_end (CimIc* ic, CimServerIc* sic)
+{
+  cim_server_send (sic, CIM_MSG_PREEDIT_END, NULL, 0);
+}
+
+static void cb_preedit_changed (CimIc*            ic,
+                                const CimPreedit* preedit,
+                                CimServerIc*      sic)
+{
+  CimIpc*  ipc  = &sic->conn->ipc;
+  int32_t  head[2] = { preedit->cursor_pos, preedit->attrs_len };
+  uint32_t len  = strlen (preedit->text);
+
+  if (sic->conn->dead ||
+      !cim_ipc_begin (ipc, CIM_MSG_PREEDIT_CHANGED, sic->id,
+                      sizeof head + preedit->attrs_len * 3 * sizeof (int32_t) +
+                      len))
+  {
+    sic->conn->dead = true;
+    return;
+  }
+
+  cim_ipc_write (ipc, head, sizeof head);
+
+  for (int i = 0; i < preedit->attrs_len; i++)
+  {
+    int32_t attr[3] = { preedit->attrs[i].type,
+                        preedit->attrs[i].start_index,
+                        preedit->attrs[i].end_index };
+
+    cim_ipc_write (ipc, attr, sizeof attr);
+  }
+
+  cim_ipc_write (ipc, preedit->text, len);
+
+  if (!cim_ipc_end (ipc))
+    sic->conn->dead = true;
+}
+
+static void cb_commit (CimIc* ic, const char* text, CimServerIc* sic)
+{
+  cim_server_send (sic, CIM_MSG_COMMIT, text, strlen (text));
+}
+
+static const CimSurround* cb_get_surround (CimIc* ic, CimServerIc* sic)
+{
+  CimConn* conn = sic->conn;
+  int32_t  head[3];
+
+  cim_server_send (sic, CIM_MSG_GET_SURROUND, NULL, 0);
+
+  if (!cim_server_wait (conn, CIM_MSG_SURROUND) ||
+      conn->ipc.msg.len < sizeof head)
+    return NULL;
+
+  memcpy (head, conn->ipc.payload, sizeof head);
+
+  if (!head[0])
+    return NULL;
+
+  free (sic->surround.text);
+  sic->surround.len        = conn->ipc.msg.len - sizeof head;
+  sic->surround.text       = c_strndup ((char*) conn->ipc.payload + sizeof head,
+                                        sic->surround.len);
+  sic->surround.cursor_pos = head[1];
+  sic->surround.anchor_pos = head[2];
+
+  return &sic->surround;
+}
+
+static bool cb_delete_surround (CimIc*       ic,
+                                int          offset,
+                                int          n_chars,
+                                CimServerIc* sic)
+{
+  CimConn* conn = sic->conn;
+  int32_t  args[2] = { offset, n_chars };
+  uint32_t retval  = 0;
+
+  cim_server_send (sic, CIM_MSG_DELETE_SURROUND, args, sizeof args);
+
+  if (cim_server_wait (conn, CIM_MSG_DELETED) &&
+      conn->ipc.msg.len == sizeof retval)
+    memcpy (&retval, conn->ipc.payload, sizeof retval);
+
+  return retval;
+}
+
+static void cb_candidate_start (CimIc* ic, CimServerIc* sic)
+{
+  cim_server_send (sic, CIM_MSG_CANDIDATE_START, NULL, 0);
+}
+
+static void cb_candidate_end (CimIc* ic, CimServerIc* sic)
+{
+  cim_server_send (sic, CIM_MSG_CANDIDATE_END, NULL, 0);
+}
+
+static void cb_interest_changed (CimIc*             ic,
+                                 const CimInterest* interest,
+                                 CimServerIc*       sic)
+{
+  cim_server_send (sic, CIM_MSG_INTEREST, interest, sizeof (CimInterest));
+}
+
+static void cb_candidate_changed (CimIc*              ic,
+                                  const CimCandidate* candidate,
+                                  CimServerIc*        sic)
+{
+  CimIpc*  ipc     = &sic->conn->ipc;
+  int      n_items = candidate->n_rows * candidate->n_cols;
+  int32_t  head[4] = { candidate->page_index, candidate->n_pages,
+                       candidate->n_rows,     candidate->n_cols };
+  uint32_t len     = sizeof head;
+
+  if (!candidate->table)
+    n_items = head[2] = head[3] = 0;
+
+  for (int i = 0; i < n_items; i++)
+  {
+    len += 2 * sizeof (int32_t);
+
+    if (candidate->table[i] && candidate->table[i]->type == CIM_ITEM_STRING)
+      len += strlen (candidate->table[i]->data);
+  }
+
+  if (sic->conn->dead ||
+      !cim_ipc_begin (ipc, CIM_MSG_CANDIDATE_CHANGED, sic->id, len))
+  {
+    sic->conn->dead = true;
+    return;
+  }
+
+  cim_ipc_write (ipc, head, sizeof head);
+
+  for (int i = 0; i < n_items; i++)
+  {
+    const CimItem* item = candidate->table[i];
+    int32_t        type = -1;
+    uint32_t       size = 0;
+
+    if (item && item->type == CIM_ITEM_STRING)
+    {
+      type = item->type;
+      size = strlen (item->data);
+    }
+
+    cim_ipc_write (ipc, &type, sizeof type);
+    cim_ipc_write (ipc, &size, sizeof size);
+
+    if (size)
+      cim_ipc_write (ipc, item->data, size);
+  }
+
+  if (!cim_ipc_end (ipc))
+    sic->conn->dead = true;
+}
+
+/*
+ * Answers CIM_MSG_GET_CANDIDATES with as many of the asked items as fit
+ * in the ring.  Returns the number sent.
+ */
+static int cim_server_send_candidates (CimServerIc* sic,
+                                       int          index,
+                                       int          n_items)
+{
+  CimIpc*  ipc = &sic->conn->ipc;
+  CimItem* items;
+  bool     exact;
+  int32_t  head[4];
+  uint32_t len = sizeof head;
+  int      n;
+
+  n_items = C_MIN (C_MAX (n_items, 0), 4096);
+  items   = c_calloc (C_MAX (n_items, 1), sizeof (CimItem));
+
+  head[0] = cim_ic_get_n_candidates (sic->ic, &exact);
+  head[1] = exact;
+  head[2] = index;
+  n = index >= 0 ? cim_ic_get_candidates (sic->ic, index, n_items, items) : 0;
+
+  for (head[3] = 0; head[3] < n; head[3]++)
+  {
+    uint32_t size = 2 * sizeof (int32_t) + 1;
+
+    if (items[head[3]].type == CIM_ITEM_STRING)
+      size += strlen (items[head[3]].data);
+
+    if (len + size > CIM_RING_SIZE / 2)
+      break;
+
+    len += size;
+  }
+
+  if (sic->conn->dead ||
+      !cim_ipc_begin (ipc, CIM_MSG_CANDIDATES, sic->id, len))
+  {
+    sic->conn->dead = true;
+    free (items);
+    return 0;
+  }
+
+  cim_ipc_write (ipc, head, sizeof head);
+
+  for (int i = 0; i < head[3]; i++)
+  {
+    const char* text = "";
+    int32_t     type = items[i].type;
+    uint32_t    size;
+
+    if (type == CIM_ITEM_STRING)
+      text = items[i].data;
+
+    size = strlen (text) + 1;
+    cim_ipc_write (ipc, &type, sizeof type);
+    cim_ipc_write (ipc, &size, sizeof size);
+    cim_ipc_write (ipc, text, size);
+  }
+
+  if (!cim_ipc_end (ipc))
+    sic->conn->dead = true;
+
+  free (items);
+
+  return head[3];
+}
+
+static void cim_server_ic_create (CimServerIc* sic)
+{
+  CimCallbacks callbacks = {
+    .preedit_start     = (void*) cb_preedit_start,
+    .preedit_end       = (void*) cb_preedit_end,
+    .preedit_changed   = (void*) cb_preedit_changed,
+    .commit            = (void*) cb_commit,
+    .get_surround      = (void*) cb_get_surround,
+    .delete_surround   = (void*) cb_delete_surround,
+    .candidate_start   = (void*) cb_candidate_start,
+    .candidate_end     = (void*) cb_candidate_end,
+    .candidate_changed = (void*) cb_candidate_changed,
+    .interest_changed  = (void*) cb_interest_changed
+  };
+  CimInterest interest;
+
+  sic->ic = cim_ic_new ();
+  cim_ic_set_callbacks (sic->ic, &callbacks, sic);
+  /* the engine may have set it in cim_ic_new () */
+  cim_ic_set_content_type (sic->ic, sic->purpose, sic->hints);
+  cim_ic_get_interest (sic->ic, &interest);
+  cb_interest_changed (sic->ic, &interest, sic);
+}
+
+static void cim_server_ic_free (CimServerIc* sic)
+{
+  cim_ic_free (sic->ic);
+  free (sic->surround.text);
+  free (sic);
+}
+
+static CimServerIc* cim_conn_lookup (CimConn* conn, uint32_t id)
+{
+  for (unsigned i = 0; i < conn->ics->len; i++)
+  {
+    CimServerIc* sic = conn->ics->data[i];
+
+    if (sic->id == id)
+      return sic;
+  }
+
+  return NULL;
+}
+
+/* Handles a request and answers it with CIM_MSG_DONE. */
+static void cim_conn_dispatch (CimConn* conn)
+{
+  CimMsg       msg    = conn->ipc.msg;
+  CimServerIc* sic    = cim_conn_lookup (conn, msg.ic_id);
+  uint32_t     retval = 0;
+
+  if (msg.type == CIM_MSG_IC_NEW && !sic)
+  {
+    sic = c_calloc (1, sizeof (CimServerIc));
+    sic->conn = conn;
+    sic->id   = msg.ic_id;
+    cim_server_ic_create (sic);
+    c_array_add (conn->ics, sic);
+    retval = 1;
+  }
+  else if (msg.type == CIM_MSG_IC_FREE)
+  {
+    if (sic)
+      c_array_remove (conn->ics, sic);
+
+    return;
+  }
+  else if (sic)
+  {
+    switch (msg.type)
+    {
+      case CIM_MSG_FOCUS_IN:
+        /* the client cannot tell that cim.so has been reloaded */
+        if (!cim_ic_is_current (sic->ic))
+        {
+          cim_ic_free (sic->ic);
+          cim_server_ic_create (sic);
+        }
+
+        cim_ic_focus_in (sic->ic);
+        break;
+      case CIM_MSG_FOCUS_OUT:
+        cim_ic_focus_out (sic->ic);
+        break;
+      case CIM_MSG_RESET:
+        cim_ic_reset (sic->ic);
+        break;
+      case CIM_MSG_FILTER_EVENT:
+        if (msg.len == sizeof (CimEvent))
+        {
+          CimEvent event;
+
+          memcpy (&event, conn->ipc.payload, sizeof event);
+          cim_ic_take_repeats_left (sic->ic);
+          retval  = cim_ic_filter_event (sic->ic, &event);
+          retval |= cim_ic_take_repeats_left (sic->ic) << 1;
+        }
+        break;
+      case CIM_MSG_SET_CURSOR_POS:
+        if (msg.len == sizeof (CimRect))
+        {
+          CimRect area;
+
+          memcpy (&area, conn->ipc.payload, sizeof area);
+          cim_ic_set_cursor_pos (sic->ic, &area);
+        }
+        break;
+      case CIM_MSG_SET_CONTENT_TYPE:
+        if (msg.len == 2 * sizeof (uint32_t))
+        {
+          uint32_t args[2];
+
+          memcpy (args, conn->ipc.payload, sizeof args);
+          sic->purpose = args[0];
+          sic->hints   = args[1];
+          cim_ic_set_content_type (sic->ic, args[0], args[1]);
+        }
+        break;
+      case CIM_MSG_GET_CANDIDATES:
+        if (msg.len == 2 * sizeof (int32_t))
+        {
+          int32_t args[2];
+
+          memcpy (args, conn->ipc.payload, sizeof args);
+          retval = cim_server_send_candidates (sic, args[0], args[1]);
+        }
+        break;
+      default:
+        break;
+    }
+  }
+
+  if (!conn->dead &&
+      !cim_ipc_send (&conn->ipc, CIM_MSG_DONE, msg.ic_id, &retval,
+                     sizeof retval))
+    conn->dead = true;
+}
+
+/*
+ * The client sends its shared memory after connecting.  The connection
+ * waits for it in the poll set, so a client that never sends it does not
+ * hold up the others.
+ */
+static CimConn* cim_conn_new (int sock)
+{
+  CimConn* conn;
+
+  if (!cim_ipc_peer_is_same_user (sock))
+    return NULL;
+
+  conn = c_calloc (1, sizeof (CimConn));
+  conn->ipc.fd = sock;
+  conn->ics    = c_array_new ((CFreeFunc) cim_server_ic_free, true);
+
+  return conn;
+}
+
+/* Maps the shared memory once it has come in and says hello. */
+static bool cim_conn_accept_shm (CimConn* conn)
+{
+  CimShm*     shm;
+  struct stat st;
+  int         memfd;
+  uint32_t    hello[2] = { CIM_IPC_VERSION, cim_server_caps };
+
+  if ((memfd = cim_ipc_recv_fd (conn->ipc.fd)) < 0)
+    return false;
+
+  if (fstat (memfd, &st) || st.st_size < sizeof (CimShm))
+  {
+    close (memfd);
+    return false;
+  }
+
+  shm = mmap (NULL, sizeof (CimShm), PROT_READ | PROT_WRITE, MAP_SHARED,
+              memfd, 0);
+  close (memfd);
+
+  if (shm == MAP_FAILED)
+    return false;
+
+  conn->shm = shm;
+  cim_ipc_init (&conn->ipc, conn->ipc.fd, shm, true);
+
+  return cim_ipc_send (&conn->ipc, CIM_MSG_HELLO, 0, hello, sizeof hello);
+}
+
+static void cim_conn_free (CimConn* conn)
+{
+  c_array_free (conn->ics);
+  cim_ipc_clear (&conn->ipc);
+
+  if (conn->shm)
+    munmap (conn->shm, sizeof (CimShm));
+
+  free (conn);
+}
+
+static int cim_server_listen (const char* path)
+{
+  struct sockaddr_un addr = { .sun_family = AF_UNIX };
+  int sock;
+
+  if (strlen (path) >= sizeof addr.sun_path)
+  {
+    fprintf (stderr, "cim-server: socket path too long: %s\n", path);
+    return -1;
+  }
+
+  strcpy (addr.sun_path, path);
+
+  if ((sock = socket (AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0)) < 0)
+    return -1;
+
+  /* refuse to replace a server that is still answering */
+  if (!connect (sock, (struct sockaddr*) &addr, sizeof addr))
+  {
+    fprintf (stderr, "cim-server: already running on %s\n", path);
+    close (sock);
+    return -1;
+  }
+
+  close (sock);
+  unlink (path);
+
+  if ((sock = socket (AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0)) < 0)
+    return -1;
+
+  if (bind (sock, (struct sockaddr*) &addr, sizeof addr) ||
+      chmod (path, 0600) || listen (sock, 16))
+  {
+    fprintf (stderr, "cim-server: %s: %s\n", path, strerror (errno));
+    close (sock);
+    return -1;
+  }
+
+  return sock;
+}
+
+/* Takes a new client; it is served once it has sent its shared memory. */
+static void cim_server_accept ()
+{
+  CimConn* conn;
+  int      fd;
+
+  if ((fd = accept (cim_server_sock, NULL, NULL)) < 0)
+    return;
+
+  fcntl (fd, F_SETFD, FD_CLOEXEC);
+
+  if ((conn = cim_conn_new (fd)))
+    c_array_add (cim_server_conns, conn);
+  else
+    close (fd);
+}
+
+/*
+ * Polls the connections once and serves what has come in.  While waiter
+ * waits for an answer, the connections waiting in the frames above are
+ * left alone and engine wakeups wait for the main loop.  Dead connections
+ * are only freed by the main loop, since the frames above may hold them.
+ * Returns false if poll() fails.
+ */
+static bool cim_server_iterate (CimConn* waiter, int timeout)
+{
+  C_VEC (struct pollfd, 16) pfds;
+  C_VEC (CimConn*, 16)      polled;
+  int                       n_ready;
+
+  c_vec_init (&pfds);
+  c_vec_init (&polled);
+
+  c_vec_push (&pfds, ((struct pollfd) { cim_server_sock, POLLIN, 0 }));
+  /* poll() skips a negative fd */
+  c_vec_push (&pfds, ((struct pollfd) { waiter ? -1 : cim_server_async_fd,
+                                        POLLIN, 0 }));
+
+  for (unsigned i = 0; i < cim_server_conns->len; i++)
+  {
+    CimConn* conn = cim_server_conns->data[i];
+
+    if (conn->dead || (conn->waiting && conn != waiter))
+      continue;
+
+    c_vec_push (&pfds, ((struct pollfd) { conn->ipc.fd, POLLIN, 0 }));
+    c_vec_push (&polled, conn);
+  }
+
+  if ((n_ready = poll (pfds.data, pfds.len, timeout)) > 0)
+  {
+    for (unsigned i = 0; i < polled.len; i++)
+    {
+      CimConn* conn = polled.data[i];
+
+      if (!pfds.data[i + 2].revents)
+        continue;
+
+      if (!conn->shm)
+      {
+        if (!cim_conn_accept_shm (conn))
+          conn->dead = true;
+      }
+      else if (!cim_ipc_read (&conn->ipc, 0))
+      {
+        conn->dead = true;
+      }
+      else if (conn == waiter && conn->ipc.msg.type == conn->waiting)
+      {
+        conn->answered = true;
+      }
+      else
+      {
+        cim_conn_dispatch (conn);
+      }
+    }
+
+    if (pfds.data[1].revents & POLLIN)
+      cim_dispatch ();
+
+    if (pfds.data[0].revents & POLLIN)
+      cim_server_accept ();
+  }
+
+  c_vec_fini (&pfds);
+  c_vec_fini (&polled);
+
+  return n_ready >= 0 || errno == EINTR;
+}
+
+static void on_signal (int signo)
+{
+  cim_server_quit = 1;
+}
+
+int main (int argc, char** argv)
+{
+  struct sigaction sa = { .sa_handler = on_signal };
+  CimIc*           probe;
+  char*            path;
+
+  if (!(path = cim_ipc_get_socket_path ()))
+  {
+    fprintf (stderr, "cim-server: set XDG_RUNTIME_DIR or CIM_SERVER\n");
+    return 1;
+  }
+
+  if ((cim_server_sock = cim_server_listen (path)) < 0)
+  {
+    free (path);
+    return 1;
+  }
+
+  /* This process runs the engine itself. */
+  setenv ("CIM_SERVER", "", 1);
+
+  sigaction (SIGINT,  &sa, NULL);
+  sigaction (SIGTERM, &sa, NULL);
+  signal (SIGPIPE, SIG_IGN);
+
+  /* loads cim.so and its data before the first client comes */
+  probe = cim_ic_new ();
+  cim_server_caps = cim_ic_get_caps (probe);
+  cim_ic_free (probe);
+
+  /* candidate prefetches run from cim_dispatch() */
+  cim_server_async_fd = cim_get_async_fd ();
+
+  cim_server_conns = c_array_new ((CFreeFunc) cim_conn_free, true);
+
+  while (!cim_server_quit && cim_server_iterate (NULL, -1))
+  {
+    for (unsigned i = cim_server_conns->len; i > 0; i--)
+    {
+      CimConn* conn = cim_server_conns->data[i - 1];
+
+      if (conn->dead)
+        c_array_remove_index (cim_server_conns, i - 1);
+    }
+  }
+
+  c_array_free (cim_server_conns);
+  close (cim_server_sock);
+  unlink (path);
+  free (path);
+  cim_finalize ();
+
+  return 0;
+}
@@ -0,0 +1,119 @@
+/* -*- Mode: C; indent-tabs-mode: nil; c-basic-offset: 2; tab-width: 2 -*- */
+/*
+ * c-array-bench.c
+ * This file is part of Cim.
+ *
+ * Copyright (C) 2023 Hodong Kim <hodong@nimfsoft.art>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+#include "c-array.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/*
+ * Time to build and free a pointer array of n elements with CArray, with
+ * CArray given its size up front, and with a plain array that calls
+ * realloc () on every element, as code without a growth policy does.
+ *
+ * Usage: c-array-bench [n_rounds]
+ * Run it through "make bench".
+ */
+
+static double c_bench_now ()
+{
+  struct timespec ts;
+
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static char           c_bench_item;
+static void *volatile c_bench_sink;
+
+static void c_bench_array (unsigned n)
+{
+  CArray *array = c_array_new (NULL, false);
+
+  for (unsigned i = 0; i < n; i++)
+    c_array_add (array, &c_bench_item);
+
+  c_bench_sink = array->data[n - 1];
+  free (c_array_free (array));
+}
+
+static void c_bench_sized (unsigned n)
+{
+  CArray *array = c_array_sized_new (NULL, false, n);
+
+  for (unsigned i = 0; i < n; i++)
+    c_array_add (array, &c_bench_item);
+
+  c_bench_sink = array->data[n - 1];
+  free (c_array_free (array));
+}
+
+static void c_bench_realloc (unsigned n)
+{
+  void **data = NULL;
+
+  for (unsigned i = 0; i < n; i++)
+  {
+    data    = realloc (data, (i + 1) * sizeof (void *));
+    data[i] = &c_bench_item;
+  }
+
+  c_bench_sink = data[n - 1];
+  free (data);
+}
+
+/* Returns nanoseconds per array. */
+static double c_bench_run (void (*build) (unsigned), unsigned n, int n_rounds)
+{
+  double start = c_bench_now ();
+
+  for (int i = 0; i < n_rounds; i++)
+    build (n);
+
+  return (c_bench_now () - start) / n_rounds;
+}
+
+int main (int argc, char **argv)
+{
+  static const unsigned sizes[] = { 4, 8, 64, 1024 };
+
+  int n_rounds = argc > 1 ? atoi (argv[1]) : 100000;
+
+  if (n_rounds < 1)
+  {
+    fprintf (stderr, "Usage: %s [n_rounds]\n", argv[0]);
+    return 1;
+  }
+
+  printf ("pointer arrays, %d rounds, in ns per array\n", n_rounds);
+  printf ("%-10s %10s %10s %10s\n", "elements", "CArray", "sized",
+          "realloc");
+
+  for (unsigned i = 0; i < sizeof sizes / sizeof sizes[0]; i++)
+  {
+    int rounds = sizes[i] > 64 ? n_rounds / 16 : n_rounds;
+
+    printf ("%-10u %10.1f %10.1f %10.1f\n", sizes[i],
+            c_bench_run (c_bench_array,   sizes[i], rounds),
+            c_bench_run (c_bench_sized,   sizes[i], rounds),
+            c_bench_run (c_bench_realloc, sizes[i], rounds));
+  }
+
+  return 0;
+}
@@ -0,0 +1,175 @@
+/* -*- Mode: C; indent-tabs-mode: nil; c-basic-offset: 2; tab-width: 2 -*- */
+/*
+ * c-array-test.c
+ * This file is part of Cim.
+ *
+ * Copyright (C) 2023 Hodong Kim <hodong@nimfsoft.art>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+#include "c-array.h"
+#include "c-str.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/*
+ * CArray keeps its first elements inside the array header and moves them
+ * to the heap as it grows; the vectors it hands out are always heap
+ * blocks of their own.  Run it through "make check".
+ */
+
+static int c_test_n_failed;
+
+static void c_test_check (bool ok, const char *what)
+{
+  printf ("%s: %s\n", ok ? "ok" : "FAILED", what);
+
+  if (!ok)
+    c_test_n_failed++;
+}
+
+static bool c_test_holds (CArray *array, unsigned n)
+{
+  if (array->len != n)
+    return false;
+
+  for (unsigned i = 0; i < n; i++)
+    if (array->data[i] != (void *) (uintptr_t) (i + 1))
+      return false;
+
+  return true;
+}
+
+static void c_test_inline_to_heap ()
+{
+  CArray *array = c_array_new (NULL, false);
+  void  **data;
+  void  **inline_data = array->data;
+
+  for (unsigned i = 0; i < C_ARRAY_N_INLINE; i++)
+    c_array_add (array, (void *) (uintptr_t) (i + 1));
+
+  c_test_check (array->data == inline_data &&
+                c_test_holds (array, C_ARRAY_N_INLINE),
+                "inline up to C_ARRAY_N_INLINE");
+
+  c_array_add (array, (void *) (uintptr_t) (C_ARRAY_N_INLINE + 1));
+
+  c_test_check (array->data != inline_data &&
+                c_test_holds (array, C_ARRAY_N_INLINE + 1),
+                "on the heap after one more");
+
+  for (unsigned i = C_ARRAY_N_INLINE + 1; i < 100; i++)
+    c_array_add (array, (void *) (uintptr_t) (i + 1));
+
+  c_test_check (c_test_holds (array, 100), "grown to 100");
+
+  c_array_remove_index (array, 0);
+  c_test_check (array->len == 99 && array->data[0] == (void *) 2,
+                "removed the first");
+
+  data = c_array_free (array);
+  c_test_check (data && data[98] == (void *) 100,
+                "c_array_free hands out the heap data");
+  free (data);
+
+  /* an inline array is copied out, and the copy outlives the array */
+  array = c_array_new (NULL, false);
+  c_array_add (array, (void *) 1);
+  inline_data = array->data;
+  data = c_array_free (array);
+  c_test_check (data && data != inline_data && data[0] == (void *) 1,
+                "c_array_free copies inline data out");
+  free (data);
+}
+
+static void c_test_free_strv ()
+{
+  static const char *words[] = { "one", "two", "three" };
+
+  CArray *array;
+  void  **reserved;
+  char  **strv;
+
+  /* inline: copied out with the terminator */
+  array = c_array_new (NULL, false);
+
+  for (int i = 0; i < 3; i++)
+    c_array_add (array, c_strdup (words[i]));
+
+  strv = c_array_free_strv (array);
+  c_test_check (strv && !strcmp (strv[0], "one") && !strcmp (strv[2], "three")
+                && !strv[3], "strv from inline data");
+  c_strv_free (strv);
+
+  /* a full inline array moves to the heap for the terminator */
+  array = c_array_new (NULL, false);
+
+  for (int i = 0; i < C_ARRAY_N_INLINE; i++)
+    c_array_add (array, c_strdup (words[i % 3]));
+
+  strv = c_array_free_strv (array);
+  c_test_check (strv && !strcmp (strv[C_ARRAY_N_INLINE - 1],
+                                 words[(C_ARRAY_N_INLINE - 1) % 3]) &&
+                !strv[C_ARRAY_N_INLINE], "strv from a full inline array");
+  c_strv_free (strv);
+
+  /* reserved room: the vector is the block made by c_array_sized_new */
+  array    = c_array_sized_new (NULL, false, 17);
+  reserved = array->data;
+
+  for (int i = 0; i < 16; i++)
+    c_array_add (array, c_strdup (words[i % 3]));
+
+  strv = c_array_free_strv (array);
+  c_test_check ((void **) strv == reserved && !strcmp (strv[15], "one") &&
+                !strv[16], "strv steals the reserved block");
+  c_strv_free (strv);
+
+  /* an empty array is an empty vector */
+  strv = c_array_free_strv (c_array_new (NULL, false));
+  c_test_check (strv && !strv[0], "strv from an empty array");
+  c_strv_free (strv);
+}
+
+static void c_test_vec ()
+{
+  C_VEC (int, 4) vec;
+  bool ok = true;
+
+  c_vec_init (&vec);
+
+  for (int i = 0; i < 4; i++)
+    c_vec_push (&vec, i);
+
+  ok = vec.data == vec.inline_data;
+
+  for (int i = 4; i < 1000; i++)
+    c_vec_push (&vec, i);
+
+  for (int i = 0; i < 1000; i++)
+    ok = ok && vec.data[i] == i;
+
+  c_test_check (ok && vec.data != vec.inline_data && vec.len == 1000,
+                "C_VEC moves from inline to the heap");
+  c_vec_fini (&vec);
+}
+
+int main ()
+{
+  c_test_inline_to_heap ();
+  c_test_free_strv ();
+  c_test_vec ();
+
+  return c_test_n_failed ? 1 : 0;
+}
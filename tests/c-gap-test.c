@@ -0,0 +1,276 @@
+/* -*- Mode: C; indent-tabs-mode: nil; c-basic-offset: 2; tab-width: 2 -*- */
+/*
+ * c-gap-test.c
+ * This file is part of Cim.
+ *
+ * Copyright (C) 2023 Hodong Kim <hodong@nimfsoft.art>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+#include "c-gap.h"
+#include "c-str.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/*
+ * CGapBuffer against a plain array of characters that is edited the same
+ * way.  Run it through "make check".
+ */
+
+static int c_test_n_failed;
+
+static void c_test_check (bool ok, const char *what)
+{
+  printf ("%s: %s\n", ok ? "ok" : "FAILED", what);
+
+  if (!ok)
+    c_test_n_failed++;
+}
+
+/* Returns true if gb holds text, NUL-terminated, with the cursor at cursor. */
+static bool c_test_holds (CGapBuffer *gb, const char *text, int cursor)
+{
+  int         cursor_pos;
+  const char *got = c_gap_buffer_get_text (gb, &cursor_pos);
+
+  return !strcmp (got, text) && cursor_pos == cursor &&
+         c_gap_buffer_get_len (gb) == strlen (text);
+}
+
+static void c_test_cursor_edits ()
+{
+  CGapBuffer gb = C_GAP_BUFFER_INIT;
+
+  c_test_check (c_test_holds (&gb, "", 0), "an empty buffer is \"\"");
+  c_test_check (!c_gap_buffer_delete (&gb, -1) && !c_gap_buffer_delete (&gb, 1),
+                "nothing to delete in an empty buffer");
+
+  c_gap_buffer_insert (&gb, "abcdef", -1);
+  c_gap_buffer_set_cursor (&gb, 2);
+  c_gap_buffer_insert (&gb, "XY", 2);
+  c_test_check (c_test_holds (&gb, "abXYcdef", 4), "insert at a set cursor");
+
+  c_gap_buffer_move_cursor (&gb, 2);
+  c_test_check (c_gap_buffer_delete (&gb, 1) == 1 &&
+                c_test_holds (&gb, "abXYcdf", 6), "delete after the cursor");
+
+  c_gap_buffer_move_cursor (&gb, -5);
+  c_test_check (c_gap_buffer_delete (&gb, -1) == 1 &&
+                c_test_holds (&gb, "bXYcdf", 0), "delete before the cursor");
+
+  c_test_check (c_gap_buffer_delete (&gb, -3) == 0 &&
+                c_gap_buffer_delete (&gb, 10) == 6 &&
+                c_test_holds (&gb, "", 0), "deletes stop at the ends");
+
+  c_gap_buffer_insert (&gb, "xyz", -1);
+  c_gap_buffer_move_cursor (&gb, -100);
+  c_gap_buffer_insert (&gb, "<", -1);
+  c_gap_buffer_move_cursor (&gb, 100);
+  c_gap_buffer_insert (&gb, ">", -1);
+  c_test_check (c_test_holds (&gb, "<xyz>", 5), "moves stop at the ends");
+
+  c_gap_buffer_clear (&gb);
+  c_test_check (c_test_holds (&gb, "", 0), "clear");
+
+  c_gap_buffer_fini (&gb);
+}
+
+static void c_test_multibyte ()
+{
+  CGapBuffer gb = C_GAP_BUFFER_INIT;
+
+  /* 한, 글, U+1F600 and é */
+  c_gap_buffer_insert (&gb, "\xed\x95\x9c\xea\xb8\x80", -1);
+  c_gap_buffer_insert_c (&gb, 0x1f600);
+  c_gap_buffer_insert_c (&gb, 0xe9);
+  c_test_check (c_test_holds (&gb, "\xed\x95\x9c\xea\xb8\x80"
+                                   "\xf0\x9f\x98\x80\xc3\xa9", 4) &&
+                gb.n_chars == 4, "characters of 1 to 4 bytes");
+
+  c_gap_buffer_move_cursor (&gb, -2);
+  c_gap_buffer_insert (&gb, "a", -1);
+  c_test_check (c_test_holds (&gb, "\xed\x95\x9c\xea\xb8\x80" "a"
+                                   "\xf0\x9f\x98\x80\xc3\xa9", 3),
+                "a move goes by whole characters");
+
+  c_gap_buffer_set_cursor (&gb, 1);
+  c_test_check (c_gap_buffer_delete (&gb, 2) == 2 &&
+                c_test_holds (&gb, "\xed\x95\x9c\xf0\x9f\x98\x80\xc3\xa9", 1),
+                "delete after the cursor takes whole characters");
+
+  c_gap_buffer_move_cursor (&gb, 1);
+  c_test_check (c_gap_buffer_delete (&gb, -2) == 2 &&
+                c_test_holds (&gb, "\xc3\xa9", 0) && gb.n_chars == 1,
+                "delete before the cursor takes whole characters");
+
+  c_gap_buffer_fini (&gb);
+}
+
+static void c_test_shrink ()
+{
+  CGapBuffer gb = C_GAP_BUFFER_INIT;
+  size_t     capa;
+  bool       ok = true;
+
+  for (int i = 0; i < 10000; i++)
+    c_gap_buffer_insert_c (&gb, 'a' + i % 26);
+
+  capa = gb.capa;
+  c_gap_buffer_set_cursor (&gb, 10);
+  c_test_check (c_gap_buffer_delete (&gb, 9980) == 9980 && gb.capa < capa &&
+                gb.capa >= c_gap_buffer_get_len (&gb) + 1,
+                "a large delete gives memory back");
+
+  c_gap_buffer_insert (&gb, "!", -1);
+  c_test_check (c_test_holds (&gb, "abcdefghij!" "ghijklmnop", 11),
+                "the text survives the shrink");
+
+  /* erasing and retyping around one size does not realloc */
+  capa = gb.capa;
+
+  for (int i = 0; i < 1000; i++)
+  {
+    c_gap_buffer_insert (&gb, "0123456789", -1);
+    ok = ok && c_gap_buffer_delete (&gb, -10) == 10;
+  }
+
+  c_test_check (ok && gb.capa == capa, "no churn at a steady size");
+
+  c_gap_buffer_fini (&gb);
+}
+
+/* get_text moves the gap to the end; edits must move it back */
+static void c_test_get_text ()
+{
+  CGapBuffer  gb = C_GAP_BUFFER_INIT;
+  const char *text;
+  int         cursor_pos;
+
+  c_gap_buffer_insert (&gb, "hello world", -1);
+  c_gap_buffer_set_cursor (&gb, 5);
+  text = c_gap_buffer_get_text (&gb, &cursor_pos);
+  c_test_check (!strcmp (text, "hello world") && cursor_pos == 5 &&
+                text[11] == 0, "the cursor stays and the NUL ends the text");
+
+  c_gap_buffer_insert (&gb, ",", -1);
+  c_test_check (c_test_holds (&gb, "hello, world", 6),
+                "insert after get_text");
+
+  c_gap_buffer_delete (&gb, 7);
+  c_test_check (c_test_holds (&gb, "hello,", 6), "delete after get_text");
+
+  /* a full buffer still has room for the NUL */
+  c_gap_buffer_clear (&gb);
+
+  while (c_gap_buffer_get_len (&gb) + 1 < gb.capa)
+    c_gap_buffer_insert (&gb, "x", 1);
+
+  text = c_gap_buffer_get_text (&gb, NULL);
+  c_test_check (strlen (text) == gb.capa - 1, "the NUL of a full buffer");
+
+  c_gap_buffer_fini (&gb);
+}
+
+static uint32_t c_test_random (uint32_t *state)
+{
+  *state ^= *state << 13;
+  *state ^= *state >> 17;
+  *state ^= *state << 5;
+
+  return *state;
+}
+
+/* random edits, checked against an array of characters after each one */
+static void c_test_random_edits ()
+{
+  static const char32_t chars[] = { 'a', 'z', 0xe9, 0xd55c, 0x1f600 };
+
+  static char32_t model[4096];
+  static char     text[4 * 4096 + 1];
+
+  CGapBuffer gb     = C_GAP_BUFFER_INIT;
+  uint32_t   state  = 0x2023;
+  int        len    = 0;
+  int        cursor = 0;
+  bool       ok     = true;
+
+  for (int round = 0; round < 20000 && ok; round++)
+  {
+    uint32_t r = c_test_random (&state);
+    int      n = r / 8 % 40;
+    int      k = 0;
+
+    switch (r % 8)
+    {
+      case 0: case 1: case 2:
+        n = C_MIN (n, 4096 - len);
+        memmove (model + cursor + n, model + cursor,
+                 (len - cursor) * sizeof (char32_t));
+
+        for (int i = 0; i < n; i++)
+        {
+          model[cursor + i] = chars[c_test_random (&state) % 5];
+          c_gap_buffer_insert_c (&gb, model[cursor + i]);
+        }
+
+        len    += n;
+        cursor += n;
+        break;
+      case 3: case 4:
+        n = C_MIN (n, len - cursor);
+        ok = c_gap_buffer_delete (&gb, n) == (size_t) n;
+        memmove (model + cursor, model + cursor + n,
+                 (len - cursor - n) * sizeof (char32_t));
+        len -= n;
+        break;
+      case 5:
+        n = C_MIN (n, cursor);
+        ok = c_gap_buffer_delete (&gb, -n) == (size_t) n;
+        memmove (model + cursor - n, model + cursor,
+                 (len - cursor) * sizeof (char32_t));
+        len    -= n;
+        cursor -= n;
+        break;
+      case 6:
+        cursor = len ? r / 8 % (len + 1) : 0;
+        c_gap_buffer_set_cursor (&gb, cursor);
+        break;
+      default:
+        n = (int) (r / 8 % 21) - 10;
+        c_gap_buffer_move_cursor (&gb, n);
+        cursor = C_MIN (C_MAX (cursor + n, 0), len);
+        break;
+    }
+
+    for (int i = 0; i < len; i++)
+      k += c_char32_to_utf8_with_buf (model[i], text + k);
+
+    text[k] = 0;
+    ok = ok && c_test_holds (&gb, text, cursor) && gb.n_chars == (size_t) len;
+  }
+
+  c_test_check (ok, "20000 random edits match a plain array");
+
+  c_gap_buffer_fini (&gb);
+}
+
+int main ()
+{
+  c_test_cursor_edits ();
+  c_test_multibyte ();
+  c_test_shrink ();
+  c_test_get_text ();
+  c_test_random_edits ();
+
+  return c_test_n_failed ? 1 : 0;
+}
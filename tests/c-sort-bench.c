@@ -0,0 +1,143 @@
+/* -*- Mode: C; indent-tabs-mode: nil; c-basic-offset: 2; tab-width: 2 -*- */
+/*
+ * c-sort-bench.c
+ * This file is part of Cim.
+ *
+ * Copyright (C) 2023 Hodong Kim <hodong@nimfsoft.art>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+#include "c-array.h"
+#include "c-str.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/*
+ * Time to sort 50,000 candidate-like texts, ASCII and Hangul with shared
+ * leading syllables, with c_array_sort_by_key () and with c_array_sort ()
+ * calling c_utf8_collate () for every comparison.
+ *
+ * Usage: c-sort-bench [n_rounds]
+ * Run it through "make bench".
+ */
+
+#define C_BENCH_N        50000
+#define C_BENCH_NAME_MAX 32
+
+static char c_bench_names[C_BENCH_N][C_BENCH_NAME_MAX];
+
+static double c_bench_now ()
+{
+  struct timespec ts;
+
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void c_bench_make_names (bool hangul)
+{
+  uint32_t state = 0x2023;
+
+  for (unsigned i = 0; i < C_BENCH_N; i++)
+  {
+    char  *name = c_bench_names[i];
+    size_t len  = 0;
+
+    for (unsigned k = 0; k < 6; k++)
+    {
+      state ^= state << 13;
+      state ^= state >> 17;
+      state ^= state << 5;
+
+      if (hangul)
+      {
+        /* a few leading syllables, as with the candidates of a reading */
+        uint32_t c = 0xac00 + (k < 2 ? state % 4 : state % 11172);
+
+        name[len++] = 0xe0 | c >> 12;
+        name[len++] = 0x80 | (c >> 6 & 0x3f);
+        name[len++] = 0x80 | (c & 0x3f);
+      }
+      else
+      {
+        name[len++] = 'a' + (k < 2 ? state % 4 : state % 26);
+      }
+    }
+
+    name[len] = 0;
+  }
+}
+
+static const char *c_bench_key (const void *data)
+{
+  return data;
+}
+
+static int c_bench_compare (const void *a, const void *b)
+{
+  return c_utf8_collate (*(const char **) a, *(const char **) b);
+}
+
+/* Returns milliseconds per sort. */
+static double c_bench_run (bool by_key, int n_rounds)
+{
+  double elapsed = 0;
+
+  for (int i = 0; i < n_rounds; i++)
+  {
+    CArray *array = c_array_sized_new (NULL, false, C_BENCH_N);
+    double  start;
+
+    for (unsigned k = 0; k < C_BENCH_N; k++)
+      c_array_add (array, c_bench_names[k]);
+
+    start = c_bench_now ();
+
+    if (by_key)
+      c_array_sort_by_key (array, c_bench_key);
+    else
+      c_array_sort (array, c_bench_compare);
+
+    elapsed += c_bench_now () - start;
+    free (c_array_free (array));
+  }
+
+  return elapsed / n_rounds / 1e6;
+}
+
+int main (int argc, char **argv)
+{
+  int n_rounds = argc > 1 ? atoi (argv[1]) : 10;
+
+  if (n_rounds < 1)
+  {
+    fprintf (stderr, "Usage: %s [n_rounds]\n", argv[0]);
+    return 1;
+  }
+
+  printf ("sorting %d texts, %d rounds, in ms per sort\n", C_BENCH_N,
+          n_rounds);
+  printf ("%-8s %12s %12s\n", "text", "by key", "collate");
+
+  for (int hangul = 0; hangul < 2; hangul++)
+  {
+    c_bench_make_names (hangul);
+    printf ("%-8s %12.2f %12.2f\n", hangul ? "Hangul" : "ASCII",
+            c_bench_run (true, n_rounds), c_bench_run (false, n_rounds));
+  }
+
+  return 0;
+}
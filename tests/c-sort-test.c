@@ -0,0 +1,232 @@
+/* -*- Mode: C; indent-tabs-mode: nil; c-basic-offset: 2; tab-width: 2 -*- */
+/*
+ * c-sort-test.c
+ * This file is part of Cim.
+ *
+ * Copyright (C) 2023 Hodong Kim <hodong@nimfsoft.art>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+#include "c-array.h"
+#include "c-str.h"
+#include "c-utf8.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/*
+ * c_array_sort_by_key () must order texts as c_utf8_collate () does, on
+ * its qsort () path for short arrays and on its radix path for long ones,
+ * and c_utf8_collate_key () must give keys that strcmp () orders the same
+ * way, malformed text included.  Run it through "make check".
+ */
+
+#define C_TEST_N_MAX    5000
+#define C_TEST_NAME_MAX 48
+
+static char c_test_names[C_TEST_N_MAX][C_TEST_NAME_MAX];
+
+static int c_test_n_failed;
+
+static void c_test_check (bool ok, const char *what)
+{
+  printf ("%s: %s\n", ok ? "ok" : "FAILED", what);
+
+  if (!ok)
+    c_test_n_failed++;
+}
+
+static int c_test_sign (int n)
+{
+  return (n > 0) - (n < 0);
+}
+
+static uint32_t c_test_random (uint32_t *state)
+{
+  *state ^= *state << 13;
+  *state ^= *state >> 17;
+  *state ^= *state << 5;
+
+  return *state;
+}
+
+/*
+ * Fills n names: some share their first eight bytes or more, some are
+ * shorter than eight bytes or empty, and some are Hangul, duplicates or
+ * malformed.
+ */
+static void c_test_make_names (unsigned n, uint32_t seed)
+{
+  static const char *heads[] = {
+    "", "a", "ab", "prefix__", "prefix__x", "\xea\xb0\x80", "\xed\x9e\xa3",
+    "\xef\xbf\xbd", "\xff", "z\x80", "\xed\xa0\x80"
+  };
+
+  uint32_t state = seed;
+
+  for (unsigned i = 0; i < n; i++)
+  {
+    uint32_t r    = c_test_random (&state);
+    char    *name = c_test_names[i];
+    size_t   len;
+
+    if (r % 16 == 0 && i > 0)
+    {
+      strcpy (name, c_test_names[r / 16 % i]);
+      continue;
+    }
+
+    strcpy (name, heads[r / 16 % (sizeof heads / sizeof (char *))]);
+    len = strlen (name);
+
+    for (unsigned k = r / 256 % 8; k > 0; k--)
+    {
+      r = c_test_random (&state);
+
+      if (r % 8 == 0)
+      {
+        memcpy (name + len, "\xeb\x8b\xa4", 3);
+        len += 3;
+      }
+      else
+      {
+        name[len++] = 'a' + r / 8 % 4;
+      }
+    }
+
+    name[len] = 0;
+  }
+}
+
+static const char *c_test_key (const void *data)
+{
+  return data;
+}
+
+/* Returns true if array holds each of the n names once, in order. */
+static bool c_test_sorted (CArray *array, unsigned n)
+{
+  static bool seen[C_TEST_N_MAX];
+
+  if (array->len != n)
+    return false;
+
+  memset (seen, 0, sizeof seen);
+
+  for (unsigned i = 0; i < n; i++)
+  {
+    unsigned index = ((char *) array->data[i] - c_test_names[0]) /
+                     C_TEST_NAME_MAX;
+
+    if (index >= n || seen[index])
+      return false;
+
+    seen[index] = true;
+
+    if (i > 0 && c_utf8_collate (array->data[i - 1], array->data[i]) > 0)
+      return false;
+  }
+
+  return true;
+}
+
+static void c_test_sort (unsigned n, bool same_prefix, const char *what)
+{
+  CArray *array = c_array_new (NULL, false);
+
+  c_test_make_names (n, n);
+
+  if (same_prefix)
+  {
+    for (unsigned i = 0; i < n; i++)
+    {
+      memmove (c_test_names[i] + 8, c_test_names[i],
+               strlen (c_test_names[i]) + 1);
+      memcpy (c_test_names[i], "prefix__", 8);
+    }
+  }
+
+  for (unsigned i = 0; i < n; i++)
+    c_array_add (array, c_test_names[i]);
+
+  c_array_sort_by_key (array, c_test_key);
+  c_test_check (c_test_sorted (array, n), what);
+
+  c_array_free (array);
+}
+
+static void c_test_collate_key ()
+{
+  static const struct {
+    const char *text;
+    const char *key;
+  } cases[] = {
+    { "",                 "" },
+    { "\xea\xb0\x80",     "\xea\xb0\x80" },
+    { "a\x80" "b",        "a\xef\xbf\xbd" "b" },
+    { "\xed\xa0\x80",     "\xef\xbf\xbd\xef\xbf\xbd\xef\xbf\xbd" },
+    { "\xc0\xaf",         "\xef\xbf\xbd\xef\xbf\xbd" },
+    { "x\xe2\x82",        "x\xef\xbf\xbd\xef\xbf\xbd" },
+    { "\xff\xfe!",        "\xef\xbf\xbd\xef\xbf\xbd!" },
+    { "\xf4\x90\x80\x80", "\xef\xbf\xbd\xef\xbf\xbd"
+                          "\xef\xbf\xbd\xef\xbf\xbd" }
+  };
+
+  bool right = true;
+  bool order = true;
+
+  for (size_t i = 0; i < sizeof cases / sizeof cases[0]; i++)
+  {
+    size_t len;
+    char  *key = c_utf8_collate_key (cases[i].text, &len);
+
+    right = right && !strcmp (key, cases[i].key) && len == strlen (key) &&
+            c_utf8_validate (key, len, NULL);
+    free (key);
+  }
+
+  c_test_check (right, "malformed bytes become U+FFFD one by one");
+
+  c_test_make_names (400, 7);
+
+  for (unsigned i = 0; i < 400; i++)
+  {
+    char *a = c_utf8_collate_key (c_test_names[i], NULL);
+
+    for (unsigned j = 0; j < 400; j += 7)
+    {
+      char *b = c_utf8_collate_key (c_test_names[j], NULL);
+
+      order = order &&
+              c_test_sign (strcmp (a, b)) ==
+              c_test_sign (c_utf8_collate (c_test_names[i], c_test_names[j]));
+      free (b);
+    }
+
+    free (a);
+  }
+
+  c_test_check (order, "strcmp () orders keys as c_utf8_collate () does");
+}
+
+int main ()
+{
+  c_test_sort (2,    false, "2 names");
+  c_test_sort (255,  false, "255 names, with qsort ()");
+  c_test_sort (256,  false, "256 names, with the radix sort");
+  c_test_sort (5000, false, "5000 names, with the radix sort");
+  c_test_sort (1000, true,  "1000 names sharing their first 8 bytes");
+
+  c_test_collate_key ();
+
+  return c_test_n_failed ? 1 : 0;
+}
@@ -0,0 +1,141 @@
+/* -*- Mode: C; indent-tabs-mode: nil; c-basic-offset: 2; tab-width: 2 -*- */
+/*
+ * c-utf8-bench.c
+ * This file is part of Cim.
+ *
+ * Copyright (C) 2023 Hodong Kim <hodong@nimfsoft.art>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+#include "c-utf8.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/*
+ * Throughput of c_utf8_validate (), c_utf8_count () and c_utf8_decode ()
+ * with each kernel the CPU has, over 64 KiB of Hangul, CJK, emoji and
+ * ASCII text.
+ *
+ * Usage: c-utf8-bench [n_rounds]
+ * Run it through "make bench".
+ */
+
+#define C_BENCH_LEN (64 * 1024)
+
+static double c_bench_now ()
+{
+  struct timespec ts;
+
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static volatile size_t c_bench_sink;
+static char32_t        c_bench_c32[C_BENCH_LEN];
+
+/* fills text with copies of sample, cut at a character */
+static size_t c_bench_fill (char *text, const char *sample)
+{
+  size_t n   = strlen (sample);
+  size_t len = 0;
+
+  while (len + n <= C_BENCH_LEN)
+  {
+    memcpy (text + len, sample, n);
+    len += n;
+  }
+
+  return len;
+}
+
+/* Returns bytes per nanosecond, which is GB/s. */
+static double c_bench_run (int what, const char *text, size_t len,
+                           int n_rounds)
+{
+  double start = c_bench_now ();
+
+  for (int i = 0; i < n_rounds; i++)
+  {
+    switch (what)
+    {
+      case 0:
+        c_bench_sink = c_utf8_validate (text, len, NULL);
+        break;
+      case 1:
+        c_bench_sink = c_utf8_count (text, len, NULL);
+        break;
+      default:
+        c_bench_sink = c_utf8_decode (text, len, c_bench_c32, C_BENCH_LEN);
+        break;
+    }
+  }
+
+  return (double) len * n_rounds / (c_bench_now () - start);
+}
+
+int main (int argc, char **argv)
+{
+  static const struct {
+    const char *name;
+    const char *sample;
+  } texts[] = {
+    { "Hangul", "\xed\x95\x9c\xea\xb8\x80\xec\x9d\x80 "
+                "\xec\x86\x8c\xeb\xa6\xac\xea\xb8\x80"
+                "\xec\x9e\x90\xeb\x8b\xa4. " },
+    { "CJK",    "\xe6\xbc\xa2\xe5\xad\x97\xe3\x81\xa8"
+                "\xe3\x81\x8b\xe3\x81\xaa\xe3\x80\x82" },
+    { "emoji",  "\xf0\x9f\x98\x80\xf0\x9f\x8e\x89\xf0\x9f\x91\x8d " },
+    { "ASCII",  "The quick brown fox jumps over the lazy dog. " }
+  };
+
+  static const char *kernels[] = { "scalar", "sse2", "avx2" };
+  static const char *whats[]   = { "validate", "count", "decode" };
+
+  static char text[C_BENCH_LEN];
+
+  int n_rounds = argc > 1 ? atoi (argv[1]) : 2000;
+
+  if (n_rounds < 1)
+  {
+    fprintf (stderr, "Usage: %s [n_rounds]\n", argv[0]);
+    return 1;
+  }
+
+  printf ("UTF-8 kernels over 64 KiB, %d rounds, in GB/s\n", n_rounds);
+  printf ("%-8s %-8s %10s %10s %10s\n", "text", "kernels", whats[0],
+          whats[1], whats[2]);
+
+  for (size_t i = 0; i < sizeof texts / sizeof texts[0]; i++)
+  {
+    size_t len = c_bench_fill (text, texts[i].sample);
+
+    for (size_t k = 0; k < sizeof kernels / sizeof (char *); k++)
+    {
+      if (!c_utf8_use_kernels (kernels[k]))
+        continue;
+
+      printf ("%-8s %-8s", texts[i].name, kernels[k]);
+
+      for (int what = 0; what < 3; what++)
+        printf (" %10.2f", c_bench_run (what, text, len, n_rounds));
+
+      printf ("\n");
+    }
+  }
+
+  c_utf8_use_kernels (NULL);
+
+  return 0;
+}
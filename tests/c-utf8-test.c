@@ -0,0 +1,299 @@
+/* -*- Mode: C; indent-tabs-mode: nil; c-basic-offset: 2; tab-width: 2 -*- */
+/*
+ * c-utf8-test.c
+ * This file is part of Cim.
+ *
+ * Copyright (C) 2023 Hodong Kim <hodong@nimfsoft.art>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+#include "c-utf8.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/*
+ * The scalar, SSE2 and AVX2 kernels must give the same answers, on
+ * well-formed text and on every kind of malformed text, wherever in a 16-
+ * or 32-byte block the error falls.  Kernels the CPU lacks are skipped.
+ * Run it through "make check".
+ */
+
+#define C_TEST_MAX 512
+
+typedef struct
+{
+  bool     valid;
+  size_t   valid_len;
+  size_t   n_chars;
+  size_t   n_utf16;
+  size_t   n_c32;
+  char32_t c32[C_TEST_MAX];
+} CTestResult;
+
+static const char *c_test_kernels[] = { "sse2", "avx2" };
+
+static int c_test_n_failed;
+
+static void c_test_check (bool ok, const char *what)
+{
+  printf ("%s: %s\n", ok ? "ok" : "FAILED", what);
+
+  if (!ok)
+    c_test_n_failed++;
+}
+
+static void c_test_run (const char *utf8, size_t len, CTestResult *result)
+{
+  memset (result, 0, sizeof *result);
+
+  result->valid   = c_utf8_validate (utf8, len, &result->valid_len);
+  result->n_chars = c_utf8_count    (utf8, len, &result->n_utf16);
+  result->n_c32   = c_utf8_decode   (utf8, len, result->c32, C_TEST_MAX);
+}
+
+/* Returns true if every kernel agrees with the scalar one on utf8. */
+static bool c_test_agree (const char *utf8, size_t len, CTestResult *scalar)
+{
+  CTestResult result;
+
+  c_utf8_use_kernels ("scalar");
+  c_test_run (utf8, len, scalar);
+
+  for (size_t i = 0; i < sizeof c_test_kernels / sizeof (char *); i++)
+  {
+    if (!c_utf8_use_kernels (c_test_kernels[i]))
+      continue;
+
+    c_test_run (utf8, len, &result);
+
+    if (memcmp (&result, scalar, sizeof result))
+      return false;
+  }
+
+  return true;
+}
+
+/* a mix of 1- to 4-byte characters, for prefixes cut anywhere */
+static void c_test_well_formed ()
+{
+  const char *pieces[] = {
+    "hello ", "\xed\x95\x9c\xea\xb8\x80 ", "\xe6\xbc\xa2\xe5\xad\x97",
+    "\xf0\x9f\x98\x80", "\xc3\xa9", "\xef\xbf\xbd", "\xf4\x8f\xbf\xbf"
+  };
+
+  char        text[C_TEST_MAX];
+  size_t      len = 0;
+  size_t      boundary = 0;
+  CTestResult scalar;
+  bool        agree = true;
+  bool        right = true;
+
+  while (len + 8 < sizeof text)
+    for (size_t i = 0; i < sizeof pieces / sizeof (char *); i++)
+      if (len + strlen (pieces[i]) < sizeof text)
+      {
+        memcpy (text + len, pieces[i], strlen (pieces[i]));
+        len += strlen (pieces[i]);
+      }
+
+  for (size_t n = 0; n <= len; n++)
+  {
+    if (n < len && (text[n] & 0xc0) != 0x80)
+      boundary = n;
+
+    agree = agree && c_test_agree (text, n, &scalar);
+
+    /* a prefix that ends inside a character is a truncated tail */
+    if (n == len || (text[n] & 0xc0) != 0x80)
+      right = right && scalar.valid && scalar.valid_len == n;
+    else
+      right = right && !scalar.valid && scalar.valid_len == boundary;
+  }
+
+  c_test_check (right, "prefixes are valid up to their last whole character");
+  c_test_check (agree, "the kernels agree on every prefix");
+}
+
+/* Each one is malformed from its byte at, after an ASCII or Hangul lead-in
+ * of every length and before an ASCII tail, or with nothing after it. */
+static void c_test_malformed ()
+{
+  static const struct {
+    const char *bytes;
+    size_t      at;
+    const char *what;
+  } cases[] = {
+    { "\x80",             0, "a lone continuation" },
+    { "\xbf\xbf",         0, "two lone continuations" },
+    { "\xc3",             0, "a 2-byte lead at the end" },
+    { "\xe2\x82",         0, "a 3-byte character cut short" },
+    { "\xf0\x9f\x98",     0, "a 4-byte character cut short" },
+    { "\xe2\x82\xac\x80", 3, "a continuation too many" },
+    { "\xed\xa0\x80",     0, "a high surrogate" },
+    { "\xed\xbf\xbf",     0, "a low surrogate" },
+    { "\xc0\xaf",         0, "an overlong C0" },
+    { "\xc1\xbf",         0, "an overlong C1" },
+    { "\xe0\x80\xaf",     0, "an overlong 3-byte form" },
+    { "\xe0\x9f\xbf",     0, "an overlong 3-byte form at U+07FF" },
+    { "\xf0\x8f\xbf\xbf", 0, "an overlong 4-byte form" },
+    { "\xf4\x90\x80\x80", 0, "a character above U+10FFFF" },
+    { "\xf5\x80\x80\x80", 0, "an F5 lead" },
+    { "\xff",             0, "an FF byte" }
+  };
+
+  static const char *hangul = "\xea\xb0\x80";
+
+  char        text[256];
+  char        what[128];
+  CTestResult scalar;
+
+  for (size_t i = 0; i < sizeof cases / sizeof cases[0]; i++)
+  {
+    size_t n     = strlen (cases[i].bytes);
+    bool   agree = true;
+    bool   right = true;
+
+    for (size_t lead = 0; lead <= 96; lead++)
+    {
+      for (int multibyte = 0; multibyte < 2; multibyte++)
+      {
+        for (int tail = 0; tail < 2; tail++)
+        {
+          size_t len = 0;
+
+          while (len < lead)
+          {
+            if (multibyte && lead - len >= 3)
+            {
+              memcpy (text + len, hangul, 3);
+              len += 3;
+            }
+            else
+            {
+              text[len++] = 'a';
+            }
+          }
+
+          memcpy (text + len, cases[i].bytes, n);
+          len += n;
+
+          if (tail)
+          {
+            memset (text + len, 'z', 40);
+            len += 40;
+          }
+
+          agree = agree && c_test_agree (text, len, &scalar);
+          right = right && !scalar.valid &&
+                  scalar.valid_len == lead + cases[i].at;
+        }
+      }
+    }
+
+    snprintf (what, sizeof what, "%s is found at every offset", cases[i].what);
+    c_test_check (right, what);
+    snprintf (what, sizeof what, "the kernels agree on %s", cases[i].what);
+    c_test_check (agree, what);
+  }
+}
+
+static uint32_t c_test_random (uint32_t *state)
+{
+  *state ^= *state << 13;
+  *state ^= *state >> 17;
+  *state ^= *state << 5;
+
+  return *state;
+}
+
+/* characters of every length, now and then a byte of any value */
+static void c_test_random_text ()
+{
+  static const char32_t ranges[][2] = {
+    { 0x20, 0x7e }, { 0x80, 0x7ff }, { 0xac00, 0xd7a3 },
+    { 0xe000, 0xfffd }, { 0x10000, 0x10ffff }
+  };
+
+  uint32_t    state = 0x2023;
+  char        text[300];
+  CTestResult scalar;
+  bool        agree = true;
+
+  for (int round = 0; round < 5000; round++)
+  {
+    size_t len  = 0;
+    size_t want = c_test_random (&state) % 280;
+
+    while (len < want)
+    {
+      uint32_t r = c_test_random (&state);
+      char32_t c;
+
+      if (r % 64 == 0)
+      {
+        text[len++] = (char) (r >> 8);
+        continue;
+      }
+
+      /* ASCII most of the time, as in real text */
+      r %= 8;
+      r  = r < 4 ? 0 : r - 3;
+      c  = ranges[r][0] + c_test_random (&state) %
+                          (ranges[r][1] - ranges[r][0] + 1);
+
+      if (c < 0x80)
+      {
+        text[len++] = c;
+      }
+      else if (c < 0x800)
+      {
+        text[len++] = 0xc0 | c >> 6;
+        text[len++] = 0x80 | (c & 0x3f);
+      }
+      else if (c < 0x10000)
+      {
+        text[len++] = 0xe0 | c >> 12;
+        text[len++] = 0x80 | (c >> 6 & 0x3f);
+        text[len++] = 0x80 | (c & 0x3f);
+      }
+      else
+      {
+        text[len++] = 0xf0 | c >> 18;
+        text[len++] = 0x80 | (c >> 12 & 0x3f);
+        text[len++] = 0x80 | (c >> 6 & 0x3f);
+        text[len++] = 0x80 | (c & 0x3f);
+      }
+    }
+
+    agree = agree && c_test_agree (text, len, &scalar);
+  }
+
+  c_test_check (agree, "the kernels agree on random text");
+}
+
+int main ()
+{
+  for (size_t i = 0; i < sizeof c_test_kernels / sizeof (char *); i++)
+    if (!c_utf8_use_kernels (c_test_kernels[i]))
+      printf ("skipped: the %s kernels\n", c_test_kernels[i]);
+
+  c_test_check (!c_utf8_use_kernels ("neon"), "unknown kernels are refused");
+
+  c_test_well_formed ();
+  c_test_malformed ();
+  c_test_random_text ();
+
+  c_utf8_use_kernels (NULL);
+
+  return c_test_n_failed ? 1 : 0;
+}
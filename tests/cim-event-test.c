@@ -0,0 +1,216 @@
+/* -*- Mode: C; indent-tabs-mode: nil; c-basic-offset: 2; tab-width: 2 -*- */
+/*
+ * cim-event-test.c
+ * This file is part of Cim.
+ *
+ * Copyright (C) 2023 Hodong Kim <hodong@nimfsoft.art>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+#include "cim.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * How libcim marks and answers key events, with the test engine.
+ * Run it through "make check".
+ */
+
+static int cim_test_n_failed;
+
+static void cim_test_check (bool ok, const char* what)
+{
+  printf ("%s: %s\n", ok ? "ok" : "FAILED", what);
+
+  if (!ok)
+    cim_test_n_failed++;
+}
+
+static CimEvent cim_test_press (uint32_t keyval, uint32_t keycode)
+{
+  CimEvent event = { CIM_EVENT_KEY_PRESS, 0, keyval, keycode };
+
+  return event;
+}
+
+/* Tab moves the focus on its press, and is released in the next widget. */
+static void cim_test_repeat_across_focus ()
+{
+  CimIc*   ic = cim_ic_new ();
+  CimEvent event;
+
+  event = cim_test_press (CIM_KEY_Tab, 23);
+  cim_ic_track_repeat (ic, &event);
+  cim_test_check (!(event.flags & CIM_EVENT_REPEAT), "first press");
+
+  event = cim_test_press (CIM_KEY_Tab, 23);
+  cim_ic_track_repeat (ic, &event);
+  cim_test_check (event.flags & CIM_EVENT_REPEAT, "held press repeats");
+
+  cim_ic_focus_out (ic);
+  cim_ic_focus_in  (ic);
+
+  event = cim_test_press (CIM_KEY_Tab, 23);
+  cim_ic_track_repeat (ic, &event);
+  cim_test_check (!(event.flags & CIM_EVENT_REPEAT),
+                  "press after focus out and in");
+
+  cim_ic_reset (ic);
+
+  event = cim_test_press (CIM_KEY_Tab, 23);
+  cim_ic_track_repeat (ic, &event);
+  cim_test_check (!(event.flags & CIM_EVENT_REPEAT), "press after reset");
+
+  cim_ic_free (ic);
+}
+
+/*
+ * BackSpace held over a preedit of two letters: the test engine takes the
+ * five presses as one and hands back the three it has no letters for.
+ */
+static void cim_test_repeats_left ()
+{
+  CimIc*   ic = cim_ic_new ();
+  CimEvent events[6];
+  bool     handled[6];
+  int      n;
+
+  cim_ic_focus_in (ic);
+
+  for (int i = 0; i < 2; i++)
+  {
+    events[i] = cim_test_press ('a' + i, 38 + i);
+    cim_ic_filter_event (ic, &events[i]);
+  }
+
+  for (int i = 0; i < 5; i++)
+    events[i] = cim_test_press (CIM_KEY_BackSpace, 22);
+
+  events[5]      = events[0];
+  events[5].type = CIM_EVENT_KEY_RELEASE;
+
+  n = cim_ic_filter_events (ic, events, 6, handled);
+
+  cim_test_check (n == 5, "the batch stops after the repeats");
+  cim_test_check (handled[0] && handled[1], "two repeats used");
+  cim_test_check (!handled[2] && !handled[3] && !handled[4],
+                  "three repeats handed back");
+  cim_test_check (!cim_ic_get_preedit (ic)->text[0], "preedit is empty");
+
+  cim_ic_free (ic);
+}
+
+/* An engine's count is kept within the events it was given. */
+static void cim_test_bad_count ()
+{
+  CimIc*   ic = cim_ic_new ();
+  CimEvent events[3];
+  bool     handled[3];
+
+  cim_ic_focus_in (ic);
+
+  for (int i = 0; i < 3; i++)
+    events[i] = cim_test_press ('a' + i, 38 + i);
+
+  setenv ("CIM_TEST_ENGINE_N_FILTERED", "0", 1);
+  cim_test_check (cim_ic_filter_events (ic, events, 3, handled) == 1 &&
+                  !handled[0], "0 consumed is the first not handled");
+
+  setenv ("CIM_TEST_ENGINE_N_FILTERED", "100", 1);
+  cim_test_check (cim_ic_filter_events (ic, events, 3, handled) == 3,
+                  "100 consumed is all of them");
+
+  unsetenv ("CIM_TEST_ENGINE_N_FILTERED");
+
+  cim_ic_free (ic);
+}
+
+static void cb_interest_changed (CimIc*             ic,
+                                 const CimInterest* interest,
+                                 void*              user_data)
+{
+  *(uint32_t*) user_data = interest->flags | 0x80000000;
+}
+
+/* An engine may publish its interest from its own thread. */
+static void cim_test_interest_dispatch ()
+{
+  CimIc*      ic       = cim_ic_new ();
+  CimInterest interest = { 0 };
+  uint32_t    seen     = 0;
+
+  cim_ic_set_callback (ic, CIM_CB_INTEREST_CHANGED, cb_interest_changed,
+                       &seen);
+
+  cim_ic_set_interest (ic, &interest);
+  cim_test_check (!seen, "interest_changed waits for cim_dispatch()");
+
+  cim_ic_set_interest (ic, NULL);
+  cim_dispatch ();
+  cim_test_check (seen == (CIM_INTEREST_RELEASE | 0x80000000),
+                  "interest_changed gets the latest interest");
+
+  cim_ic_free (ic);
+}
+
+static void cb_commit (CimIc* ic, const char* text, void* user_data)
+{
+  snprintf (user_data, 64, "%s", text);
+}
+
+static void cim_test_surround_bounds ()
+{
+  static const struct {
+    const char* text;
+    int         len;
+    int         cursor_index;
+    int         anchor_index;
+    const char* seen;
+    const char* what;
+  } cases[] = {
+    { "hello", -1, 10, 20, "5 5 hello", "indices past a NUL-terminated text" },
+    { "hello", -1, -3, -1, "0 0 hello", "negative indices" },
+    { "hello world", 5, 8, 2, "5 2 hello", "indices past len" }
+  };
+
+  CimIc*   ic = cim_ic_new ();
+  CimEvent event = cim_test_press (CIM_KEY_F1, 67);
+  char     seen[64];
+
+  cim_ic_set_callback (ic, CIM_CB_COMMIT, cb_commit, seen);
+  cim_ic_focus_in (ic);
+
+  for (size_t i = 0; i < sizeof cases / sizeof cases[0]; i++)
+  {
+    seen[0] = 0;
+    cim_ic_set_surround (ic, cases[i].text, cases[i].len,
+                         cases[i].cursor_index, cases[i].anchor_index);
+    cim_ic_filter_event (ic, &event);
+    cim_test_check (!strcmp (seen, cases[i].seen), cases[i].what);
+  }
+
+  cim_ic_free (ic);
+}
+
+int main ()
+{
+  cim_test_repeat_across_focus ();
+  cim_test_repeats_left ();
+  cim_test_bad_count ();
+  cim_test_interest_dispatch ();
+  cim_test_surround_bounds ();
+
+  cim_finalize ();
+
+  return cim_test_n_failed ? 1 : 0;
+}
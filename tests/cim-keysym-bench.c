@@ -0,0 +1,152 @@
+/* -*- Mode: C; indent-tabs-mode: nil; c-basic-offset: 2; tab-width: 2 -*- */
+/*
+ * cim-keysym-bench.c
+ * This file is part of Cim.
+ *
+ * Copyright (C) 2023 Hodong Kim <hodong@nimfsoft.art>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+#include "cim.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/*
+ * Time to look up every keysym name and every named keysym with the
+ * perfect hashes, and with a linear search over the same entries, as a
+ * plain table in keysymdef.h order would need.
+ *
+ * Usage: cim-keysym-bench [n_rounds]
+ * Run it through "make bench".
+ */
+
+typedef struct
+{
+  uint32_t keysym;
+  uint16_t name;
+} CimKeysymName;
+
+typedef struct
+{
+  uint32_t keysym;
+  uint32_t unicode;
+} CimKeysymUnicode;
+
+#include "cim-keysym-table.h"
+
+#define CIM_BENCH_N_SLOTS \
+  (int) (sizeof cim_keysym_from_name_slots / sizeof (CimKeysymName))
+
+static CimKeysymName     cim_bench_entries[CIM_BENCH_N_SLOTS];
+static int               cim_bench_n_entries;
+static volatile uint32_t cim_bench_sink;
+
+static double cim_bench_now ()
+{
+  struct timespec ts;
+
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static int cim_bench_compare (const void* a, const void* b)
+{
+  return ((const CimKeysymName*) a)->name - ((const CimKeysymName*) b)->name;
+}
+
+/* the entries in the order of their names, which is keysymdef.h order */
+static void cim_bench_make_entries ()
+{
+  for (int i = 0; i < CIM_BENCH_N_SLOTS; i++)
+    if (cim_keysym_from_name_slots[i].name != CIM_KEYSYM_NO_NAME)
+      cim_bench_entries[cim_bench_n_entries++] = cim_keysym_from_name_slots[i];
+
+  qsort (cim_bench_entries, cim_bench_n_entries, sizeof (CimKeysymName),
+         cim_bench_compare);
+}
+
+static uint32_t cim_bench_linear_from_name (const char* name)
+{
+  for (int i = 0; i < cim_bench_n_entries; i++)
+    if (!strcmp (cim_keysym_names + cim_bench_entries[i].name, name))
+      return cim_bench_entries[i].keysym;
+
+  return 0;
+}
+
+static const char* cim_bench_linear_get_name (uint32_t keysym)
+{
+  for (int i = 0; i < cim_bench_n_entries; i++)
+    if (cim_bench_entries[i].keysym == keysym)
+      return cim_keysym_names + cim_bench_entries[i].name;
+
+  return NULL;
+}
+
+/* Returns nanoseconds per lookup. */
+static double cim_bench_run (int what, int n_rounds)
+{
+  double start = cim_bench_now ();
+
+  for (int round = 0; round < n_rounds; round++)
+  {
+    for (int i = 0; i < cim_bench_n_entries; i++)
+    {
+      const char* name   = cim_keysym_names + cim_bench_entries[i].name;
+      uint32_t    keysym = cim_bench_entries[i].keysym;
+
+      switch (what)
+      {
+        case 0:
+          cim_bench_sink = cim_keysym_from_name (name);
+          break;
+        case 1:
+          cim_bench_sink = cim_bench_linear_from_name (name);
+          break;
+        case 2:
+          cim_bench_sink = (uintptr_t) cim_keysym_get_name (keysym);
+          break;
+        default:
+          cim_bench_sink = (uintptr_t) cim_bench_linear_get_name (keysym);
+          break;
+      }
+    }
+  }
+
+  return (cim_bench_now () - start) / n_rounds / cim_bench_n_entries;
+}
+
+int main (int argc, char** argv)
+{
+  int n_rounds = argc > 1 ? atoi (argv[1]) : 20;
+
+  if (n_rounds < 1)
+  {
+    fprintf (stderr, "Usage: %s [n_rounds]\n", argv[0]);
+    return 1;
+  }
+
+  cim_bench_make_entries ();
+
+  printf ("%d keysym names, %d rounds, in ns per lookup\n",
+          cim_bench_n_entries, n_rounds);
+  printf ("%-24s %10s %10s\n", "", "hash", "linear");
+  printf ("%-24s %10.1f %10.1f\n", "cim_keysym_from_name ()",
+          cim_bench_run (0, n_rounds), cim_bench_run (1, n_rounds));
+  printf ("%-24s %10.1f %10.1f\n", "cim_keysym_get_name ()",
+          cim_bench_run (2, n_rounds), cim_bench_run (3, n_rounds));
+
+  return 0;
+}
@@ -0,0 +1,146 @@
+/* -*- Mode: C; indent-tabs-mode: nil; c-basic-offset: 2; tab-width: 2 -*- */
+/*
+ * cim-keysym-test.c
+ * This file is part of Cim.
+ *
+ * Copyright (C) 2023 Hodong Kim <hodong@nimfsoft.art>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+#include "cim.h"
+#include <stdio.h>
+#include <string.h>
+
+/*
+ * Every name in the generated tables must come back from the perfect
+ * hashes: cim_keysym_from_name () gives its keysym, and
+ * cim_keysym_get_name () gives a name of that keysym.
+ * Run it through "make check".
+ */
+
+typedef struct
+{
+  uint32_t keysym;
+  uint16_t name;
+} CimKeysymName;
+
+typedef struct
+{
+  uint32_t keysym;
+  uint32_t unicode;
+} CimKeysymUnicode;
+
+#include "cim-keysym-table.h"
+
+#define CIM_TEST_N_SLOTS(slots) (int) (sizeof slots / sizeof slots[0])
+
+static int cim_test_n_failed;
+
+static void cim_test_check (bool ok, const char* what)
+{
+  printf ("%s: %s\n", ok ? "ok" : "FAILED", what);
+
+  if (!ok)
+    cim_test_n_failed++;
+}
+
+/* Returns the keysym the table gives name, or 0 if it has no slot. */
+static uint32_t cim_test_table_keysym (uint16_t name)
+{
+  for (int i = 0; i < CIM_TEST_N_SLOTS (cim_keysym_from_name_slots); i++)
+    if (cim_keysym_from_name_slots[i].name == name)
+      return cim_keysym_from_name_slots[i].keysym;
+
+  return 0;
+}
+
+static void cim_test_round_trip ()
+{
+  int  n_names   = 0;
+  int  n_slots   = 0;
+  bool has_slot  = true;
+  bool from_name = true;
+  bool get_name  = true;
+
+  for (size_t i = 0; i < sizeof cim_keysym_names - 1;
+       i += strlen (cim_keysym_names + i) + 1)
+  {
+    const char* name   = cim_keysym_names + i;
+    uint32_t    keysym = cim_test_table_keysym (i);
+    const char* back;
+
+    n_names++;
+
+    if (!keysym)
+    {
+      printf ("no slot: %s\n", name);
+      has_slot = false;
+      continue;
+    }
+
+    if (cim_keysym_from_name (name) != keysym)
+    {
+      printf ("from_name: %s\n", name);
+      from_name = false;
+    }
+
+    back = cim_keysym_get_name (keysym);
+
+    if (!back || cim_keysym_from_name (back) != keysym)
+    {
+      printf ("get_name: %s\n", name);
+      get_name = false;
+    }
+  }
+
+  for (int i = 0; i < CIM_TEST_N_SLOTS (cim_keysym_from_name_slots); i++)
+    if (cim_keysym_from_name_slots[i].name != CIM_KEYSYM_NO_NAME)
+      n_slots++;
+
+  cim_test_check (has_slot && n_slots == n_names,
+                  "every name has one slot");
+  cim_test_check (from_name, "cim_keysym_from_name () finds every name");
+  cim_test_check (get_name, "cim_keysym_get_name () names every keysym");
+}
+
+static void cim_test_other_names ()
+{
+  cim_test_check (cim_keysym_from_name ("BackSpace") == CIM_KEY_BackSpace &&
+                  cim_keysym_from_name ("a") == 'a' &&
+                  cim_keysym_from_name ("Hangul") == CIM_KEY_Hangul,
+                  "names match cim.h");
+  cim_test_check (!cim_keysym_from_name ("") &&
+                  !cim_keysym_from_name ("BackSpac") &&
+                  !cim_keysym_from_name ("BackSpacex") &&
+                  !cim_keysym_from_name ("backspace"),
+                  "unknown names are 0");
+  cim_test_check (cim_keysym_from_name ("U20AC") == 0x010020ac &&
+                  cim_keysym_from_name ("U41") == 'A' &&
+                  !cim_keysym_from_name ("U110000") &&
+                  !cim_keysym_from_name ("U+41"),
+                  "U and a code point");
+  cim_test_check (cim_keysym_from_name ("0xff08") == CIM_KEY_BackSpace &&
+                  !cim_keysym_from_name ("0x") &&
+                  !cim_keysym_from_name ("0x-1"),
+                  "0x and a keysym");
+  cim_test_check (!cim_keysym_get_name (0) &&
+                  !cim_keysym_get_name (0x1fffffff),
+                  "keysyms without a name");
+}
+
+int main ()
+{
+  cim_test_round_trip ();
+  cim_test_other_names ();
+
+  return cim_test_n_failed ? 1 : 0;
+}
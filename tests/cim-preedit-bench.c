@@ -0,0 +1,146 @@
+/* -*- Mode: C; indent-tabs-mode: nil; c-basic-offset: 2; tab-width: 2 -*- */
+/*
+ * cim-preedit-bench.c
+ * This file is part of Cim.
+ *
+ * Copyright (C) 2023 Hodong Kim <hodong@nimfsoft.art>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+#include "cim.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/*
+ * Time per preedit update at 1k characters, with the attributes of a
+ * converter: an underline per clause and a highlight on the last one.  A
+ * toolkit that is sent the whole preedit measures it, and Qt also splits
+ * it into formatting runs; one that takes deltas gets only the change.
+ *
+ * Usage: cim-preedit-bench [n_rounds]
+ * Run it through "make bench", which points libcim at the test engine.
+ */
+
+#define CIM_BENCH_PREEDIT_LEN 1024
+
+typedef enum {
+  CIM_BENCH_TEXT,
+  CIM_BENCH_RUNS,
+  CIM_BENCH_DELTA
+} CimBenchMode;
+
+static int cim_bench_n_runs;
+
+static double cim_bench_now ()
+{
+  struct timespec ts;
+
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+
+  return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+static void cb_preedit_text (CimIc* ic, const CimPreedit* preedit,
+                             void* user_data)
+{
+  cim_ic_get_preedit_text (ic, true);
+}
+
+static void cb_preedit_runs (CimIc* ic, const CimPreedit* preedit,
+                             void* user_data)
+{
+  cim_ic_get_preedit_text (ic, true);
+  cim_ic_get_preedit_runs (ic, &cim_bench_n_runs);
+}
+
+static void cb_preedit_delta (CimIc* ic, const CimPreeditDelta* delta,
+                              void* user_data)
+{
+}
+
+static void cim_bench_key (CimIc* ic, uint32_t keyval, uint32_t keycode)
+{
+  CimEvent event = { CIM_EVENT_KEY_PRESS, 0, keyval, keycode };
+
+  cim_ic_filter_event (ic, &event);
+}
+
+/* Returns microseconds per update. */
+static double cim_bench_run (CimBenchMode mode, int n_rounds)
+{
+  CimCallbacks callbacks = { 0 };
+  CimIc*       ic;
+  double       start;
+  double       elapsed;
+
+  switch (mode)
+  {
+    case CIM_BENCH_TEXT:
+      callbacks.preedit_changed = cb_preedit_text;
+      break;
+    case CIM_BENCH_RUNS:
+      callbacks.preedit_changed = cb_preedit_runs;
+      break;
+    case CIM_BENCH_DELTA:
+      callbacks.preedit_delta   = cb_preedit_delta;
+      break;
+  }
+
+  ic = cim_ic_new ();
+  cim_ic_set_callbacks (ic, &callbacks, NULL);
+  cim_ic_focus_in (ic);
+
+  for (int i = 0; i < CIM_BENCH_PREEDIT_LEN; i++)
+    cim_bench_key (ic, 'a' + i % 26, 38);
+
+  start = cim_bench_now ();
+
+  for (int i = 0; i < n_rounds; i++)
+  {
+    cim_bench_key (ic, CIM_KEY_BackSpace, 22);
+    cim_bench_key (ic, 'a' + i % 26, 38);
+  }
+
+  elapsed = cim_bench_now () - start;
+
+  cim_ic_free (ic);
+
+  return elapsed / (2 * n_rounds);
+}
+
+int main (int argc, char** argv)
+{
+  static const char* modes[] = {
+    "preedit_changed, text", "preedit_changed, runs", "preedit_delta"
+  };
+
+  int n_rounds = argc > 1 ? atoi (argv[1]) : 5000;
+
+  if (n_rounds < 1)
+  {
+    fprintf (stderr, "Usage: %s [n_rounds]\n", argv[0]);
+    return 1;
+  }
+
+  printf ("%d-character preedit, %d updates, in us per update\n",
+          CIM_BENCH_PREEDIT_LEN, 2 * n_rounds);
+
+  for (int mode = CIM_BENCH_TEXT; mode <= CIM_BENCH_DELTA; mode++)
+    printf ("%-24s %8.3f\n", modes[mode], cim_bench_run (mode, n_rounds));
+
+  printf ("%d runs in the preedit\n", cim_bench_n_runs);
+
+  cim_finalize ();
+
+  return 0;
+}
@@ -0,0 +1,157 @@
+/* -*- Mode: C; indent-tabs-mode: nil; c-basic-offset: 2; tab-width: 2 -*- */
+/*
+ * cim-startup-bench.c
+ * This file is part of Cim.
+ *
+ * Copyright (C) 2023 Hodong Kim <hodong@nimfsoft.art>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+#include "cim.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+/*
+ * Time to the first filter_event, with and without cim_preload().  Each
+ * run is a new process, since the engine is loaded once per process.  A
+ * run loads libcim the way a toolkit module does, spends app_ms building
+ * its widgets, then creates an IC on focus-in and filters one key.
+ *
+ * Usage: cim-startup-bench [n_runs [app_ms]]
+ * Run it through "make bench", which points libcim at the test engine.
+ */
+
+static double cim_bench_now ()
+{
+  struct timespec ts;
+
+  clock_gettime (CLOCK_MONOTONIC, &ts);
+
+  return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+static void cim_bench_sleep (long ms)
+{
+  struct timespec ts = { ms / 1000, ms % 1000 * 1000000 };
+
+  nanosleep (&ts, NULL);
+}
+
+/* Returns the time to the first key and from startup to it, in ms. */
+static void cim_bench_run (bool preload, long app_ms, double times[2])
+{
+  CimEvent event = { CIM_EVENT_KEY_PRESS, 0, 'a', 38 };
+  CimIc*   ic;
+  double   start;
+  double   ready;
+
+  start = cim_bench_now ();
+
+  if (preload)
+    cim_preload ();
+
+  cim_bench_sleep (app_ms);
+  ready = cim_bench_now ();
+
+  ic = cim_ic_new ();
+  cim_ic_focus_in (ic);
+  cim_ic_filter_event (ic, &event);
+
+  times[0] = cim_bench_now () - ready;
+  times[1] = cim_bench_now () - start;
+
+  cim_ic_free (ic);
+  cim_finalize ();
+}
+
+static int cim_bench_compare (const void* a, const void* b)
+{
+  double x = *(const double*) a;
+  double y = *(const double*) b;
+
+  return (x > y) - (x < y);
+}
+
+/* Returns false if a run failed. */
+static bool cim_bench_mode (bool preload, int n_runs, long app_ms)
+{
+  double first[n_runs];
+  double total[n_runs];
+
+  for (int i = 0; i < n_runs; i++)
+  {
+    double times[2];
+    int    fds[2];
+    int    status;
+    pid_t  pid;
+
+    if (pipe (fds) || (pid = fork ()) < 0)
+      return false;
+
+    if (pid == 0)
+    {
+      close (fds[0]);
+      cim_bench_run (preload, app_ms, times);
+      _exit (write (fds[1], times, sizeof times) != sizeof times);
+    }
+
+    close (fds[1]);
+
+    if (read (fds[0], times, sizeof times) != sizeof times)
+      times[0] = times[1] = -1;
+
+    close (fds[0]);
+
+    if (waitpid (pid, &status, 0) < 0 || status || times[0] < 0)
+      return false;
+
+    first[i] = times[0];
+    total[i] = times[1];
+  }
+
+  qsort (first, n_runs, sizeof (double), cim_bench_compare);
+  qsort (total, n_runs, sizeof (double), cim_bench_compare);
+
+  printf ("%-12s %10.2f %22.2f\n", preload ? "preload" : "no preload",
+          first[n_runs / 2], total[n_runs / 2]);
+
+  return true;
+}
+
+int main (int argc, char** argv)
+{
+  int   n_runs = argc > 1 ? atoi (argv[1]) : 11;
+  long  app_ms = argc > 2 ? atol (argv[2]) : 50;
+  char* load   = getenv ("CIM_TEST_ENGINE_LOAD_MS");
+
+  if (n_runs < 1 || app_ms < 0)
+  {
+    fprintf (stderr, "Usage: %s [n_runs [app_ms]]\n", argv[0]);
+    return 1;
+  }
+
+  printf ("engine load %s ms, application startup %ld ms, "
+          "median of %d runs, in ms\n", load ? load : "0", app_ms, n_runs);
+  printf ("%-12s %10s %22s\n", "", "first key", "startup + first key");
+
+  if (!cim_bench_mode (false, n_runs, app_ms) ||
+      !cim_bench_mode (true,  n_runs, app_ms))
+  {
+    fprintf (stderr, "%s: a run failed\n", argv[0]);
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,271 @@
+/* -*- Mode: C; indent-tabs-mode: nil; c-basic-offset: 2; tab-width: 2 -*- */
+/*
+ * cim-test-engine.c
+ * This file is part of Cim.
+ *
+ * Copyright (C) 2023 Hodong Kim <hodong@nimfsoft.art>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+#include "cim.h"
+#include "c-macros.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/*
+ * The engine the tests and benchmarks load as cim.so.  Letters are
+ * composed into a preedit underlined in clauses of CIM_TEST_CLAUSE
+ * letters, the last one highlighted as a converter shows the clause it
+ * works on.  Space and Return commit it and
+ * BackSpace edits it.  It takes held keys as one event and hands back the
+ * BackSpaces its preedit has no room for.  F1 commits the surrounding
+ * text as "cursor_pos anchor_pos text".  Everything lives in fixed
+ * buffers, so it does not allocate after cim_plugin_new().
+ *
+ * With $CIM_TEST_ENGINE_LOAD_MS set, loading it takes that long, as
+ * loading an engine with a large dictionary does.  With
+ * $CIM_TEST_ENGINE_N_FILTERED set, filter_events() returns that instead of
+ * the number of events it consumed, as a broken engine would.
+ */
+
+#define CIM_TEST_PREEDIT_MAX 1024
+#define CIM_TEST_CLAUSE      8
+#define CIM_TEST_ATTRS_MAX   (CIM_TEST_PREEDIT_MAX / CIM_TEST_CLAUSE + 1)
+
+typedef struct _CimTestIc CimTestIc;
+struct _CimTestIc {
+  CimIc               parent;
+  const CimCallbacks* callbacks;
+  void*               user_data;
+  CimPreedit          preedit;
+  CimPreeditAttr      attrs[CIM_TEST_ATTRS_MAX];
+  char                text[CIM_TEST_PREEDIT_MAX + 1];
+  int                 len;
+  bool                started;
+  bool                short_run; /* repeats were handed back */
+};
+
+__attribute__ ((constructor))
+static void cim_test_engine_load ()
+{
+  const char*     env = getenv ("CIM_TEST_ENGINE_LOAD_MS");
+  long            ms  = env ? atol (env) : 0;
+  struct timespec ts  = { ms / 1000, ms % 1000 * 1000000 };
+
+  if (ms > 0)
+    nanosleep (&ts, NULL);
+}
+
+static void cim_test_update_preedit (CimTestIc* tic)
+{
+  int n = 0;
+
+  for (int start = 0; start < tic->len; start += CIM_TEST_CLAUSE)
+  {
+    tic->attrs[n].type        = CIM_PREEDIT_ATTR_UNDERLINE;
+    tic->attrs[n].start_index = start;
+    tic->attrs[n].end_index   = C_MIN (start + CIM_TEST_CLAUSE, tic->len);
+    n++;
+  }
+
+  if (n)
+  {
+    tic->attrs[n]      = tic->attrs[n - 1];
+    tic->attrs[n].type = CIM_PREEDIT_ATTR_HIGHLIGHT;
+    n++;
+  }
+
+  tic->text[tic->len]     = 0;
+  tic->preedit.attrs_len  = n;
+  tic->preedit.cursor_pos = tic->len;
+
+  if (!tic->started && tic->len)
+  {
+    tic->started = true;
+    tic->callbacks->preedit_start ((CimIc*) tic, tic->user_data);
+  }
+
+  tic->callbacks->preedit_changed ((CimIc*) tic, &tic->preedit,
+                                   tic->user_data);
+
+  if (tic->started && !tic->len)
+  {
+    tic->started = false;
+    tic->callbacks->preedit_end ((CimIc*) tic, tic->user_data);
+  }
+}
+
+static bool cim_test_commit (CimTestIc* tic)
+{
+  if (!tic->len)
+    return false;
+
+  tic->text[tic->len] = 0;
+  tic->callbacks->commit ((CimIc*) tic, tic->text, tic->user_data);
+  tic->len = 0;
+  cim_test_update_preedit (tic);
+
+  return true;
+}
+
+static bool cim_test_commit_surround (CimTestIc* tic)
+{
+  const CimSurround* surround;
+  char               text[CIM_TEST_PREEDIT_MAX + 1];
+
+  surround = tic->callbacks->get_surround ((CimIc*) tic, tic->user_data);
+
+  if (!surround)
+    return false;
+
+  snprintf (text, sizeof text, "%d %d %.*s", surround->cursor_pos,
+            surround->anchor_pos, surround->len, surround->text);
+  tic->callbacks->commit ((CimIc*) tic, text, tic->user_data);
+
+  return true;
+}
+
+static bool cim_test_filter_event (CimIc* ic, const CimEvent* event)
+{
+  CimTestIc* tic = (CimTestIc*) ic;
+
+  if (event->type == CIM_EVENT_KEY_RELEASE ||
+      event->state & (CIM_CONTROL_MASK | CIM_MOD1_MASK))
+    return false;
+
+  if ((event->keyval >= 'a' && event->keyval <= 'z') ||
+      (event->keyval >= 'A' && event->keyval <= 'Z'))
+  {
+    for (int i = 0; i <= event->n_repeats; i++)
+    {
+      if (tic->len == CIM_TEST_PREEDIT_MAX)
+        cim_test_commit (tic);
+
+      tic->text[tic->len++] = event->keyval;
+    }
+
+    cim_test_update_preedit (tic);
+
+    return true;
+  }
+
+  if (event->keyval == CIM_KEY_BackSpace)
+  {
+    int n = 1 + event->n_repeats;
+
+    if (!tic->len)
+      return false;
+
+    if (n > tic->len)
+    {
+      n = tic->len;
+      cim_ic_set_repeats_used (ic, event, n - 1);
+      tic->short_run = true;
+    }
+
+    tic->len -= n;
+    cim_test_update_preedit (tic);
+
+    return true;
+  }
+
+  if (event->keyval == CIM_KEY_space || event->keyval == CIM_KEY_Return)
+    return cim_test_commit (tic);
+
+  if (event->keyval == CIM_KEY_F1)
+    return cim_test_commit_surround (tic);
+
+  return false;
+}
+
+static int cim_test_filter_events (CimIc*          ic,
+                                   const CimEvent* events,
+                                   int             n_events,
+                                   bool*           handled)
+{
+  CimTestIc*  tic    = (CimTestIc*) ic;
+  const char* forced = getenv ("CIM_TEST_ENGINE_N_FILTERED");
+  int         i;
+
+  for (i = 0; i < n_events; i++)
+  {
+    tic->short_run = false;
+    handled[i]     = cim_test_filter_event (ic, &events[i]);
+
+    if (!handled[i] || tic->short_run)
+    {
+      i++;
+      break;
+    }
+  }
+
+  return forced ? atoi (forced) : i;
+}
+
+static void cim_test_reset (CimIc* ic)
+{
+  CimTestIc* tic = (CimTestIc*) ic;
+
+  if (tic->len)
+  {
+    tic->len = 0;
+    cim_test_update_preedit (tic);
+  }
+}
+
+static const CimPreedit* cim_test_get_preedit (CimIc* ic)
+{
+  return &((CimTestIc*) ic)->preedit;
+}
+
+static void cim_test_set_callbacks (CimIc*              ic,
+                                    const CimCallbacks* callbacks,
+                                    void*               user_data)
+{
+  CimTestIc* tic = (CimTestIc*) ic;
+
+  tic->callbacks = callbacks;
+  tic->user_data = user_data;
+}
+
+static const CimIcOps cim_test_ops = {
+  .size          = sizeof (CimIcOps),
+  .abi_version   = CIM_ABI_VERSION,
+  .caps          = CIM_CAP_PREEDIT | CIM_CAP_REPEAT,
+  .focus_out     = cim_test_reset,
+  .reset         = cim_test_reset,
+  .filter_event  = cim_test_filter_event,
+  .filter_events = cim_test_filter_events,
+  .get_preedit   = cim_test_get_preedit,
+  .set_callbacks = cim_test_set_callbacks
+};
+
+const CimIcOps* cim_plugin_query (uint32_t abi_version)
+{
+  return &cim_test_ops;
+}
+
+CimIc* cim_plugin_new ()
+{
+  CimTestIc* tic = calloc (1, sizeof (CimTestIc));
+
+  tic->preedit.text  = tic->text;
+  tic->preedit.attrs = tic->attrs;
+
+  return (CimIc*) tic;
+}
+
+void cim_plugin_free (CimIc* ic)
+{
+  free (ic);
+}
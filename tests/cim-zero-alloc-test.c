@@ -0,0 +1,236 @@
+/* -*- Mode: C; indent-tabs-mode: nil; c-basic-offset: 2; tab-width: 2 -*- */
+/*
+ * cim-zero-alloc-test.c
+ * This file is part of Cim.
+ *
+ * Copyright (C) 2023 Hodong Kim <hodong@nimfsoft.art>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any
+ * purpose with or without fee is hereby granted.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+ * WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+ * ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+ * WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+ * ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+ * OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+#define _GNU_SOURCE
+#include "cim.h"
+#include <dlfcn.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+/*
+ * Fails if filtering keys allocates once an IC has warmed up.  malloc(),
+ * calloc() and realloc() are replaced for the whole process, so libcim,
+ * the test engine and libc are all counted, whatever allocator they use.
+ *
+ * Run it through "make check", which points libcim at the test engine.
+ */
+
+#define CIM_TEST_N_ROUNDS 100
+
+static void* (*cim_test_malloc)  (size_t);
+static void* (*cim_test_calloc)  (size_t, size_t);
+static void* (*cim_test_realloc) (void*, size_t);
+static bool  cim_test_counting;
+static long  cim_test_n_allocs;
+
+/* dlsym() may calloc() before the real calloc() is known */
+static _Alignas (max_align_t) char cim_test_bootstrap[4096];
+static size_t cim_test_bootstrap_used;
+
+static void cim_test_count ()
+{
+  if (__atomic_load_n (&cim_test_counting, __ATOMIC_RELAXED))
+    __atomic_add_fetch (&cim_test_n_allocs, 1, __ATOMIC_RELAXED);
+}
+
+void* malloc (size_t size)
+{
+  if (!cim_test_malloc)
+    cim_test_malloc = dlsym (RTLD_NEXT, "malloc");
+
+  cim_test_count ();
+
+  return cim_test_malloc (size);
+}
+
+void* calloc (size_t number, size_t size)
+{
+  static bool looking_up;
+
+  if (!cim_test_calloc)
+  {
+    if (looking_up)
+    {
+      size_t offset = cim_test_bootstrap_used;
+
+      size = (number * size + 15) & ~(size_t) 15;
+
+      if (size > sizeof cim_test_bootstrap - offset)
+        return NULL;
+
+      cim_test_bootstrap_used += size;
+
+      return cim_test_bootstrap + offset;
+    }
+
+    looking_up      = true;
+    cim_test_calloc = dlsym (RTLD_NEXT, "calloc");
+    looking_up      = false;
+  }
+
+  cim_test_count ();
+
+  return cim_test_calloc (number, size);
+}
+
+void* realloc (void* ptr, size_t size)
+{
+  if (!cim_test_realloc)
+    cim_test_realloc = dlsym (RTLD_NEXT, "realloc");
+
+  cim_test_count ();
+
+  return cim_test_realloc (ptr, size);
+}
+
+void free (void* ptr)
+{
+  static void (*real_free) (void*);
+
+  if ((char*) ptr >= cim_test_bootstrap &&
+      (char*) ptr <  cim_test_bootstrap + sizeof cim_test_bootstrap)
+    return;
+
+  if (!real_free)
+    real_free = dlsym (RTLD_NEXT, "free");
+
+  real_free (ptr);
+}
+
+static void cb_preedit_changed (CimIc* ic, const CimPreedit* preedit,
+                                void* user_data)
+{
+}
+
+static void cb_preedit_delta (CimIc* ic, const CimPreeditDelta* delta,
+                              void* user_data)
+{
+}
+
+static void cb_commit (CimIc* ic, const char* text, void* user_data)
+{
+}
+
+/* a word, a correction, a commit, and a key the engine passes on */
+static const uint32_t cim_test_keys[] = {
+  'h', 'e', 'l', 'l', 'o', CIM_KEY_BackSpace, 'o', CIM_KEY_space,
+  'w', 'o', 'r', 'l', 'd', CIM_KEY_Return, CIM_KEY_Left
+};
+
+#define CIM_TEST_N_KEYS (int) (sizeof cim_test_keys / sizeof (uint32_t))
+
+static void cim_test_make_events (CimEvent events[2 * CIM_TEST_N_KEYS])
+{
+  memset (events, 0, 2 * CIM_TEST_N_KEYS * sizeof (CimEvent));
+
+  for (int i = 0; i < CIM_TEST_N_KEYS; i++)
+  {
+    events[2 * i].type     = CIM_EVENT_KEY_PRESS;
+    events[2 * i].keyval   = cim_test_keys[i];
+    events[2 * i].keycode  = cim_test_keys[i] & 0xff;
+    events[2 * i + 1]      = events[2 * i];
+    events[2 * i + 1].type = CIM_EVENT_KEY_RELEASE;
+  }
+}
+
+static void cim_test_type (CimIc* ic, int path)
+{
+  CimEvent events[2 * CIM_TEST_N_KEYS];
+  bool     handled[2 * CIM_TEST_N_KEYS];
+  int      n = 2 * CIM_TEST_N_KEYS;
+
+  cim_test_make_events (events);
+
+  switch (path)
+  {
+    case 0:
+      for (int i = 0; i < n; i++)
+        cim_ic_filter_event (ic, &events[i]);
+      break;
+    case 1:
+      for (int i = 0; i < n; i += cim_ic_filter_events (ic, events + i,
+                                                         n - i, handled + i))
+        ;
+      break;
+    default:
+      for (int i = 0; i < n; i++)
+        cim_ic_filter_event_async (ic, &events[i]);
+      break;
+  }
+}
+
+/* Returns the allocations made after warming up. */
+static long cim_test_run (bool delta, int path)
+{
+  CimCallbacks callbacks = { .commit = cb_commit };
+  CimIc*       ic;
+  long         n_allocs;
+
+  if (delta)
+    callbacks.preedit_delta   = cb_preedit_delta;
+  else
+    callbacks.preedit_changed = cb_preedit_changed;
+
+  ic = cim_ic_new ();
+  cim_ic_set_callbacks (ic, &callbacks, NULL);
+  cim_ic_focus_in (ic);
+
+  cim_test_type (ic, path);
+
+  cim_test_n_allocs = 0;
+  __atomic_store_n (&cim_test_counting, true, __ATOMIC_RELAXED);
+
+  for (int i = 0; i < CIM_TEST_N_ROUNDS; i++)
+    cim_test_type (ic, path);
+
+  __atomic_store_n (&cim_test_counting, false, __ATOMIC_RELAXED);
+  n_allocs = cim_test_n_allocs;
+
+  cim_ic_free (ic);
+
+  return n_allocs;
+}
+
+int main ()
+{
+  static const char* paths[] = {
+    "cim_ic_filter_event", "cim_ic_filter_events", "cim_ic_filter_event_async"
+  };
+
+  int retval = 0;
+
+  for (int path = 0; path < (int) (sizeof paths / sizeof paths[0]); path++)
+  {
+    for (int delta = 0; delta < 2; delta++)
+    {
+      long n_allocs = cim_test_run (delta, path);
+
+      printf ("%-26s %-16s %ld allocations in %d keys\n", paths[path],
+              delta ? "preedit_delta" : "preedit_changed", n_allocs,
+              CIM_TEST_N_ROUNDS * 2 * CIM_TEST_N_KEYS);
+
+      if (n_allocs)
+        retval = 1;
+    }
+  }
+
+  cim_finalize ();
+
+  return retval;
+}